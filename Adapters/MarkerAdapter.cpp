@@ -24,12 +24,22 @@ limitations under the License.
 #define DBG_MODULE "ACDB"
 #define DBG_TAG "MarkerAdapter"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+#include "Acdb/GeoUtil.hpp"
 #include "Acdb/MapMarker.hpp"
 #include "Acdb/MarkerAdapter.hpp"
 #include "Acdb/MarkerFactory.hpp"
 #include "Acdb/PrvTypes.hpp"
+#include "Acdb/TraceSpan.hpp"
 
 namespace Acdb {
+// Definitions for the ODR-used constants; required until C++17 inline variables.
+constexpr double MarkerAdapter::NearestSearchInitialRadius;
+constexpr double MarkerAdapter::RouteSearchMinProbeLength;
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -39,7 +49,8 @@ namespace Acdb {
 MarkerAdapter::MarkerAdapter(SQLite::Database& aDatabase)
     : mMarker{aDatabase},
       mSearchMarker{aDatabase},
-      mReviewSummary{aDatabase} {}  // end of MarkerAdapter
+      mReviewSummary{aDatabase},
+      mMarkerSnapshot(nullptr) {}  // end of MarkerAdapter
 
 //----------------------------------------------------------------
 //!
@@ -75,6 +86,17 @@ IMapMarkerPtr MarkerAdapter::GetMapMarker(const ACDB_marker_idx_type aIdx) {
   return marker;
 }  // end of GetMapMarker
 
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Get every point, e.g. to write a marker snapshot.
+//!
+//----------------------------------------------------------------
+bool MarkerAdapter::GetAllMapMarkers(MapMarkerColumns& aResults) {
+  return mMarker.GetAll(aResults);
+}  // end of GetAllMapMarkers
+
 //----------------------------------------------------------------
 //!
 //!    @public
@@ -84,14 +106,68 @@ IMapMarkerPtr MarkerAdapter::GetMapMarker(const ACDB_marker_idx_type aIdx) {
 //----------------------------------------------------------------
 void MarkerAdapter::GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
                                           std::vector<IMapMarkerPtr>& aResults) {
-  std::vector<MarkerTableDataType> markerList;
-  if (mMarker.GetFiltered(aFilter, markerList)) {
-    for (auto& it : markerList) {
-      aResults.push_back(Acdb::GetMapMarker(it));
-    }
+  ACDB_TRACE_SPAN("MarkerAdapter::GetMapMarkersByFilter");
+  MapMarkerColumns markerColumns;
+  ReadMapMarkers(aFilter, markerColumns);
+
+  aResults.reserve(aResults.size() + markerColumns.Size());
+  for (const MapMarkerColumns::Row& row : markerColumns) {
+    aResults.push_back(Acdb::GetMapMarker(row));
   }
 }  // end of GetMapMarkers
 
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find points in the provided bounding box, without creating
+//!    an object per point.
+//!
+//----------------------------------------------------------------
+void MarkerAdapter::GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
+                                          MapMarkerColumns& aResults) {
+  ACDB_TRACE_SPAN("MarkerAdapter::GetMapMarkersByFilter");
+  ReadMapMarkers(aFilter, aResults);
+}  // end of GetMapMarkersByFilter
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find points for several filters at once.  Each marker is
+//!    added to aResults once, however many filters match it;
+//!    aResultIndexes[i] lists the aResults indexes matching
+//!    aFilters[i].
+//!
+//----------------------------------------------------------------
+void MarkerAdapter::GetMapMarkersByFilters(const std::vector<MapMarkerFilter>& aFilters,
+                                           std::vector<IMapMarkerPtr>& aResults,
+                                           std::vector<std::vector<size_t>>& aResultIndexes) {
+  ACDB_TRACE_SPAN("MarkerAdapter::GetMapMarkersByFilters");
+  std::unordered_map<ACDB_marker_idx_type, size_t> resultIndexById;
+
+  aResultIndexes.assign(aFilters.size(), std::vector<size_t>{});
+
+  // Reused by every filter, so the columns are only allocated for the largest read.
+  MapMarkerColumns markerColumns;
+
+  for (size_t i = 0; i < aFilters.size(); i++) {
+    markerColumns.Clear();
+    ReadMapMarkers(aFilters[i], markerColumns);
+
+    aResultIndexes[i].reserve(markerColumns.Size());
+
+    for (const MapMarkerColumns::Row& row : markerColumns) {
+      auto inserted = resultIndexById.emplace(row.GetId(), aResults.size());
+      if (inserted.second) {
+        aResults.push_back(Acdb::GetMapMarker(row));
+      }
+
+      aResultIndexes[i].push_back(inserted.first->second);
+    }
+  }
+}  // end of GetMapMarkersByFilters
+
 //----------------------------------------------------------------
 //!
 //!    @public
@@ -118,11 +194,11 @@ ISearchMarkerPtr MarkerAdapter::GetSearchMarker(const ACDB_marker_idx_type aIdx)
 //----------------------------------------------------------------
 void MarkerAdapter::GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
                                                   std::vector<ISearchMarkerPtr>& aResults) {
+  ACDB_TRACE_SPAN("MarkerAdapter::GetBasicSearchMarkersByFilter");
   std::vector<MarkerTableDataType> markerList;
-  if (mSearchMarker.GetBasicFiltered(aFilter, markerList)) {
-    for (auto& it : markerList) {
-      aResults.push_back(Acdb::GetSearchMarker(it));
-    }
+  mSearchMarker.GetBasicFiltered(aFilter, markerList);
+  for (auto& it : markerList) {
+    aResults.push_back(Acdb::GetSearchMarker(it));
   }
 }  // end of GetBasicSearchMarkersByFilter
 
@@ -135,12 +211,259 @@ void MarkerAdapter::GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFil
 //----------------------------------------------------------------
 void MarkerAdapter::GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
                                              std::vector<ISearchMarkerPtr>& aResults) {
+  ACDB_TRACE_SPAN("MarkerAdapter::GetSearchMarkersByFilter");
   std::vector<ExtendedMarkerDataType> markerList;
-  if (mSearchMarker.GetExtendedFiltered(aFilter, markerList)) {
-    for (auto& it : markerList) {
-      aResults.push_back(Acdb::GetSearchMarker(it));
-    }
+  mSearchMarker.GetExtendedFiltered(aFilter, markerList);
+  for (auto& it : markerList) {
+    aResults.push_back(Acdb::GetSearchMarker(it));
   }
 }  // end of GetSearchMarkersByFilter
 
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find the markers matching the filter closest to aPosition,
+//!    ordered by great-circle distance.  The filter's bounding box,
+//!    max results and sort order are ignored.
+//!
+//!    The search box starts around aPosition and doubles in radius
+//!    until it holds aCount matches inside the search radius.  Any
+//!    marker outside the radius may be further away than one not
+//!    yet read, so only matches inside it are final.  Only the
+//!    final aCount markers are read with their extended data.
+//!
+//----------------------------------------------------------------
+void MarkerAdapter::GetNearestSearchMarkers(const scposn_type& aPosition, const uint32_t aCount,
+                                            const SearchMarkerFilter& aFilter,
+                                            std::vector<SearchMarkerDistancePair>& aResults) {
+  ACDB_TRACE_SPAN("MarkerAdapter::GetNearestSearchMarkers");
+  if (aCount == 0) {
+    return;
+  }
+
+  SearchMarkerFilter adaptedFilter = aFilter;
+  adaptedFilter.SetMaxResults(-1);
+  adaptedFilter.SetSortOrder(SearchMarkerFilter::SortNone);
+
+  // (distance, index into markerList)
+  std::vector<std::pair<double, size_t>> candidates;
+  std::vector<MarkerTableDataType> markerList;
+  double radius = NearestSearchInitialRadius;
+  bool coversWorld = false;
+
+  while (!coversWorld) {
+    bbox_type bbox = Geo::GetBoundingBox(aPosition, radius, coversWorld);
+
+    markerList.clear();
+    adaptedFilter.SetBbox(bbox);
+    mSearchMarker.GetBasicFiltered(adaptedFilter, markerList);
+
+    candidates.clear();
+    uint32_t withinRadius = 0;
+    for (size_t i = 0; i < markerList.size(); i++) {
+      double distance = Geo::GetDistanceMeters(aPosition, markerList[i].mPosn);
+      if (distance <= radius) {
+        withinRadius++;
+      }
+
+      candidates.emplace_back(distance, i);
+    }
+
+    if (withinRadius >= aCount) {
+      break;
+    }
+
+    radius *= 2;
+  }
+
+  const size_t resultCount = std::min(candidates.size(), static_cast<size_t>(aCount));
+  std::partial_sort(candidates.begin(), candidates.begin() + resultCount, candidates.end());
+
+  std::vector<MarkerTableDataType> resultList;
+  resultList.reserve(resultCount);
+  for (size_t i = 0; i < resultCount; i++) {
+    resultList.push_back(std::move(markerList[candidates[i].second]));
+  }
+
+  // Extended data is read for all results at once, rather than marker by marker.
+  std::vector<ExtendedMarkerDataType> extendedList;
+  mSearchMarker.GetExtendedData(resultList, extendedList);
+
+  for (size_t i = 0; i < extendedList.size(); i++) {
+    aResults.emplace_back(Acdb::GetSearchMarker(extendedList[i]), candidates[i].first);
+  }
+}  // end of GetNearestSearchMarkers
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find the markers matching the filter within aBufferMeters of
+//!    the polyline aRoute.  The filter's bounding box, max results
+//!    and sort order are ignored.  Results are passed to aCallback
+//!    leg by leg, ordered by distance along the route; see
+//!    GetSearchMarkersAlongRouteLeg.
+//!
+//----------------------------------------------------------------
+void MarkerAdapter::GetSearchMarkersAlongRoute(const std::vector<scposn_type>& aRoute,
+                                               const double aBufferMeters,
+                                               const SearchMarkerFilter& aFilter,
+                                               const RouteSearchCallback& aCallback) {
+  ACDB_TRACE_SPAN("MarkerAdapter::GetSearchMarkersAlongRoute");
+  RouteSearchProgress progress;
+  bool more = true;
+
+  while (more) {
+    std::vector<RouteSearchMarker> legResults;
+    more = GetSearchMarkersAlongRouteLeg(aRoute, aBufferMeters, aFilter, progress, legResults);
+
+    for (auto& result : legResults) {
+      if (!aCallback(std::move(result))) {
+        return;
+      }
+    }
+  }
+}  // end of GetSearchMarkersAlongRoute
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find the markers matching the filter within aBufferMeters of
+//!    the next leg of the polyline aRoute, and add them to aResults
+//!    ordered by distance along the route.  Each marker is reported
+//!    once: for the first leg that passes within the buffer.
+//!
+//!    The leg is cut into pieces no longer than twice the buffer
+//!    (or RouteSearchMinProbeLength), and each piece is probed with
+//!    the box around a circle that contains its whole corridor.
+//!    Candidates are then checked against the exact great-circle
+//!    distance to the leg, and the extended data of the markers
+//!    found is read in one batch.
+//!
+//!    @return true if legs remain after this one
+//!
+//----------------------------------------------------------------
+bool MarkerAdapter::GetSearchMarkersAlongRouteLeg(const std::vector<scposn_type>& aRoute,
+                                                  const double aBufferMeters,
+                                                  const SearchMarkerFilter& aFilter,
+                                                  RouteSearchProgress& aProgress,
+                                                  std::vector<RouteSearchMarker>& aResults) {
+  ACDB_TRACE_SPAN("MarkerAdapter::GetSearchMarkersAlongRouteLeg");
+  // A single position is searched as a zero-length leg.
+  const size_t legCount = std::max(aRoute.size(), static_cast<size_t>(2)) - 1;
+
+  if (aRoute.empty() || aBufferMeters < 0 || aProgress.mNextLeg >= legCount) {
+    return false;
+  }
+
+  SearchMarkerFilter adaptedFilter = aFilter;
+  adaptedFilter.SetMaxResults(-1);
+  adaptedFilter.SetSortOrder(SearchMarkerFilter::SortNone);
+
+  const double probeLength = std::max(2 * aBufferMeters, RouteSearchMinProbeLength);
+
+  const size_t leg = aProgress.mNextLeg;
+  const scposn_type& legStart = aRoute[leg];
+  const scposn_type& legEnd = aRoute.size() > 1 ? aRoute[leg + 1] : legStart;
+
+  const double legLength = Geo::GetDistanceMeters(legStart, legEnd);
+  const uint32_t pieceCount =
+      std::max(static_cast<uint32_t>(std::ceil(legLength / probeLength)), 1u);
+  const double probeRadius = legLength / pieceCount / 2 + aBufferMeters;
+
+  std::vector<MarkerTableDataType> markerList;
+  for (uint32_t piece = 0; piece < pieceCount; piece++) {
+    scposn_type center = Geo::GetIntermediatePoint(legStart, legEnd, (piece + 0.5) / pieceCount);
+
+    bool coversWorld;
+    adaptedFilter.SetBbox(Geo::GetBoundingBox(center, probeRadius, coversWorld));
+    mSearchMarker.GetBasicFiltered(adaptedFilter, markerList);
+  }
+
+  // Neighboring probes overlap, so a marker can appear more than once.
+  // (distance along route, (distance from route, index into markerList)), sorted into route order
+  std::vector<std::pair<double, std::pair<double, size_t>>> legResults;
+  std::unordered_set<ACDB_marker_idx_type> seen;
+  for (size_t i = 0; i < markerList.size(); i++) {
+    const MarkerTableDataType& marker = markerList[i];
+    if (aProgress.mReported.count(marker.mId) != 0 || !seen.insert(marker.mId).second) {
+      continue;
+    }
+
+    double alongLeg;
+    double distance = Geo::GetDistanceToSegmentMeters(marker.mPosn, legStart, legEnd, alongLeg);
+    if (distance <= aBufferMeters) {
+      legResults.emplace_back(aProgress.mRouteOffset + alongLeg, std::make_pair(distance, i));
+    }
+  }
+
+  std::sort(legResults.begin(), legResults.end());
+
+  std::vector<MarkerTableDataType> resultList;
+  resultList.reserve(legResults.size());
+  for (const auto& result : legResults) {
+    aProgress.mReported.insert(markerList[result.second.second].mId);
+    resultList.push_back(std::move(markerList[result.second.second]));
+  }
+
+  std::vector<ExtendedMarkerDataType> extendedList;
+  mSearchMarker.GetExtendedData(resultList, extendedList);
+
+  for (size_t i = 0; i < extendedList.size(); i++) {
+    aResults.push_back(RouteSearchMarker{Acdb::GetSearchMarker(extendedList[i]),
+                                         legResults[i].second.first, legResults[i].first});
+  }
+
+  aProgress.mRouteOffset += legLength;
+  aProgress.mNextLeg++;
+
+  return aProgress.mNextLeg < legCount;
+}  // end of GetSearchMarkersAlongRouteLeg
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find the marker records matching the provided filter, for
+//!    callers that keep them to filter again in memory.
+//!
+//----------------------------------------------------------------
+void MarkerAdapter::GetSearchCandidates(const SearchMarkerFilter& aFilter,
+                                        std::vector<MarkerTableDataType>& aResults) {
+  ACDB_TRACE_SPAN("MarkerAdapter::GetSearchCandidates");
+  mSearchMarker.GetBasicFiltered(aFilter, aResults);
+}  // end of GetSearchCandidates
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Serve the map marker reads from aSnapshot, or from the
+//!    database if it is null.  The snapshot must outlive its use
+//!    here, so it is set under the repository write lock.
+//!
+//----------------------------------------------------------------
+void MarkerAdapter::SetMarkerSnapshot(const MarkerSnapshot* aSnapshot) {
+  mMarkerSnapshot = aSnapshot;
+}  // end of SetMarkerSnapshot
+
+//----------------------------------------------------------------
+//!
+//!    @private
+//!    @detail
+//!    Add the points matching aFilter to aResults, from the
+//!    marker snapshot if there is one.
+//!
+//----------------------------------------------------------------
+void MarkerAdapter::ReadMapMarkers(const MapMarkerFilter& aFilter, MapMarkerColumns& aResults) {
+  if (mMarkerSnapshot != nullptr) {
+    mMarkerSnapshot->GetMapMarkersByFilter(aFilter, aResults);
+  } else {
+    // An interrupted read still returns the markers read before it stopped.
+    mMarker.GetFiltered(aFilter, aResults);
+  }
+}  // end of ReadMapMarkers
+
 }  // end of namespace Acdb
@@ -32,6 +32,7 @@ limitations under the License.
 #include "Acdb/Presentation/PresentationMarker.hpp"
 #include "Acdb/Presentation/PresentationMarkerFactory.hpp"
 #include "Acdb/SectionType.hpp"
+#include "Acdb/TraceSpan.hpp"
 
 namespace Acdb {
 //----------------------------------------------------------------
@@ -139,6 +140,7 @@ Presentation::BusinessPtr PresentationAdapter::GetBusiness(const ACDB_marker_idx
 //----------------------------------------------------------------
 Presentation::BusinessPhotoListPtr PresentationAdapter::GetBusinessPhotoList(
     const ACDB_marker_idx_type aIdx) {
+  ACDB_TRACE_SPAN("PresentationAdapter::GetBusinessPhotoList");
   Presentation::BusinessPhotoListPtr businessPhotoList = nullptr;
 
   std::vector<BusinessPhotoTableDataType> businessPhotoTableData;
@@ -275,6 +277,44 @@ Presentation::FuelPtr PresentationAdapter::GetFuel(const ACDB_marker_idx_type aI
 //----------------------------------------------------------------
 Presentation::PresentationMarkerPtr PresentationAdapter::GetMarker(
     const ACDB_marker_idx_type aIdx, const std::string& aCaptainName) {
+  static const SectionType allSections =
+      SectionType(SectionType::PointOfInterest) | SectionType::Summary | SectionType::Address |
+      SectionType::Contact | SectionType::Business | SectionType::Navigation |
+      SectionType::Amenities | SectionType::Services | SectionType::Retail | SectionType::Fuel |
+      SectionType::Dockage | SectionType::Moorings | SectionType::ReviewDetail;
+
+  return GetMarker(aIdx, allSections, aCaptainName);
+}  // end of GetMarker
+
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief accessor
+//!
+//!       @returns a specific Marker containing only the marker
+//!       detail and the requested sections.  Used by section pages,
+//!       which do not need the rest of the presentation data.
+//!
+//----------------------------------------------------------------
+Presentation::PresentationMarkerPtr PresentationAdapter::GetMarkerSections(
+    const ACDB_marker_idx_type aIdx, const SectionType aSections) {
+  return GetMarker(aIdx, aSections, std::string());
+}  // end of GetMarkerSections
+
+//----------------------------------------------------------------
+//!
+//!       @private
+//!       @brief accessor
+//!
+//!       @returns a specific Marker with the sections in aSections
+//!       loaded.  Business photos and competitor ads are only
+//!       loaded with the summary section, which displays them.
+//!
+//----------------------------------------------------------------
+Presentation::PresentationMarkerPtr PresentationAdapter::GetMarker(
+    const ACDB_marker_idx_type aIdx, const SectionType aSections,
+    const std::string& aCaptainName) {
+  ACDB_TRACE_SPAN("PresentationAdapter::GetMarker");
   Presentation::PresentationMarkerPtr presentationMarker = nullptr;
 
   MarkerTableDataType markerTableData;
@@ -285,32 +325,86 @@ Presentation::PresentationMarkerPtr PresentationAdapter::GetMarker(
     SectionType requiredSections = SectionType::GetRequiredSections(markerTableData.mType);
 
     std::vector<BusinessPhotoTableDataType> businessPhotoTableData;
-    mBusinessPhoto.Get(aIdx, businessPhotoTableData);  // can be empty
+    Presentation::CompetitorAdPtr competitorAd = nullptr;
+
+    if (IsSectionRequired(aSections, SectionType::Summary)) {
+      mBusinessPhoto.Get(aIdx, businessPhotoTableData);  // can be empty
+
+      BusinessProgramTableDataType businessProgramTableData;
+      if (!mBusinessProgram.Get(aIdx, businessProgramTableData)) {
+        businessProgramTableData =
+            BusinessProgramTableDataType();  // Ensure we are using default values.
+      }
+
+      competitorAd = GetCompetitorAd(aIdx, businessProgramTableData);
+    }
+
+    Presentation::AddressPtr address = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Address)) {
+      address = GetAddress(aIdx, IsSectionRequired(requiredSections, SectionType::Address));
+    }
+
+    Presentation::AmenitiesPtr amenities = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Amenities)) {
+      amenities = GetAmenities(aIdx, IsSectionRequired(requiredSections, SectionType::Amenities));
+    }
+
+    Presentation::BusinessPtr business = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Business)) {
+      business = GetBusiness(aIdx, IsSectionRequired(requiredSections, SectionType::Business));
+    }
+
+    Presentation::ContactPtr contact = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Contact)) {
+      contact = GetContact(aIdx, IsSectionRequired(requiredSections, SectionType::Contact));
+    }
+
+    Presentation::DockagePtr dockage = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Dockage)) {
+      dockage = GetDockage(aIdx, IsSectionRequired(requiredSections, SectionType::Dockage));
+    }
+
+    Presentation::FuelPtr fuel = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Fuel)) {
+      fuel = GetFuel(aIdx, IsSectionRequired(requiredSections, SectionType::Fuel));
+    }
+
+    Presentation::MooringsPtr moorings = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Moorings)) {
+      moorings = GetMoorings(aIdx, IsSectionRequired(requiredSections, SectionType::Moorings));
+    }
+
+    Presentation::NavigationPtr navigation = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Navigation)) {
+      navigation =
+          GetNavigation(aIdx, IsSectionRequired(requiredSections, SectionType::Navigation));
+    }
+
+    Presentation::RetailPtr retail = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Retail)) {
+      retail = GetRetail(aIdx, IsSectionRequired(requiredSections, SectionType::Retail));
+    }
+
+    Presentation::ReviewDetailPtr reviewDetail = nullptr;
+    if (IsSectionRequired(aSections, SectionType::ReviewDetail)) {
+      reviewDetail = GetReviewDetail(
+          aIdx, markerTableData.mType, reviewSummaryTableData,
+          IsSectionRequired(requiredSections, SectionType::ReviewDetail), aCaptainName);
+    }
 
-    BusinessProgramTableDataType businessProgramTableData;
-    if (!mBusinessProgram.Get(aIdx, businessProgramTableData)) {
-      businessProgramTableData =
-          BusinessProgramTableDataType();  // Ensure we are using default values.
+    Presentation::ServicesPtr services = nullptr;
+    if (IsSectionRequired(aSections, SectionType::Services)) {
+      services = GetServices(aIdx, IsSectionRequired(requiredSections, SectionType::Services));
     }
 
     presentationMarker.reset(new Presentation::PresentationMarker(
         aIdx,
         Acdb::Presentation::GetMarkerDetail(aIdx, markerTableData, markerMetaTableData,
                                             reviewSummaryTableData, businessPhotoTableData),
-        GetAddress(aIdx, IsSectionRequired(requiredSections, SectionType::Address)),
-        GetAmenities(aIdx, IsSectionRequired(requiredSections, SectionType::Amenities)),
-        GetBusiness(aIdx, IsSectionRequired(requiredSections, SectionType::Business)),
-        GetCompetitorAd(aIdx, businessProgramTableData),
-        GetContact(aIdx, IsSectionRequired(requiredSections, SectionType::Contact)),
-        GetDockage(aIdx, IsSectionRequired(requiredSections, SectionType::Dockage)),
-        GetFuel(aIdx, IsSectionRequired(requiredSections, SectionType::Fuel)),
-        GetMoorings(aIdx, IsSectionRequired(requiredSections, SectionType::Moorings)),
-        GetNavigation(aIdx, IsSectionRequired(requiredSections, SectionType::Navigation)),
-        GetRetail(aIdx, IsSectionRequired(requiredSections, SectionType::Retail)),
-        GetReviewDetail(aIdx, markerTableData.mType, reviewSummaryTableData,
-                        IsSectionRequired(requiredSections, SectionType::ReviewDetail),
-                        aCaptainName),
-        GetServices(aIdx, IsSectionRequired(requiredSections, SectionType::Services))));
+        std::move(address), std::move(amenities), std::move(business), std::move(competitorAd),
+        std::move(contact), std::move(dockage), std::move(fuel), std::move(moorings),
+        std::move(navigation), std::move(retail), std::move(reviewDetail),
+        std::move(services)));
   }
 
   return presentationMarker;
@@ -429,6 +523,7 @@ Presentation::ReviewListPtr PresentationAdapter::GetReviewList(const ACDB_marker
                                                                const int aPageNumber,
                                                                const int aPageSize,
                                                                const std::string& aCaptainName) {
+  ACDB_TRACE_SPAN("PresentationAdapter::GetReviewList");
   Presentation::ReviewListPtr reviewList = nullptr;
 
   std::vector<ReviewTableDataType> reviewTableData;
@@ -480,6 +575,7 @@ Presentation::ServicesPtr PresentationAdapter::GetServices(const ACDB_marker_idx
 //!
 //----------------------------------------------------------------
 std::string PresentationAdapter::GetTemplate(const std::string& aName) {
+  ACDB_TRACE_SPAN("PresentationAdapter::GetTemplate");
   std::string result;
 
   mMustacheTemplate.Get(aName, result);
@@ -43,23 +43,62 @@ TranslationAdapter::TranslationAdapter(SQLite::Database& aDatabase)
 
 //----------------------------------------------------------------
 //!
-//!       @private
-//!       @brief Read all of the stored translations
+//!       @public
+//!       @brief Read the stored translations for a language,
+//!              falling back to English if it has none
+//!
+//!       @returns false if the translations could not be read
 //!
 //----------------------------------------------------------------
-void TranslationAdapter::InitTextTranslator(const std::string& aLanguage) {
-  std::vector<TranslationDataType> results;
-  bool success = mTranslator.Get(aLanguage, results);
-  if (success && results.size() == 0) {
+bool TranslationAdapter::GetTranslations(const std::string& aLanguage,
+                                         std::vector<TranslationDataType>& aTranslationsOut) {
+  bool success = mTranslator.Get(aLanguage, aTranslationsOut);
+
+  if (success && aTranslationsOut.size() == 0) {
     // we fallback to English if the requested language does not exist
-    success = mTranslator.Get(DefaultLanguage, results);
+    success = mTranslator.Get(DefaultLanguage, aTranslationsOut);
   }
 
-  TextTranslator::GetInstance().Clear();
-  if (success) {
-    for (auto item : results) {
-      TextTranslator::GetInstance().Insert(item.first, std::move(item.second));
-    }
+  if (!success) {
+    aTranslationsOut.clear();
   }
+
+  return success;
+}  // end of GetTranslations
+
+//----------------------------------------------------------------
+//!
+//!       @private
+//!       @brief Read all of the stored translations
+//!
+//----------------------------------------------------------------
+void TranslationAdapter::InitTextTranslator(const std::string& aLanguage) {
+  TextTranslator::GetInstance().Publish(LoadTextTable(aLanguage));
 }  // end of InitTextTranslator
+
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief Read the stored translations for a language so
+//!              that switching to it later needs no database access
+//!
+//----------------------------------------------------------------
+void TranslationAdapter::PreloadTextTranslator(const std::string& aLanguage) {
+  TextTranslator::GetInstance().Preload(aLanguage, LoadTextTable(aLanguage));
+}  // end of PreloadTextTranslator
+
+//----------------------------------------------------------------
+//!
+//!       @private
+//!       @brief Build a translation table for a language
+//!
+//!       @returns table of translations, empty if none could be read
+//!
+//----------------------------------------------------------------
+TextTranslator::TablePtr TranslationAdapter::LoadTextTable(const std::string& aLanguage) {
+  std::vector<TranslationDataType> results;
+  GetTranslations(aLanguage, results);
+
+  return TextTranslator::TablePtr(new TextTranslator::Table(std::move(results)));
+}  // end of LoadTextTable
 }  // end of namespace Acdb
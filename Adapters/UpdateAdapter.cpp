@@ -48,9 +48,11 @@ UpdateAdapter::UpdateAdapter(SQLite::Database& aDatabase)
       mFuel{aDatabase},
       mLanguage{aDatabase},
       mMarker{aDatabase},
+      mMarkerAttribute{aDatabase},
       mMarkerMeta{aDatabase},
       mMoorings{aDatabase},
       mMustacheTemplate{aDatabase},
+      mNameSearch{aDatabase},
       mNavigation{aDatabase},
       mPosition{aDatabase},
       mRetail{aDatabase},
@@ -74,6 +76,8 @@ bool UpdateAdapter::DeleteTile(const TileXY& aTileXY) {
   success = success && mTiles.Get(aTileXY.mX, aTileXY.mY, tileTableData);
 
   success = success && mMarkerMeta.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
+  success =
+      success && mMarkerAttribute.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
   success = success && mAddress.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
   success = success && mAmenities.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
   success = success && mBusiness.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
@@ -86,6 +90,7 @@ bool UpdateAdapter::DeleteTile(const TileXY& aTileXY) {
   success = success && mDockage.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
   success = success && mFuel.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
   success = success && mMoorings.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
+  success = success && mNameSearch.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
   success = success && mNavigation.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
   success = success && mPosition.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
   success = success && mRetail.Delete(tileTableData.mGeohashStart, tileTableData.mGeohashEnd);
@@ -141,9 +146,12 @@ bool UpdateAdapter::DeleteTileReviews(const TileXY& aTileXY) {
 //!
 //!       @public
 //!       @brief apply marker updates to database
+//!       @detail The markers are consumed: each section is moved
+//!               into the query writing it, which binds its
+//!               strings without copying them.
 //!
 //----------------------------------------------------------------
-bool UpdateAdapter::UpdateMarkers(std::vector<MarkerTableDataCollection>& aMarkers,
+bool UpdateAdapter::UpdateMarkers(std::vector<MarkerTableDataCollection>&& aMarkers,
                                   uint64_t& aLastUpdateMax_out) {
   bool success{true};
 
@@ -166,8 +174,10 @@ bool UpdateAdapter::UpdateMarkers(std::vector<MarkerTableDataCollection>& aMarke
       success = success && mContact.Delete(id);
       success = success && mDockage.Delete(id);
       success = success && mFuel.Delete(id);
+      success = success && mMarkerAttribute.Delete(id);
       success = success && mMarkerMeta.Delete(id);
       success = success && mMoorings.Delete(id);
+      success = success && mNameSearch.Delete(id);
       success = success && mPosition.Delete(id);
       success = success && mNavigation.Delete(id);
       success = success && mRetail.Delete(id);
@@ -176,34 +186,33 @@ bool UpdateAdapter::UpdateMarkers(std::vector<MarkerTableDataCollection>& aMarke
       success = success && mServices.Delete(id);
       success = success && mMarker.Delete(id);  // MUST BE LAST.
     } else {
-      // Save these since we call std::move on marker.Marker.
-      std::string name = marker.mMarker.mName;
-      scposn_type posn = marker.mMarker.mPosn;
+      // Written before marker.mMarker is moved into its query.
+      success = success && mNameSearch.Write(id, marker.mMarker.mName);
+      success = success && mPosition.Write(id, marker.mMarker.mPosn);
 
-      success = success && mMarker.Write(id, std::move(marker.mMarker));
-      success = success && mPosition.Write(id, posn);
-      success = success && mMarkerMeta.Write(id, std::move(marker.mMarkerMeta));
+      success = success && mMarker.Write(id, marker.mMarker);
+      success = success && mMarkerMeta.Write(id, marker.mMarkerMeta);
       if (marker.mAddress) {
-        success = success && mAddress.Write(id, std::move(*(marker.mAddress)));
+        success = success && mAddress.Write(id, *(marker.mAddress));
       }
 
       if (marker.mAmenities) {
-        success = success && mAmenities.Write(id, std::move(*(marker.mAmenities)));
+        success = success && mAmenities.Write(id, *(marker.mAmenities));
       }
 
       if (marker.mBusiness) {
-        success = success && mBusiness.Write(id, std::move(*(marker.mBusiness)));
+        success = success && mBusiness.Write(id, *(marker.mBusiness));
       }
 
       // Always need to call Delete to ensure any all old photos are deleted.  If updated marker has
       // photos, marker.BusinessPhotos will be the complete set.
       success = success && mBusinessPhoto.Delete(id);
-      for (auto businessPhoto : marker.mBusinessPhotos) {
-        success = success && mBusinessPhoto.Write(id, std::move(businessPhoto));
+      for (auto& businessPhoto : marker.mBusinessPhotos) {
+        success = success && mBusinessPhoto.Write(id, businessPhoto);
       }
 
       if (marker.mBusinessProgram) {
-        success = success && mBusinessProgram.Write(id, std::move(*(marker.mBusinessProgram)));
+        success = success && mBusinessProgram.Write(id, *(marker.mBusinessProgram));
       } else {
         success = success && mBusinessProgram.Delete(id);
       }
@@ -211,50 +220,101 @@ bool UpdateAdapter::UpdateMarkers(std::vector<MarkerTableDataCollection>& aMarke
       // Always need to call Delete to ensure any all old competitors are deleted.  If updated
       // marker has competitors, marker.Competitors will be the complete set.
       success = success && mCompetitor.Delete(id);
-      for (auto competitor : marker.mCompetitors) {
-        success = success && mCompetitor.Write(id, std::move(competitor));
+      for (auto& competitor : marker.mCompetitors) {
+        success = success && mCompetitor.Write(id, competitor);
       }
 
       if (marker.mContact) {
-        success = success && mContact.Write(id, std::move(*(marker.mContact)));
+        success = success && mContact.Write(id, *(marker.mContact));
       }
 
       if (marker.mDockage) {
-        success = success && mDockage.Write(id, std::move(*(marker.mDockage)));
+        success = success && mDockage.Write(id, *(marker.mDockage));
       }
 
       if (marker.mFuel) {
-        success = success && mFuel.Write(id, std::move(*(marker.mFuel)));
+        success = success && mFuel.Write(id, *(marker.mFuel));
       }
 
       if (marker.mMoorings) {
-        success = success && mMoorings.Write(id, std::move(*(marker.mMoorings)));
+        success = success && mMoorings.Write(id, *(marker.mMoorings));
       }
 
       if (marker.mNavigation) {
-        success = success && mNavigation.Write(id, std::move(*(marker.mNavigation)));
+        success = success && mNavigation.Write(id, *(marker.mNavigation));
       }
 
       if (marker.mRetail) {
-        success = success && mRetail.Write(id, std::move(*(marker.mRetail)));
+        success = success && mRetail.Write(id, *(marker.mRetail));
       }
 
       if (marker.mServices) {
-        success = success && mServices.Write(id, std::move(*(marker.mServices)));
+        success = success && mServices.Write(id, *(marker.mServices));
       }
+
+      // Computed from the sections written above.
+      success = success && mMarkerAttribute.Write(id);
     }
   }
 
   return success;
 }  // end of UpdateMarkers
 
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief check whether the search attribute index and the
+//!              fuzzy name search data have been built, without
+//!              reading the database
+//!
+//----------------------------------------------------------------
+bool UpdateAdapter::IsSearchDataComplete() const {
+  return mMarkerAttribute.IsComplete() && mNameSearch.IsComplete();
+}  // end of IsSearchDataComplete
+
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief build the search attribute index if it has not
+//!              been built, e.g. in a database installed by an
+//!              older version
+//!
+//----------------------------------------------------------------
+bool UpdateAdapter::UpdateMarkerAttributes() {
+  if (mMarkerAttribute.IsComplete()) {
+    return true;
+  }
+
+  DBG_I("Rebuilding marker attribute index.");
+  return mMarkerAttribute.Rebuild();
+}  // end of UpdateMarkerAttributes
+
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief build the fuzzy name search data if it has not
+//!              been built, e.g. in a database installed by an
+//!              older version
+//!
+//----------------------------------------------------------------
+bool UpdateAdapter::UpdateNameSearch() {
+  if (mNameSearch.IsComplete()) {
+    return true;
+  }
+
+  DBG_I("Rebuilding name search data.");
+  return mNameSearch.Rebuild();
+}  // end of UpdateNameSearch
+
 //----------------------------------------------------------------
 //!
 //!       @public
 //!       @brief apply review updates to database
+//!       @detail The reviews are consumed, like the markers of
+//!               UpdateMarkers.
 //!
 //----------------------------------------------------------------
-bool UpdateAdapter::UpdateReviews(std::vector<ReviewTableDataCollection>& aReviews,
+bool UpdateAdapter::UpdateReviews(std::vector<ReviewTableDataCollection>&& aReviews,
                                   uint64_t& aLastUpdateMax_out) {
   bool success{true};
 
@@ -271,14 +331,14 @@ bool UpdateAdapter::UpdateReviews(std::vector<ReviewTableDataCollection>& aRevie
       success = success && mReviewPhoto.Delete(id);  // MUST BE DELETED BEFORE REVIEWS
       success = success && mReview.Delete(id);
     } else {
-      success = success && mReview.Write(id, std::move(review.mReview));
+      success = success && mReview.Write(id, review.mReview);
 
       // Always need to call Delete to ensure any all old photos are deleted.  If updated
       // review has photos, review.mReviewPhotos will be the complete set.
       success = success && mReviewPhoto.Delete(id);
 
-      for (auto reviewPhoto : review.mReviewPhotos) {
-        success = success && mReviewPhoto.Write(id, std::move(reviewPhoto));
+      for (auto& reviewPhoto : review.mReviewPhotos) {
+        success = success && mReviewPhoto.Write(id, reviewPhoto);
       }
     }
   }
@@ -293,21 +353,21 @@ bool UpdateAdapter::UpdateReviews(std::vector<ReviewTableDataCollection>& aRevie
 //!
 //----------------------------------------------------------------
 bool UpdateAdapter::UpdateSupportTables(
-    std::vector<LanguageTableDataType>& aLanguages,
-    std::vector<MustacheTemplateTableDataType>& aMustacheTemplates,
-    std::vector<TranslationTableDataType>& aTranslations) {
+    std::vector<LanguageTableDataType>&& aLanguages,
+    std::vector<MustacheTemplateTableDataType>&& aMustacheTemplates,
+    std::vector<TranslationTableDataType>&& aTranslations) {
   bool success{true};
 
   for (auto& language : aLanguages) {
-    success = success && mLanguage.Write(std::move(language));
+    success = success && mLanguage.Write(language);
   }
 
   for (auto& mustacheTemplate : aMustacheTemplates) {
-    success = success && mMustacheTemplate.Write(std::move(mustacheTemplate));
+    success = success && mMustacheTemplate.Write(mustacheTemplate);
   }
 
   for (auto& translation : aTranslations) {
-    success = success && mTranslator.Write(std::move(translation));
+    success = success && mTranslator.Write(translation);
   }
 
   return success;
@@ -0,0 +1,176 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Map markers read in bulk, stored column by column.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "MapMarkerColumns"
+
+#include "DBG_pub.h"
+#include "Acdb/MapMarkerColumns.hpp"
+#include "Acdb/MarkerFactory.hpp"
+
+namespace Acdb {
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Constructor
+//!
+//----------------------------------------------------------------
+MapMarkerColumns::MapMarkerColumns()
+    : mIds(),
+      mTypes(),
+      mLastUpdated(),
+      mPositions(),
+      mMapIcons(),
+      mNameOffsets(),
+      mNames() {}  // end of MapMarkerColumns
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Append a marker; aName need not be null-terminated.
+//!   The map icon is resolved from the type and program tier
+//!   here, once, rather than on each access.
+//!
+//----------------------------------------------------------------
+void MapMarkerColumns::Add(const ACDB_marker_idx_type aId, const ACDB_type_type aType,
+                           const uint64_t aLastUpdated, const char* aName,
+                           const size_t aNameLength, const scposn_type& aPosition,
+                           const int aBusinessProgramTier) {
+  Add(aId, aType, aLastUpdated, aName, aNameLength, aPosition,
+      GetMapIcon(aType, aBusinessProgramTier));
+}  // end of Add
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Append a marker whose map icon is already resolved,
+//!   e.g. one read back from a marker snapshot.
+//!
+//----------------------------------------------------------------
+void MapMarkerColumns::Add(const ACDB_marker_idx_type aId, const ACDB_type_type aType,
+                           const uint64_t aLastUpdated, const char* aName,
+                           const size_t aNameLength, const scposn_type& aPosition,
+                           const MapIconType aMapIcon) {
+  mIds.push_back(aId);
+  mTypes.push_back(aType);
+  mLastUpdated.push_back(aLastUpdated);
+  mPositions.push_back(aPosition);
+  mMapIcons.push_back(aMapIcon);
+
+  mNameOffsets.push_back(static_cast<uint32_t>(mNames.size()));
+  mNames.append(aName, aNameLength);
+  mNames.push_back('\0');
+}  // end of Add
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Remove every marker, keeping the allocated capacity
+//!   for the next read.
+//!
+//----------------------------------------------------------------
+void MapMarkerColumns::Clear() {
+  mIds.clear();
+  mTypes.clear();
+  mLastUpdated.clear();
+  mPositions.clear();
+  mMapIcons.clear();
+  mNameOffsets.clear();
+  mNames.clear();
+}  // end of Clear
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return true if there are no markers
+//!
+//----------------------------------------------------------------
+bool MapMarkerColumns::Empty() const { return mIds.empty(); }  // end of Empty
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Allocate room for aCount markers whose names take
+//!   aNameBytes in total.
+//!
+//----------------------------------------------------------------
+void MapMarkerColumns::Reserve(const size_t aCount, const size_t aNameBytes) {
+  mIds.reserve(aCount);
+  mTypes.reserve(aCount);
+  mLastUpdated.reserve(aCount);
+  mPositions.reserve(aCount);
+  mMapIcons.reserve(aCount);
+  mNameOffsets.reserve(aCount);
+  mNames.reserve(aNameBytes + aCount);
+}  // end of Reserve
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return number of markers
+//!
+//----------------------------------------------------------------
+size_t MapMarkerColumns::Size() const { return mIds.size(); }  // end of Size
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return the marker at aIndex
+//!
+//----------------------------------------------------------------
+MapMarkerColumns::Row MapMarkerColumns::operator[](const size_t aIndex) const {
+  DBG_ASSERT(aIndex < mIds.size(), "Map marker column index out of range.");
+  return Row(*this, aIndex);
+}  // end of operator[]
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return iterator to the first marker
+//!
+//----------------------------------------------------------------
+MapMarkerColumns::const_iterator MapMarkerColumns::begin() const {
+  return const_iterator(*this, 0);
+}  // end of begin
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return iterator past the last marker
+//!
+//----------------------------------------------------------------
+MapMarkerColumns::const_iterator MapMarkerColumns::end() const {
+  return const_iterator(*this, mIds.size());
+}  // end of end
+
+}  // end of namespace Acdb
@@ -37,31 +37,38 @@ namespace Acdb {
 //!
 //!   @public
 //!   @brief Constructor
+//!   @detail aPooledLocalizedType must outlive the marker, like the
+//!   strings of the StringPool and of TextTranslator::Lookup().
 //!
 //----------------------------------------------------------------
 SearchMarker::SearchMarker(const ACDB_marker_idx_type aId, const ACDB_type_type aType,
                            const uint64_t aLastUpdated, std::string&& aName, const int32_t aLat,
                            const int32_t aLon, const MapIconType aMapIcon,
-                           std::string&& aLocalizedType)
+                           const std::string* aPooledLocalizedType)
     : mBaseMarker(aId, aType, aLastUpdated, std::move(aName), aLat, aLon, aMapIcon),
-      mLocalizedType(std::move(aLocalizedType)) {}  // end of SearchMarker::SearchMarker
+      mLocalizedType(aPooledLocalizedType) {
+}  // end of SearchMarker::SearchMarker
 
 //----------------------------------------------------------------
 //!
 //!   @public
 //!   @brief Constructor
+//!   @detail aPooledLocalizedType must outlive the marker, like the
+//!   strings of the StringPool and of TextTranslator::Lookup().
 //!
 //----------------------------------------------------------------
 SearchMarker::SearchMarker(const ACDB_marker_idx_type aId, const ACDB_type_type aType,
                            const uint64_t aLastUpdated, std::string&& aName, const int32_t aLat,
                            const int32_t aLon, const MapIconType aMapIcon,
                            ContactData&& aContactData, FuelData&& aFuelData,
-                           ReviewStatsData&& aReviewStatsData, std::string&& aLocalizedType)
+                           ReviewStatsData&& aReviewStatsData,
+                           const std::string* aPooledLocalizedType)
     : mBaseMarker(aId, aType, aLastUpdated, std::move(aName), aLat, aLon, aMapIcon),
       mContactData(std::move(aContactData)),
       mFuelData(std::move(aFuelData)),
       mReviewStatsData(std::move(aReviewStatsData)),
-      mLocalizedType(std::move(aLocalizedType)) {}  // end of SearchMarker::SearchMarker
+      mLocalizedType(aPooledLocalizedType) {
+}  // end of SearchMarker::SearchMarker
 
 //----------------------------------------------------------------
 //!
@@ -147,7 +154,7 @@ std::string SearchMarker::ToString() const {
 //!  @return the marker's type as localized string
 //!
 //----------------------------------------------------------------
-std::string SearchMarker::GetLocalizedType() const { return mLocalizedType; }
+std::string SearchMarker::GetLocalizedType() const { return *mLocalizedType; }
 
 //----------------------------------------------------------------
 //!
@@ -111,6 +111,16 @@ uint64_t SearchMarkerFilter::GetAllowedCategories() const {
   }
 }  // end of SearchMarkerFilter::GetCategory()
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return attributes that every marker found must have
+//!
+//----------------------------------------------------------------
+uint64_t SearchMarkerFilter::GetRequiredAttributes() const { return mRequiredAttributesBitmask; }
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -139,6 +149,16 @@ void SearchMarkerFilter::AddCategory(MarkerCategory aCategory) {
   mCategoriesBitmask |= static_cast<uint64_t>(aCategory);
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief add another attribute that markers must have
+//!
+//----------------------------------------------------------------
+void SearchMarkerFilter::AddRequiredAttribute(MarkerAttribute aAttribute) {
+  mRequiredAttributesBitmask |= static_cast<uint64_t>(aAttribute);
+}
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -167,4 +187,78 @@ int32_t SearchMarkerFilter::GetMaxResults() const { return mMaxResults; }
 //----------------------------------------------------------------
 void SearchMarkerFilter::SetMaxResults(const int32_t aMaxResults) { mMaxResults = aMaxResults; }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return result sort order
+//!
+//----------------------------------------------------------------
+SearchMarkerFilter::SortOrder SearchMarkerFilter::GetSortOrder() const { return mSortOrder; }
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return position that SortByDistance measures from
+//!
+//----------------------------------------------------------------
+const scposn_type& SearchMarkerFilter::GetReferencePoint() const { return mReferencePoint; }
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief set the filter's result sort order
+//!
+//----------------------------------------------------------------
+void SearchMarkerFilter::SetSortOrder(SortOrder aSortOrder) { mSortOrder = aSortOrder; }
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief set the position that SortByDistance measures from
+//!
+//----------------------------------------------------------------
+void SearchMarkerFilter::SetReferencePoint(const scposn_type& aReferencePoint) {
+  mReferencePoint = aReferencePoint;
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return true if results start after the marker in aIdOut
+//!
+//----------------------------------------------------------------
+bool SearchMarkerFilter::GetStartAfter(ACDB_marker_idx_type& aIdOut) const {
+  aIdOut = mStartAfterId;
+  return mHasStartAfter;
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief return only the sorted results after the specified
+//!   marker
+//!
+//----------------------------------------------------------------
+void SearchMarkerFilter::SetStartAfter(const ACDB_marker_idx_type aLastResultId) {
+  mHasStartAfter = true;
+  mStartAfterId = aLastResultId;
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief return sorted results from the first one
+//!
+//----------------------------------------------------------------
+void SearchMarkerFilter::ClearStartAfter() {
+  mHasStartAfter = false;
+  mStartAfterId = 0;
+}
+
 }  // end of namespace Acdb
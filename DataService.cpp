@@ -33,10 +33,13 @@ limitations under the License.
 #include "Acdb/DataService.hpp"
 #include "Acdb/MapMarker.hpp"
 #include "Acdb/MapMarkerFilter.hpp"
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/SearchMarkerFilter.hpp"
+#include "Acdb/SearchSession.hpp"
 #include "Acdb/Presentation/MustacheViewFactory.hpp"
 #include "Acdb/Presentation/PresentationMarker.hpp"
 #include "Acdb/Repository.hpp"
+#include "Acdb/TraceSpan.hpp"
 #include "Acdb/PrvTypes.hpp"
 #include "Acdb/PubTypes.hpp"
 #include "GRM_pub.h"
@@ -64,6 +67,18 @@ DataService::DataService(RepositoryPtr aRepositoryPtr, const std::string& aLangu
 //----------------------------------------------------------------
 DataService::~DataService() {}  // end of ~DataService
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!       Create a search session reading from the single system
+//!       repository object.  Use one session per search field.
+//!
+//----------------------------------------------------------------
+ISearchSessionPtr DataService::CreateSearchSession() const {
+  return ISearchSessionPtr{new SearchSession{mRepositoryPtr}};
+}  // end of CreateSearchSession
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -76,6 +91,9 @@ DataService::~DataService() {}  // end of ~DataService
 //!
 //----------------------------------------------------------------
 std::string DataService::GetBusinessPhotoListHtml(const ACDB_marker_idx_type aIdx) const {
+  ACDB_TRACE_SPAN("DataService::GetBusinessPhotoListHtml");
+  MonotonicArena arena;
+  ArenaScope arenaScope{arena};
   std::string html;
 
   auto photoListPtr = mRepositoryPtr->GetBusinessPhotoList(aIdx);
@@ -98,6 +116,9 @@ std::string DataService::GetBusinessPhotoListHtml(const ACDB_marker_idx_type aId
 //!
 //----------------------------------------------------------------
 ContentViewMapPtr DataService::GetContentViewMap(const ACDB_marker_idx_type aIdx) const {
+  ACDB_TRACE_SPAN("DataService::GetContentViewMap");
+  MonotonicArena arena;
+  ArenaScope arenaScope{arena};
   ContentViewMapPtr contentViewMapPtr = nullptr;
 
   auto presentationMarkerPtr = mRepositoryPtr->GetPresentationMarker(aIdx);
@@ -111,6 +132,19 @@ ContentViewMapPtr DataService::GetContentViewMap(const ACDB_marker_idx_type aIdx
   return contentViewMapPtr;
 }  // end of GetContentViewMap
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!       Wraps the GetLockStats call from the Repository member
+//!       object to provide a public access point for the single
+//!       system repository object.
+//!
+//----------------------------------------------------------------
+LockPerformanceStats DataService::GetLockStats() const {
+  return mRepositoryPtr->GetLockStats();
+}  // end of GetLockStats
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -133,13 +167,72 @@ IMapMarkerPtr DataService::GetMapMarker(const ACDB_marker_idx_type aIdx) const {
 //!       Wraps the GetMapMarkers call from the Repository member
 //!       object to provide a public access point for the single
 //!       system repository object.
+//!   @return
+//!       false if aQueryControl stopped the read early, in which
+//!       case the results are partial.
 //!
 //----------------------------------------------------------------
-void DataService::GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
-                                        std::vector<IMapMarkerPtr>& aResults) const {
-  mRepositoryPtr->GetMapMarkersByFilter(aFilter, aResults);
+bool DataService::GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
+                                        std::vector<IMapMarkerPtr>& aResults,
+                                        const QueryControl* aQueryControl) const {
+  ACDB_TRACE_SPAN("DataService::GetMapMarkersByFilter");
+  return mRepositoryPtr->GetMapMarkersByFilter(aFilter, aResults, aQueryControl);
 }  // end of GetMapMarkers
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!       Wraps the GetMapMarkers call from the Repository member
+//!       object to provide a public access point for the single
+//!       system repository object.  Fills columns rather than
+//!       one object per marker.
+//!   @return
+//!       false if aQueryControl stopped the read early, in which
+//!       case the results are partial.
+//!
+//----------------------------------------------------------------
+bool DataService::GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
+                                        MapMarkerColumns& aResults,
+                                        const QueryControl* aQueryControl) const {
+  ACDB_TRACE_SPAN("DataService::GetMapMarkersByFilter");
+  return mRepositoryPtr->GetMapMarkersByFilter(aFilter, aResults, aQueryControl);
+}  // end of GetMapMarkersByFilter
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!       Wraps the GetMapMarkersByFilters call from the Repository member
+//!       object to provide a public access point for the single
+//!       system repository object.
+//!   @return
+//!       false if aQueryControl stopped the read early, in which
+//!       case the results are partial.
+//!
+//----------------------------------------------------------------
+bool DataService::GetMapMarkersByFilters(const std::vector<MapMarkerFilter>& aFilters,
+                                         std::vector<IMapMarkerPtr>& aResults,
+                                         std::vector<std::vector<size_t>>& aResultIndexes,
+                                         const QueryControl* aQueryControl) const {
+  ACDB_TRACE_SPAN("DataService::GetMapMarkersByFilters");
+  return mRepositoryPtr->GetMapMarkersByFilters(aFilters, aResults, aResultIndexes,
+                                                aQueryControl);
+}  // end of GetMapMarkersByFilters
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!       Wraps the GetPerformanceStats call from the Repository member
+//!       object to provide a public access point for the single
+//!       system repository object.
+//!
+//----------------------------------------------------------------
+PerformanceStats DataService::GetPerformanceStats() const {
+  return mRepositoryPtr->GetPerformanceStats();
+}  // end of GetPerformanceStats
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -153,6 +246,9 @@ void DataService::GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
 //----------------------------------------------------------------
 std::string DataService::GetPresentationMarkerHtml(const ACDB_marker_idx_type aIdx,
                                                    const std::string& aCaptainName) const {
+  ACDB_TRACE_SPAN("DataService::GetPresentationMarkerHtml");
+  MonotonicArena arena;
+  ArenaScope arenaScope{arena};
   std::string html;
 
   auto presentationMarkerPtr = mRepositoryPtr->GetPresentationMarker(aIdx, aCaptainName);
@@ -177,6 +273,9 @@ std::string DataService::GetPresentationMarkerHtml(const ACDB_marker_idx_type aI
 std::string DataService::GetReviewListHtml(const ACDB_marker_idx_type aIdx, const int aPageNumber,
                                            const int aPageSize,
                                            const std::string& aCaptainName) const {
+  ACDB_TRACE_SPAN("DataService::GetReviewListHtml");
+  MonotonicArena arena;
+  ArenaScope arenaScope{arena};
   std::string html;
 
   auto reviewListPtr = mRepositoryPtr->GetReviewList(aIdx, aPageNumber, aPageSize, aCaptainName);
@@ -209,11 +308,16 @@ ISearchMarkerPtr DataService::GetSearchMarker(const ACDB_marker_idx_type aIdx) c
 //!       Wraps the GetBasicSearchMarkersByFilter call from the Repository member
 //!       object to provide a public access point for the single
 //!       system repository object.
+//!   @return
+//!       false if aQueryControl stopped the read early, in which
+//!       case the results are partial.
 //!
 //----------------------------------------------------------------
-void DataService::GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                                std::vector<ISearchMarkerPtr>& aResults) const {
-  mRepositoryPtr->GetBasicSearchMarkersByFilter(aFilter, aResults);
+bool DataService::GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                                std::vector<ISearchMarkerPtr>& aResults,
+                                                const QueryControl* aQueryControl) const {
+  ACDB_TRACE_SPAN("DataService::GetBasicSearchMarkersByFilter");
+  return mRepositoryPtr->GetBasicSearchMarkersByFilter(aFilter, aResults, aQueryControl);
 }  // end of GetBasicSearchMarkersByFilter
 
 //----------------------------------------------------------------
@@ -223,13 +327,61 @@ void DataService::GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilte
 //!       Wraps the GetSearchMarkersByFilter call from the Repository member
 //!       object to provide a public access point for the single
 //!       system repository object.
+//!   @return
+//!       false if aQueryControl stopped the read early, in which
+//!       case the results are partial.
 //!
 //----------------------------------------------------------------
-void DataService::GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                           std::vector<ISearchMarkerPtr>& aResults) const {
-  mRepositoryPtr->GetSearchMarkersByFilter(aFilter, aResults);
+bool DataService::GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                           std::vector<ISearchMarkerPtr>& aResults,
+                                           const QueryControl* aQueryControl) const {
+  ACDB_TRACE_SPAN("DataService::GetSearchMarkersByFilter");
+  return mRepositoryPtr->GetSearchMarkersByFilter(aFilter, aResults, aQueryControl);
 }  // end of GetSearchMarkersByFilter
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!       Wraps the GetNearestSearchMarkers call from the Repository member
+//!       object to provide a public access point for the single
+//!       system repository object.
+//!   @return
+//!       false if aQueryControl stopped the read early, in which
+//!       case the results are partial.
+//!
+//----------------------------------------------------------------
+bool DataService::GetNearestSearchMarkers(const scposn_type& aPosition, const uint32_t aCount,
+                                          const SearchMarkerFilter& aFilter,
+                                          std::vector<SearchMarkerDistancePair>& aResults,
+                                          const QueryControl* aQueryControl) const {
+  ACDB_TRACE_SPAN("DataService::GetNearestSearchMarkers");
+  return mRepositoryPtr->GetNearestSearchMarkers(aPosition, aCount, aFilter, aResults,
+                                                 aQueryControl);
+}  // end of GetNearestSearchMarkers
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!       Wraps the GetSearchMarkersAlongRoute call from the Repository member
+//!       object to provide a public access point for the single
+//!       system repository object.
+//!   @return
+//!       false if aQueryControl stopped the read early, in which
+//!       case the results are partial.
+//!
+//----------------------------------------------------------------
+bool DataService::GetSearchMarkersAlongRoute(const std::vector<scposn_type>& aRoute,
+                                             const double aBufferMeters,
+                                             const SearchMarkerFilter& aFilter,
+                                             const RouteSearchCallback& aCallback,
+                                             const QueryControl* aQueryControl) const {
+  ACDB_TRACE_SPAN("DataService::GetSearchMarkersAlongRoute");
+  return mRepositoryPtr->GetSearchMarkersAlongRoute(aRoute, aBufferMeters, aFilter, aCallback,
+                                                    aQueryControl);
+}  // end of GetSearchMarkersAlongRoute
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -239,9 +391,18 @@ void DataService::GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
 //----------------------------------------------------------------
 std::string DataService::GetSectionPageHtml(const ACDB_marker_idx_type aIdx,
                                             const std::string& aSectionName) const {
+  ACDB_TRACE_SPAN("DataService::GetSectionPageHtml");
+  MonotonicArena arena;
+  ArenaScope arenaScope{arena};
   std::string html;
 
-  auto presentationMarkerPtr = mRepositoryPtr->GetPresentationMarker(aIdx);
+  // Section pages only display one section, so don't load the rest of the marker.
+  SectionType sectionType = Acdb::Presentation::GetSectionPageType(aSectionName);
+  if (sectionType == SectionType::None) {
+    return html;
+  }
+
+  auto presentationMarkerPtr = mRepositoryPtr->GetPresentationMarkerSections(aIdx, sectionType);
   if (presentationMarkerPtr) {
     html = Acdb::Presentation::GetSectionPageHtml(*presentationMarkerPtr, aSectionName,
                                                   mRepositoryPtr);
@@ -261,6 +422,30 @@ float DataService::GetUserReviewAverageStars(const ACDB_marker_idx_type aIdx) co
   return mRepositoryPtr->GetUserReviewAverageStars(aIdx);
 }  // end of GetUserReviewAverageStars
 
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @brief
+//!        Load strings for the given languages so SetLanguage() can
+//!        switch to them without reading the database.
+//!
+//----------------------------------------------------------------
+void DataService::PreloadLanguages(const std::vector<std::string>& aLanguageIds) {
+  mRepositoryPtr->PreloadLanguages(aLanguageIds);
+}  // end of PreloadLanguages
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @brief
+//!        Set number of threads used by GetContentViewMap to render
+//!        sections.  1 (the default) renders on the calling thread.
+//!
+//----------------------------------------------------------------
+void DataService::SetContentViewThreadCount(const uint32_t aThreadCount) {
+  Acdb::Presentation::SetContentViewThreadCount(aThreadCount);
+}  // end of SetContentViewThreadCount
+
 //----------------------------------------------------------------
 //!
 //!    @public
@@ -294,4 +479,29 @@ void DataService::SetLanguage(const std::string& aLanguageId) {
   mRepositoryPtr->SetLanguage(aLanguageId);
 }  // end of SetLanguage
 
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @brief
+//!        Start or stop recording the stats returned by
+//!        GetPerformanceStats.
+//!
+//----------------------------------------------------------------
+void DataService::SetPerformanceStatsEnabled(const bool aEnabled) {
+  mRepositoryPtr->SetPerformanceStatsEnabled(aEnabled);
+}  // end of SetPerformanceStatsEnabled
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @brief
+//!        Report the holders of the repository lock keeping it
+//!        for at least aThresholdMilliseconds to aCallback.
+//!
+//----------------------------------------------------------------
+void DataService::SetSlowLockHolderCallback(const uint32_t aThresholdMilliseconds,
+                                            SlowLockHolderCallback aCallback) {
+  mRepositoryPtr->SetSlowLockHolderCallback(aThresholdMilliseconds, std::move(aCallback));
+}  // end of SetSlowLockHolderCallback
+
 }  // end of namespace Acdb
@@ -0,0 +1,280 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Geographic helper functions for positions in semicircles.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include "Acdb/GeoUtil.hpp"
+
+namespace Acdb {
+namespace Geo {
+
+static const double Pi = 3.14159265358979323846;
+static const double SemiToRad = Pi / 2147483648.0;
+static const double RadToSemi = 2147483648.0 / Pi;
+//! Below this, the sine of the angle between two points is too small to divide by
+static const double MinSinAngularDistance = 1e-9;
+
+static double GetInitialBearing(const scposn_type& aFrom, const scposn_type& aTo);
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the smallest bounding box containing every point
+//!           within aRadiusMeters of aCenter.  The box crosses the
+//!           antimeridian (swc.lon > nec.lon) when the circle does.
+//!
+//!   @param aCoversWorldOut set if the box spans every longitude
+//!          and latitude, i.e. growing the radius cannot find more
+//!   @return bounding box, in semicircles
+//!
+//----------------------------------------------------------------
+bbox_type GetBoundingBox(const scposn_type& aCenter, const double aRadiusMeters,
+                         bool& aCoversWorldOut) {
+  const double angularRadius = aRadiusMeters / EarthRadiusMeters;
+  const double lat = aCenter.lat * SemiToRad;
+
+  const double minLat = lat - angularRadius;
+  const double maxLat = lat + angularRadius;
+
+  bbox_type result;
+  result.swc.lat = static_cast<int32_t>(std::max(std::floor(minLat * RadToSemi),
+                                                 static_cast<double>(ACDB_MIN_LAT)));
+  result.nec.lat = static_cast<int32_t>(std::min(std::ceil(maxLat * RadToSemi),
+                                                 static_cast<double>(ACDB_MAX_LAT)));
+
+  // If the circle reaches a pole, it spans every longitude.
+  bool allLongitudes = minLat <= -Pi / 2 || maxLat >= Pi / 2;
+  double lonDelta = 0;
+
+  if (!allLongitudes) {
+    const double sinLonDelta = std::sin(angularRadius) / std::cos(lat);
+    allLongitudes = sinLonDelta >= 1.0;
+    lonDelta = allLongitudes ? Pi : std::asin(sinLonDelta);
+  }
+
+  if (allLongitudes) {
+    result.swc.lon = ACDB_MIN_LON;
+    result.nec.lon = ACDB_MAX_LON;
+  } else {
+    // Wrap into [-180, 180) degrees; int64 so the edges cannot overflow before wrapping.
+    const int64_t semicircles = INT64_C(0x100000000);
+    int64_t minLon = static_cast<int64_t>(std::floor(aCenter.lon - lonDelta * RadToSemi));
+    int64_t maxLon = static_cast<int64_t>(std::ceil(aCenter.lon + lonDelta * RadToSemi));
+
+    if (minLon < ACDB_MIN_LON) {
+      minLon += semicircles;
+    }
+
+    if (maxLon > ACDB_MAX_LON) {
+      maxLon -= semicircles;
+    }
+
+    result.swc.lon = static_cast<int32_t>(minLon);
+    result.nec.lon = static_cast<int32_t>(maxLon);
+  }
+
+  aCoversWorldOut = allLongitudes && result.swc.lat == ACDB_MIN_LAT &&
+                    result.nec.lat == ACDB_MAX_LAT;
+
+  return result;
+}  // end of GetBoundingBox()
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @return Great-circle (haversine) distance between two
+//!           positions, in meters
+//!
+//----------------------------------------------------------------
+double GetDistanceMeters(const scposn_type& aFrom, const scposn_type& aTo) {
+  const double fromLat = aFrom.lat * SemiToRad;
+  const double toLat = aTo.lat * SemiToRad;
+
+  // Subtract in int64 to avoid overflow; the haversine is periodic in longitude, so a
+  // difference across the antimeridian needs no wrapping.
+  const double latDelta = (static_cast<int64_t>(aTo.lat) - aFrom.lat) * SemiToRad;
+  const double lonDelta = (static_cast<int64_t>(aTo.lon) - aFrom.lon) * SemiToRad;
+
+  const double sinLat = std::sin(latDelta / 2);
+  const double sinLon = std::sin(lonDelta / 2);
+  const double a = sinLat * sinLat + std::cos(fromLat) * std::cos(toLat) * sinLon * sinLon;
+
+  return 2 * EarthRadiusMeters * std::asin(std::min(1.0, std::sqrt(a)));
+}  // end of GetDistanceMeters()
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Great-circle distance from a point to the closest
+//!           point of the great-circle segment aStart-aEnd.
+//!
+//!   @param aAlongSegmentOut distance, in meters, from aStart to
+//!          the closest point on the segment
+//!   @return distance in meters
+//!
+//----------------------------------------------------------------
+double GetDistanceToSegmentMeters(const scposn_type& aPoint, const scposn_type& aStart,
+                                  const scposn_type& aEnd, double& aAlongSegmentOut) {
+  const double segmentLength = GetDistanceMeters(aStart, aEnd);
+  const double startDistance = GetDistanceMeters(aStart, aPoint);
+
+  aAlongSegmentOut = 0;
+
+  if (segmentLength == 0 || startDistance == 0) {
+    return startDistance;
+  }
+
+  const double bearingDelta = GetInitialBearing(aStart, aPoint) - GetInitialBearing(aStart, aEnd);
+
+  if (std::cos(bearingDelta) > 0) {
+    const double angularStartDistance = startDistance / EarthRadiusMeters;
+    const double crossTrack = std::asin(std::sin(angularStartDistance) * std::sin(bearingDelta));
+    const double alongTrack =
+        std::acos(std::max(-1.0, std::min(1.0, std::cos(angularStartDistance) /
+                                                   std::cos(crossTrack)))) *
+        EarthRadiusMeters;
+
+    if (alongTrack < segmentLength) {
+      aAlongSegmentOut = alongTrack;
+      return std::abs(crossTrack) * EarthRadiusMeters;
+    }
+  }
+
+  // The closest point of the great circle is outside the segment, so an end point is closest.
+  const double endDistance = GetDistanceMeters(aEnd, aPoint);
+  if (endDistance < startDistance) {
+    aAlongSegmentOut = segmentLength;
+    return endDistance;
+  }
+
+  return startDistance;
+}  // end of GetDistanceToSegmentMeters()
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @return Point at aFraction (0-1) of the way along the great
+//!           circle from aStart to aEnd.  Every great circle
+//!           through aStart passes through its antipode, so for
+//!           antipodal end points the one heading North is used.
+//!
+//----------------------------------------------------------------
+scposn_type GetIntermediatePoint(const scposn_type& aStart, const scposn_type& aEnd,
+                                 const double aFraction) {
+  const double angularDistance = GetDistanceMeters(aStart, aEnd) / EarthRadiusMeters;
+  const double sinAngularDistance = std::sin(angularDistance);
+
+  const double startLat = aStart.lat * SemiToRad;
+  const double startLon = aStart.lon * SemiToRad;
+  const double endLat = aEnd.lat * SemiToRad;
+  const double endLon = aEnd.lon * SemiToRad;
+
+  double lat;
+  double lon;
+
+  if (sinAngularDistance < MinSinAngularDistance) {
+    if (angularDistance < Pi / 2) {
+      // The same point, or too close to interpolate; either end point is within millimeters.
+      return (aFraction < 0.5) ? aStart : aEnd;
+    }
+
+    // Antipodal: go aFraction of the distance from aStart with a bearing of 0.
+    const double distance = aFraction * angularDistance;
+    lat = std::asin(std::sin(startLat) * std::cos(distance) +
+                    std::cos(startLat) * std::sin(distance));
+    lon = startLon + std::atan2(0.0, std::cos(distance) - std::sin(startLat) * std::sin(lat));
+    lon = std::remainder(lon, 2 * Pi);
+  } else {
+    const double a = std::sin((1 - aFraction) * angularDistance) / sinAngularDistance;
+    const double b = std::sin(aFraction * angularDistance) / sinAngularDistance;
+
+    const double x = a * std::cos(startLat) * std::cos(startLon) +
+                     b * std::cos(endLat) * std::cos(endLon);
+    const double y = a * std::cos(startLat) * std::sin(startLon) +
+                     b * std::cos(endLat) * std::sin(endLon);
+    const double z = a * std::sin(startLat) + b * std::sin(endLat);
+
+    lat = std::atan2(z, std::sqrt(x * x + y * y));
+    lon = std::atan2(y, x);
+  }
+
+  scposn_type result;
+  result.lat = static_cast<int32_t>(std::round(lat * RadToSemi));
+  result.lon = static_cast<int32_t>(
+      std::max(std::min(std::round(lon * RadToSemi), static_cast<double>(ACDB_MAX_LON)),
+               static_cast<double>(ACDB_MIN_LON)));
+
+  return result;
+}  // end of GetIntermediatePoint()
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Split a bounding box that crosses the antimeridian
+//!           into the parts West and East of it.
+//!
+//!   @return true if the box was split, false if it does not
+//!           cross the antimeridian
+//!
+//----------------------------------------------------------------
+bool SplitCrossMeridianBbox(const bbox_type& aOriginalBbox, bbox_type& aLeftBbox,
+                            bbox_type& aRightBbox) {
+  // Check if the search box crosses the antimeridian.
+  if (aOriginalBbox.swc.lon <= aOriginalBbox.nec.lon) {
+    // Box does not cross the antimeridian.
+    return false;
+  }
+
+  // Box crosses the antimeridian.  Do a split search with two boxes:
+  //     aLeftBbox covers everything West of the antimeridian.
+  //     aRightBbox covers everything East of the antimeridian.
+  aLeftBbox = aOriginalBbox;
+  aLeftBbox.nec.lon = ACDB_MAX_LON;
+
+  aRightBbox = aOriginalBbox;
+  aRightBbox.swc.lon = ACDB_MIN_LON;
+
+  return true;
+}  // end of SplitCrossMeridianBbox()
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @return Initial great-circle bearing from aFrom to aTo, in
+//!           radians clockwise from North
+//!
+//----------------------------------------------------------------
+static double GetInitialBearing(const scposn_type& aFrom, const scposn_type& aTo) {
+  const double fromLat = aFrom.lat * SemiToRad;
+  const double toLat = aTo.lat * SemiToRad;
+  const double lonDelta = (static_cast<int64_t>(aTo.lon) - aFrom.lon) * SemiToRad;
+
+  const double y = std::sin(lonDelta) * std::cos(toLat);
+  const double x = std::cos(fromLat) * std::sin(toLat) -
+                   std::sin(fromLat) * std::cos(toLat) * std::cos(lonDelta);
+
+  return std::atan2(y, x);
+}  // end of GetInitialBearing()
+
+}  // end of namespace Geo
+}  // end of namespace Acdb
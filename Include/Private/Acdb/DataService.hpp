@@ -36,7 +36,9 @@ limitations under the License.
 #include "GRM_pub.h"
 
 namespace Acdb {
+class MapMarkerColumns;
 class MapMarkerFilter;
+class QueryControl;
 class Repository;
 class SearchMarkerFilter;
 
@@ -47,14 +49,28 @@ class DataService : public IDataService {
 
   virtual ~DataService();
 
+  ISearchSessionPtr CreateSearchSession() const override;
+
   std::string GetBusinessPhotoListHtml(const ACDB_marker_idx_type aIdx) const override;
 
   ContentViewMapPtr GetContentViewMap(const ACDB_marker_idx_type aIdx) const override;
 
+  LockPerformanceStats GetLockStats() const override;
+
   IMapMarkerPtr GetMapMarker(const ACDB_marker_idx_type aIdx) const override;
 
-  void GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
-                             std::vector<IMapMarkerPtr>& aResults) const override;
+  bool GetMapMarkersByFilter(const MapMarkerFilter& aFilter, std::vector<IMapMarkerPtr>& aResults,
+                             const QueryControl* aQueryControl = nullptr) const override;
+
+  bool GetMapMarkersByFilter(const MapMarkerFilter& aFilter, MapMarkerColumns& aResults,
+                             const QueryControl* aQueryControl = nullptr) const override;
+
+  bool GetMapMarkersByFilters(const std::vector<MapMarkerFilter>& aFilters,
+                              std::vector<IMapMarkerPtr>& aResults,
+                              std::vector<std::vector<size_t>>& aResultIndexes,
+                              const QueryControl* aQueryControl = nullptr) const override;
+
+  PerformanceStats GetPerformanceStats() const override;
 
   std::string GetPresentationMarkerHtml(
       const ACDB_marker_idx_type aIdx,
@@ -66,23 +82,44 @@ class DataService : public IDataService {
 
   ISearchMarkerPtr GetSearchMarker(const ACDB_marker_idx_type aIdx) const override;
 
-  void GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                     std::vector<ISearchMarkerPtr>& aResults) const override;
+  bool GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                     std::vector<ISearchMarkerPtr>& aResults,
+                                     const QueryControl* aQueryControl = nullptr) const override;
+
+  bool GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                std::vector<ISearchMarkerPtr>& aResults,
+                                const QueryControl* aQueryControl = nullptr) const override;
 
-  void GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                std::vector<ISearchMarkerPtr>& aResults) const override;
+  bool GetNearestSearchMarkers(const scposn_type& aPosition, const uint32_t aCount,
+                               const SearchMarkerFilter& aFilter,
+                               std::vector<SearchMarkerDistancePair>& aResults,
+                               const QueryControl* aQueryControl = nullptr) const override;
+
+  bool GetSearchMarkersAlongRoute(const std::vector<scposn_type>& aRoute,
+                                  const double aBufferMeters, const SearchMarkerFilter& aFilter,
+                                  const RouteSearchCallback& aCallback,
+                                  const QueryControl* aQueryControl = nullptr) const override;
 
   std::string GetSectionPageHtml(const ACDB_marker_idx_type aIdx,
                                  const std::string& aSectionName) const override;
 
   float GetUserReviewAverageStars(const ACDB_marker_idx_type aIdx) const override;
 
+  void PreloadLanguages(const std::vector<std::string>& aLanguageIds) override;
+
+  void SetContentViewThreadCount(const uint32_t aThreadCount) override;
+
   void SetHeadContent(const std::string& aHeadContent) override;
 
   void SetImagePrefix(const std::string& aImagePrefix) override;
 
   void SetLanguage(const std::string& aLanguageId) override;
 
+  void SetPerformanceStatsEnabled(const bool aEnabled) override;
+
+  void SetSlowLockHolderCallback(const uint32_t aThresholdMilliseconds,
+                                 SlowLockHolderCallback aCallback) override;
+
  private:
   // Constants
   static const int ReviewLimit = 10;
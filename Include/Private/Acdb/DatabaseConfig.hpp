@@ -24,15 +24,36 @@ limitations under the License.
 #ifndef ACDB_DatabaseConfig_hpp
 #define ACDB_DatabaseConfig_hpp
 
+#include <cstdint>
 #include <string>
 
+#include "Acdb/SqliteCppUtil.hpp"
+
 namespace Acdb {
 class DatabaseConfig {
  public:
+  //! Devices the SQLite settings are tuned for
+  enum class TuningPreset { LowMemory, Phone, Desktop };
+
+  //! SQLite settings of the open database
+  struct Tuning {
+    int64_t mMmapSize;                           //!< bytes of the file to map; 0 disables mmap
+    int mCacheSizeKib;                           //!< page cache of each connection
+    SqliteCppUtil::TempStore mTempStore;         //!< where sorts and temporary tables go
+    SqliteCppUtil::Synchronous mWalSynchronous;  //!< only used in WAL journal mode
+    int mWalAutoCheckpoint;                      //!< WAL pages before a checkpoint
+    int mAnalysisLimit;                          //!< rows per index analyzed on close; 0 skips
+    int mPageSize;                               //!< page size of a database created empty
+  };
+
   static std::string GetBasePath();
 
   static std::string GetExpandedPath(const std::string& aPath);
 
+  static Tuning GetTuning();
+
+  static Tuning GetTuning(const TuningPreset aPreset);
+
 };  // end of class DatabaseConfig
 
 }  // end of namespace Acdb
@@ -37,10 +37,16 @@ bool Exists(const std::string& aFilePath);
 
 bool GetSize(const std::string& aFilePath, uint64_t& aFileSize);
 
+const char* MapReadOnly(const std::string& aFilePath, uint64_t& aFileSize);
+
 bool Read(const std::string& aFilePath, char* aBuffer, uint32_t aBytesToRead);
 
 bool Rename(const std::string& aOldPath, const std::string& aNewPath);
 
+void Unmap(const char* aData, const uint64_t aFileSize);
+
+bool Write(const std::string& aFilePath, const char* aBuffer, uint32_t aBytesToWrite);
+
 }  // end of namespace FileUtil
 }  // end of namespace Acdb
 
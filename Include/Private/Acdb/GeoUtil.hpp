@@ -0,0 +1,52 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Geographic helper functions for positions in semicircles.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_GeoUtil_hpp
+#define ACDB_GeoUtil_hpp
+
+#include "ACDB_pub_types.h"
+
+namespace Acdb {
+namespace Geo {
+
+//! Mean earth radius, in meters
+static constexpr double EarthRadiusMeters = 6371008.8;
+
+bbox_type GetBoundingBox(const scposn_type& aCenter, const double aRadiusMeters,
+                         bool& aCoversWorldOut);
+
+double GetDistanceMeters(const scposn_type& aFrom, const scposn_type& aTo);
+
+double GetDistanceToSegmentMeters(const scposn_type& aPoint, const scposn_type& aStart,
+                                  const scposn_type& aEnd, double& aAlongSegmentOut);
+
+scposn_type GetIntermediatePoint(const scposn_type& aStart, const scposn_type& aEnd,
+                                 const double aFraction);
+
+bool SplitCrossMeridianBbox(const bbox_type& aOriginalBbox, bbox_type& aLeftBbox,
+                            bbox_type& aRightBbox);
+
+}  // end of namespace Geo
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_GeoUtil_hpp
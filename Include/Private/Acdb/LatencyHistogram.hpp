@@ -0,0 +1,65 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Latency distribution in power-of-two microsecond buckets.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_LatencyHistogram_hpp
+#define ACDB_LatencyHistogram_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Acdb {
+//! Count, total, maximum and approximate percentiles of durations.
+//! Not thread-safe; owners guard it with their own lock.
+class LatencyHistogram {
+ public:
+  // functions
+  LatencyHistogram();
+
+  void Add(const uint64_t aMicroseconds);
+
+  uint64_t GetCount() const;
+
+  uint64_t GetMaxMicroseconds() const;
+
+  uint64_t GetPercentile(const double aFraction) const;
+
+  uint64_t GetTotalMicroseconds() const;
+
+  void Merge(const LatencyHistogram& aOther);
+
+ private:
+  // Constants
+  //! Bucket i counts durations shorter than 2^i microseconds
+  static constexpr size_t BucketCount = 32;
+
+  // Variables
+  uint64_t mCount;
+  uint64_t mTotalMicroseconds;
+  uint64_t mMaxMicroseconds;
+  std::array<uint64_t, BucketCount> mBuckets;
+};  // end of class LatencyHistogram
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_LatencyHistogram_hpp
@@ -0,0 +1,81 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Wait and hold times of the repository lock, by call site.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_LockStatsRegistry_hpp
+#define ACDB_LockStatsRegistry_hpp
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include "Acdb/LatencyHistogram.hpp"
+#include "Acdb/PubTypes.hpp"
+
+namespace Acdb {
+//! Collects the lock acquisitions reported by tagged RwlLockers while
+//! enabled, and reports holders slower than a threshold.
+class LockStatsRegistry {
+ public:
+  // functions
+  LockStatsRegistry();
+
+  LockPerformanceStats GetStats() const;
+
+  bool IsRecording() const;
+
+  void Record(const char* aTag, const bool aExclusive, const uint64_t aWaitMicroseconds,
+              const uint64_t aHoldMicroseconds);
+
+  void SetEnabled(const bool aEnabled);
+
+  void SetSlowHolderCallback(const uint64_t aThresholdMicroseconds,
+                             SlowLockHolderCallback aCallback);
+
+ private:
+  // Types
+  struct Entry {
+    bool mExclusive;
+    LatencyHistogram mWait;
+    LatencyHistogram mHold;
+  };
+
+  // functions
+  LockStatsRegistry(const LockStatsRegistry&) = delete;
+  LockStatsRegistry& operator=(const LockStatsRegistry&) = delete;
+
+  // Variables
+  std::atomic<bool> mEnabled;  //!< whether acquisitions are added to the stats
+  std::atomic<bool> mHasSlowHolderCallback;
+  std::atomic<uint64_t> mSlowHolderThresholdMicroseconds;
+  mutable std::mutex mMutex;  //!< guards the entries and the callback
+  //! By tag address: tags are string literals, so releases skip
+  //! hashing their text.  A tag pooled once per translation unit is
+  //! merged with its copies in GetStats.
+  std::unordered_map<const char*, Entry> mEntries;
+  SlowLockHolderCallback mSlowHolderCallback;
+};  // end of class LockStatsRegistry
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_LockStatsRegistry_hpp
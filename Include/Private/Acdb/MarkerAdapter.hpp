@@ -25,12 +25,15 @@ limitations under the License.
 #ifndef ACDB_MarkerAdapter_hpp
 #define ACDB_MarkerAdapter_hpp
 
+#include <unordered_set>
 #include <vector>
 
 #include "Acdb/Queries/MarkerQuery.hpp"
 #include "Acdb/Queries/SearchMarkerQuery.hpp"
 #include "Acdb/Queries/ReviewSummaryQuery.hpp"
+#include "Acdb/MapMarkerColumns.hpp"
 #include "Acdb/MapMarkerFilter.hpp"
+#include "Acdb/MarkerSnapshot.hpp"
 #include "Acdb/SearchMarkerFilter.hpp"
 #include "Acdb/PrvTypes.hpp"
 #include "Acdb/PubTypes.hpp"
@@ -39,14 +42,31 @@ namespace Acdb {
 
 class MarkerAdapter {
  public:
+  //! Where a route search resumes, so that it can be run one leg at a time
+  struct RouteSearchProgress {
+    RouteSearchProgress() : mNextLeg(0), mRouteOffset(0), mReported() {}
+
+    size_t mNextLeg;
+    double mRouteOffset;  //!< meters from the route start to the start of mNextLeg
+    std::unordered_set<ACDB_marker_idx_type> mReported;
+  };  // end of struct RouteSearchProgress
+
   MarkerAdapter(SQLite::Database& aDatabase);
 
   float GetAverageStars(const ACDB_marker_idx_type aIdx);
 
+  bool GetAllMapMarkers(MapMarkerColumns& aResults);
+
   IMapMarkerPtr GetMapMarker(const ACDB_marker_idx_type aIdx);
 
   void GetMapMarkersByFilter(const MapMarkerFilter& aFilter, std::vector<IMapMarkerPtr>& aResults);
 
+  void GetMapMarkersByFilter(const MapMarkerFilter& aFilter, MapMarkerColumns& aResults);
+
+  void GetMapMarkersByFilters(const std::vector<MapMarkerFilter>& aFilters,
+                              std::vector<IMapMarkerPtr>& aResults,
+                              std::vector<std::vector<size_t>>& aResultIndexes);
+
   ISearchMarkerPtr GetSearchMarker(const ACDB_marker_idx_type aIdx);
 
   void GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
@@ -55,10 +75,38 @@ class MarkerAdapter {
   void GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
                                 std::vector<ISearchMarkerPtr>& aResults);
 
+  void GetNearestSearchMarkers(const scposn_type& aPosition, const uint32_t aCount,
+                               const SearchMarkerFilter& aFilter,
+                               std::vector<SearchMarkerDistancePair>& aResults);
+
+  void GetSearchMarkersAlongRoute(const std::vector<scposn_type>& aRoute,
+                                  const double aBufferMeters, const SearchMarkerFilter& aFilter,
+                                  const RouteSearchCallback& aCallback);
+
+  bool GetSearchMarkersAlongRouteLeg(const std::vector<scposn_type>& aRoute,
+                                     const double aBufferMeters,
+                                     const SearchMarkerFilter& aFilter,
+                                     RouteSearchProgress& aProgress,
+                                     std::vector<RouteSearchMarker>& aResults);
+
+  void GetSearchCandidates(const SearchMarkerFilter& aFilter,
+                           std::vector<MarkerTableDataType>& aResults);
+
+  void SetMarkerSnapshot(const MarkerSnapshot* aSnapshot);
+
  private:
+  // Constants
+  static constexpr double NearestSearchInitialRadius = 9260.0;  //!< 5 nautical miles, in meters
+  static constexpr double RouteSearchMinProbeLength = 5000.0;   //!< meters of route per probe
+
+  // Functions
+  void ReadMapMarkers(const MapMarkerFilter& aFilter, MapMarkerColumns& aResults);
+
+  // Variables
   MarkerQuery mMarker;
   SearchMarkerQuery mSearchMarker;
   ReviewSummaryQuery mReviewSummary;
+  const MarkerSnapshot* mMarkerSnapshot;  //!< serves map marker reads if set
 
 };  // end of class MarkerAdapter
 }  // end of namespace Acdb
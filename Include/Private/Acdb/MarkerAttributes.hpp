@@ -0,0 +1,40 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Marker attributes indexed for search filters.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_MarkerAttributes_hpp
+#define ACDB_MarkerAttributes_hpp
+
+#include <cstdint>
+#include <string>
+
+namespace Acdb {
+namespace MarkerAttributes {
+
+uint64_t GetAttributes(const char* aYesNoJson, const size_t aLength);
+
+uint64_t GetAttributes(const std::string& aYesNoJson);
+
+}  // end of namespace MarkerAttributes
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_MarkerAttributes_hpp
@@ -25,16 +25,21 @@ limitations under the License.
 #define ACDB_MarkerFactory_hpp
 
 #include "Acdb/MapMarker.hpp"
+#include "Acdb/MapMarkerColumns.hpp"
 #include "Acdb/SearchMarker.hpp"
 #include "Acdb/PrvTypes.hpp"
 #include "Acdb/TextHandle.hpp"
 
 namespace Acdb {
 
+MapIconType GetMapIcon(ACDB_type_type aMarkerType, int aBusinessProgramTier);
+
 TextHandle GetMarkerTypeTextHandle(ACDB_type_type aMarkerType);
 
 MapMarkerPtr GetMapMarker(MarkerTableDataType& aMarkerData);
 
+MapMarkerPtr GetMapMarker(const MapMarkerColumns::Row& aMarkerRow);
+
 SearchMarkerPtr GetSearchMarker(MarkerTableDataType& aMarkerData);
 
 SearchMarkerPtr GetSearchMarker(ExtendedMarkerDataType& aMarkerData);
@@ -0,0 +1,102 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+
+/**
+    @file
+    Read-only snapshot of the map markers and of one language's
+    translations, memory-mapped at startup.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_MarkerSnapshot_hpp
+#define ACDB_MarkerSnapshot_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Acdb/MapMarkerColumns.hpp"
+#include "Acdb/MapMarkerFilter.hpp"
+#include "Acdb/PrvTypes.hpp"
+#include "Acdb/Version.hpp"
+
+namespace Acdb {
+//! Sidecar file of the database holding every map marker, sorted
+//! into a grid of cells so a bounding box reads a few contiguous
+//! runs of records, and the translations of the language in use.
+//! It is mapped rather than read, so a cold start serves the first
+//! map query from the page cache instead of from SQLite.  Only
+//! valid for the database version and marker update time it was
+//! written for.
+class MarkerSnapshot {
+ public:
+  // functions
+  ~MarkerSnapshot();
+
+  size_t GetMarkerCount() const;
+
+  void GetMapMarkersByFilter(const MapMarkerFilter& aFilter, MapMarkerColumns& aResults) const;
+
+  bool GetTranslations(const std::string& aLanguage,
+                       std::vector<TranslationDataType>& aTranslationsOut) const;
+
+  static std::unique_ptr<MarkerSnapshot> Open(const std::string& aPath, const Version& aVersion,
+                                              const LastUpdateInfoType& aLastUpdateInfo);
+
+  static bool Write(const std::string& aPath, const Version& aVersion,
+                    const LastUpdateInfoType& aLastUpdateInfo, const MapMarkerColumns& aMarkers,
+                    const std::string& aLanguage,
+                    const std::vector<TranslationDataType>& aTranslations);
+
+ private:
+  // Constants
+  static constexpr uint32_t GridBits = 7;  //!< the grid has 2^GridBits cells per axis
+  static constexpr uint32_t GridSize = 1u << GridBits;
+  static constexpr uint32_t CellCount = GridSize * GridSize;
+
+  // Types
+  struct Header;
+  struct Layout;
+  struct MarkerRecord;
+  struct TranslationRecord;
+
+  // functions
+  MarkerSnapshot(const char* aData, const uint64_t aSize);
+  MarkerSnapshot(const MarkerSnapshot&) = delete;
+  MarkerSnapshot& operator=(const MarkerSnapshot&) = delete;
+
+  static uint32_t GetCell(const int32_t aCoordinate);
+
+  static Layout GetLayout(const Header& aHeader);
+
+  // Variables
+  const char* mData;  //!< the mapped file
+  uint64_t mSize;
+  const Header* mHeader;
+  const uint32_t* mCellOffsets;  //!< first record of each cell, then the record count
+  const MarkerRecord* mMarkers;  //!< sorted by cell
+  const char* mNames;
+  const TranslationRecord* mTranslations;
+  const char* mTranslationText;
+};  // end of class MarkerSnapshot
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_MarkerSnapshot_hpp
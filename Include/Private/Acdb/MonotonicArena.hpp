@@ -0,0 +1,106 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+
+/**
+    @file
+    Monotonic arena for the objects built to serve one request.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_MonotonicArena_hpp
+#define ACDB_MonotonicArena_hpp
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Acdb {
+//! Hands out memory from a few large blocks and frees it all at
+//! once when destroyed.  Not thread-safe; an arena belongs to the
+//! request building on it.  Debug builds assert that no ArenaObject
+//! allocated from the arena is still alive when it is destroyed.
+class MonotonicArena {
+ public:
+  // Constants
+  static constexpr size_t DefaultBlockSize = 16 * 1024;
+
+  // functions
+  explicit MonotonicArena(const size_t aBlockSize = DefaultBlockSize);
+
+  ~MonotonicArena();
+
+  void* Allocate(const size_t aSize);
+
+  size_t GetAllocationCount() const;
+
+  size_t GetBlockCount() const;
+
+  size_t GetBytesAllocated() const;
+
+  size_t GetLiveObjectCount() const;
+
+ private:
+  friend class ArenaObject;
+
+  // functions
+  MonotonicArena(const MonotonicArena&) = delete;
+  MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+  // Variables
+  size_t mBlockSize;
+  std::vector<std::unique_ptr<char[]>> mBlocks;
+  char* mNext;
+  size_t mRemaining;
+  size_t mAllocationCount;
+  size_t mBytesAllocated;
+  size_t mLiveObjectCount;  //!< ArenaObjects allocated and not yet deleted
+};  // end of class MonotonicArena
+
+//! Makes an arena the one ArenaObjects are allocated from on this
+//! thread, until the scope ends.  The arena must outlive every
+//! object allocated from it.
+class ArenaScope {
+ public:
+  // functions
+  explicit ArenaScope(MonotonicArena& aArena);
+  ~ArenaScope();
+
+  static MonotonicArena* GetCurrent();
+
+ private:
+  // functions
+  ArenaScope(const ArenaScope&) = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+
+  // Variables
+  MonotonicArena* mPrevious;
+};  // end of class ArenaScope
+
+//! Base of the classes allocated from the current arena when there
+//! is one, and from the heap otherwise.  Deleting an object runs its
+//! destructor as usual; its arena memory is freed with the arena.
+class ArenaObject {
+ public:
+  // functions
+  static void* operator new(const size_t aSize);
+  static void operator delete(void* aPtr);
+};  // end of class ArenaObject
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_MonotonicArena_hpp
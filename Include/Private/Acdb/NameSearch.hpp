@@ -0,0 +1,51 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Marker name normalization and fuzzy matching.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_NameSearch_hpp
+#define ACDB_NameSearch_hpp
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Acdb {
+namespace NameSearch {
+
+//! Returned by GetMatchDistance when a name does not match
+static constexpr uint32_t NoMatch = UINT32_MAX;
+
+//! Trigrams of a query beyond this count are not used to find candidates
+static constexpr size_t MaxQueryTrigrams = 64;
+
+std::string Normalize(const std::string& aName);
+
+std::vector<int64_t> GetTrigrams(const std::string& aNormalizedName);
+
+uint32_t GetMinSharedTrigrams(const std::string& aNormalizedQuery);
+
+uint32_t GetMatchDistance(const std::string& aNormalizedQuery, const std::string& aNormalizedName);
+
+}  // end of namespace NameSearch
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_NameSearch_hpp
@@ -29,6 +29,7 @@ limitations under the License.
 #include <vector>
 
 #include "ACDB_pub_types.h"
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/BusinessPhotoField.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
 #include "Acdb/PrvTypes.hpp"
@@ -36,7 +37,7 @@ limitations under the License.
 namespace Acdb {
 namespace Presentation {
 //! List of business photos for a marker
-class BusinessPhotoList {
+class BusinessPhotoList : public ArenaObject {
  public:
   // public functions
   BusinessPhotoList(std::string&& aTitle, std::vector<BusinessPhotoField>&& aBusinessPhotos,
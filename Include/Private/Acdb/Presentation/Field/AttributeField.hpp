@@ -26,29 +26,35 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 
 #include <string>
 
+#include "Acdb/MonotonicArena.hpp"
+
 namespace Acdb {
 namespace Presentation {
 
-class AttributeField {
+class AttributeField : public ArenaObject {
  public:
   // functions
-  AttributeField(std::string&& aLabel, std::string&& aValue, std::string&& aNote,
+  AttributeField(const std::string& aLabel, std::string&& aValue, std::string&& aNote,
+                 std::string&& aHyperLink);
+
+  AttributeField(const std::string* aPooledLabel, std::string&& aValue, std::string&& aNote,
                  std::string&& aHyperLink);
 
   bool operator==(const AttributeField& aRhs) const;
 
-  std::string GetHyperLink() const;
+  const std::string& GetHyperLink() const;
 
-  std::string GetLabel() const;
+  const std::string& GetLabel() const;
 
-  std::string GetNote() const;
+  const std::string& GetNote() const;
 
-  std::string GetValue() const;
+  const std::string& GetValue() const;
 
  private:
   // Variables
   std::string mHyperLink;
-  std::string mLabel;
+  const std::string* mLabel;  //!< pooled label, or nullptr for mOwnedLabel
+  std::string mOwnedLabel;
   std::string mNote;
   std::string mValue;
 
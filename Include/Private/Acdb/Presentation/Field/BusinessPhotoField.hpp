@@ -26,10 +26,12 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 
 #include <string>
 
+#include "Acdb/MonotonicArena.hpp"
+
 namespace Acdb {
 namespace Presentation {
 
-class BusinessPhotoField {
+class BusinessPhotoField : public ArenaObject {
  public:
   // functions
   explicit BusinessPhotoField(std::string&& aDownloadUrl);
@@ -26,12 +26,13 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 
 #include <string>
 #include <vector>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/BusinessPromotionField.hpp"
 
 namespace Acdb {
 namespace Presentation {
 
-class BusinessPromotionListField {
+class BusinessPromotionListField : public ArenaObject {
  public:
   // functions
   BusinessPromotionListField(std::string&& aLabel,
@@ -26,10 +26,12 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 
 #include <string>
 
+#include "Acdb/MonotonicArena.hpp"
+
 namespace Acdb {
 namespace Presentation {
 
-class LinkField {
+class LinkField : public ArenaObject {
  public:
   // functions
   explicit LinkField(std::string&& aLinkUrl, std::string&& aLinkText);
@@ -26,10 +26,12 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 
 #include <string>
 
+#include "Acdb/MonotonicArena.hpp"
+
 namespace Acdb {
 namespace Presentation {
 
-class ResponseField {
+class ResponseField : public ArenaObject {
  public:
   // Functions
   ResponseField(std::string&& aTitle, std::string&& aText);
@@ -25,6 +25,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #define ACDB_ReviewField_hpp
 
 #include <vector>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
 #include "Acdb/Presentation/Field/ResponseField.hpp"
 #include "Acdb/Presentation/Field/StringField.hpp"
@@ -33,7 +34,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 namespace Acdb {
 namespace Presentation {
 
-class ReviewField {
+class ReviewField : public ArenaObject {
  public:
   // Functions
   ReviewField(std::string&& aTitle, int aRating, std::string&& aDateVisited,
@@ -25,12 +25,13 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #define ACDB_ReviewSummary_hpp
 
 #include <vector>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/StringField.hpp"
 
 namespace Acdb {
 namespace Presentation {
 
-class ReviewSummary {
+class ReviewSummary : public ArenaObject {
  public:
   // functions
   ReviewSummary() = default;
@@ -33,22 +33,22 @@ namespace Presentation {
 class YesNoUnknownNearbyField {
  public:
   // functions
-  YesNoUnknownNearbyField(std::string&& aLabel, std::string&& aValue, std::string&& aNote,
+  YesNoUnknownNearbyField(const std::string& aLabel, std::string&& aValue, std::string&& aNote,
                           std::string&& aAltText);
 
   bool operator==(const YesNoUnknownNearbyField& aRhs) const;
 
-  std::string GetLabel() const;
+  const std::string& GetLabel() const;
 
-  std::string GetNote() const;
+  const std::string& GetNote() const;
 
-  std::string GetValue() const;
+  const std::string& GetValue() const;
 
-  std::string GetAltText() const;
+  const std::string& GetAltText() const;
 
  private:
   // Variables
-  std::string mLabel;
+  const std::string* mLabel;  //!< interned in the StringPool
   std::string mNote;
   std::string mValue;
   std::string mAltText;
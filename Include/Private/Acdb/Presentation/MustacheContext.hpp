@@ -31,15 +31,20 @@ namespace Acdb {
 class Repository;
 
 namespace Presentation {
+class MustacheTemplateCache;
+
 class MustacheContext : public kainjow::mustache::context<std::string> {
  public:
   MustacheContext(RepositoryPtr aRepositoryPtr, const kainjow::mustache::data* aContext);
 
+  MustacheContext(MustacheTemplateCache& aTemplateCache, const kainjow::mustache::data* aContext);
+
   const kainjow::mustache::basic_data<std::string>* get_partial(
       const std::string& aName) const override;
 
  private:
   RepositoryPtr mRepositoryPtr;
+  MustacheTemplateCache* mTemplateCache;
   mutable std::unordered_map<std::string, kainjow::mustache::data> m_partials;
 };  // end of class MustacheContext
 
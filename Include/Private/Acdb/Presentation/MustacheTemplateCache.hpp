@@ -0,0 +1,55 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Thread-safe cache of Mustache templates shared by render tasks.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_MustacheTemplateCache_hpp
+#define ACDB_MustacheTemplateCache_hpp
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Acdb/PrvTypes.hpp"
+
+namespace Acdb {
+class Repository;
+
+namespace Presentation {
+class MustacheTemplateCache {
+ public:
+  MustacheTemplateCache(RepositoryPtr aRepositoryPtr);
+
+  MustacheTemplateCache(const MustacheTemplateCache&) = delete;
+  MustacheTemplateCache& operator=(const MustacheTemplateCache&) = delete;
+
+  std::string Get(const std::string& aName);
+
+ private:
+  RepositoryPtr mRepositoryPtr;
+  std::mutex mMutex;
+  std::unordered_map<std::string, std::string> mTemplates;
+};  // end of class MustacheTemplateCache
+
+}  // end of namespace Presentation
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_MustacheTemplateCache_hpp
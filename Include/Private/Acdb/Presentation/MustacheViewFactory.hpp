@@ -29,6 +29,7 @@ limitations under the License.
 #include "GRM_pub.h"
 
 #include "Acdb/PrvTypes.hpp"
+#include "Acdb/SectionType.hpp"
 
 namespace Acdb {
 class Repository;
@@ -47,10 +48,14 @@ std::string GetPresentationMarkerHtml(const PresentationMarker& aPresentationMar
 
 std::string GetReviewListHtml(const ReviewList& aReviewList, const RepositoryPtr& aRepositoryPtr);
 
+SectionType::Value GetSectionPageType(const std::string& aSectionName);
+
 std::string GetSectionPageHtml(const PresentationMarker& aPresentationMarker,
                                const std::string& aSectionName,
                                const RepositoryPtr& aRepositoryPtr);
 
+void SetContentViewThreadCount(const uint32_t aThreadCount);
+
 void SetHeadContent(const std::string& aHeadContent);
 
 void SetImagePrefix(const std::string& aImagePrefix);
@@ -28,6 +28,7 @@ limitations under the License.
 #include <vector>
 
 #include "ACDB_pub_types.h"
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/IPresentationMarker.hpp"
 #include "Acdb/Presentation/Section/Address.hpp"
 #include "Acdb/Presentation/Section/Amenities.hpp"
@@ -48,7 +49,7 @@ namespace Acdb {
 namespace Presentation {
 
 //! Marker represents a point from the ActiveCaptain database
-class PresentationMarker : public IPresentationMarker {
+class PresentationMarker : public IPresentationMarker, public ArenaObject {
  public:
   // public functions
   PresentationMarker(const ACDB_marker_idx_type aId, MarkerDetail&& aMarkerDetail,
@@ -29,6 +29,7 @@ limitations under the License.
 #include <vector>
 
 #include "ACDB_pub_types.h"
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
 #include "Acdb/Presentation/Field/ReviewField.hpp"
 #include "Acdb/Presentation/Field/ReviewSummary.hpp"
@@ -37,7 +38,7 @@ limitations under the License.
 namespace Acdb {
 namespace Presentation {
 //! List of reviews for a marker
-class ReviewList {
+class ReviewList : public ArenaObject {
  public:
   // public functions
   ReviewList(std::string&& aTitle, ReviewSummaryPtr aReviewSummary,
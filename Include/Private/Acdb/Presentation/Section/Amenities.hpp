@@ -25,6 +25,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #define ACDB_Amenities_hpp
 
 #include <vector>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/AttributeField.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
 #include "Acdb/Presentation/Field/YesNoUnknownNearbyField.hpp"
@@ -33,7 +34,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 namespace Acdb {
 namespace Presentation {
 
-class Amenities {
+class Amenities : public ArenaObject {
  public:
   // functions
   Amenities(std::string&& aTitle, std::vector<YesNoUnknownNearbyField>&& aYnubFields,
@@ -25,6 +25,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #define ACDB_Business_hpp
 
 #include <memory>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/AttributeField.hpp"
 #include "Acdb/Presentation/Field/BusinessPromotionListField.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
@@ -33,7 +34,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 namespace Acdb {
 namespace Presentation {
 
-class Business {
+class Business : public ArenaObject {
  public:
   // functions
   Business(std::string&& aTitle, std::vector<AttributeField>&& aAttributeFields,
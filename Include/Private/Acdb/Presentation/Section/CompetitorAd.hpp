@@ -24,12 +24,13 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #ifndef ACDB_CompetitorAd_hpp
 #define ACDB_CompetitorAd_hpp
 
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/CompetitorAdField.hpp"
 #include "GRM_pub.h"
 
 namespace Acdb {
 namespace Presentation {
-class CompetitorAd {
+class CompetitorAd : public ArenaObject {
  public:
   // functions
   CompetitorAd(std::string&& aTitle, std::vector<CompetitorAdField>&& aCompetitorAdFields);
@@ -25,6 +25,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #define ACDB_Contact_hpp
 
 #include <vector>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/AttributeField.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
 #include "GRM_pub.h"
@@ -32,7 +33,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 namespace Acdb {
 namespace Presentation {
 
-class Contact {
+class Contact : public ArenaObject {
  public:
   // functions
   Contact(std::string&& aTitle, std::vector<AttributeField>&& aAttributeFields,
@@ -25,6 +25,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #define ACDB_Dockage_hpp
 
 #include <vector>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/AttributeField.hpp"
 #include "Acdb/Presentation/Field/AttributePriceField.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
@@ -35,7 +36,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 namespace Acdb {
 namespace Presentation {
 
-class Dockage {
+class Dockage : public ArenaObject {
  public:
   // functions
   Dockage(std::string&& aTitle, std::vector<YesNoMultiValueField>&& aYesNoMultiValueFields,
@@ -25,6 +25,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #define ACDB_Fuel_hpp
 
 #include <vector>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/AttributeField.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
 #include "Acdb/Presentation/Field/YesNoPriceField.hpp"
@@ -34,7 +35,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 namespace Acdb {
 namespace Presentation {
 
-class Fuel {
+class Fuel : public ArenaObject {
  public:
   // functions
   Fuel(std::string aTitle, std::vector<YesNoPriceField>&& aYesNoPriceFields,
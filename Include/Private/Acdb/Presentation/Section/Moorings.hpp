@@ -25,6 +25,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #define ACDB_Moorings_hpp
 
 #include <vector>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/AttributeField.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
 #include "Acdb/Presentation/Field/YesNoPriceField.hpp"
@@ -34,7 +35,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 namespace Acdb {
 namespace Presentation {
 
-class Moorings {
+class Moorings : public ArenaObject {
  public:
   // functions
   Moorings(std::string&& aTitle, std::vector<YesNoPriceField>&& aYesNoPriceFields,
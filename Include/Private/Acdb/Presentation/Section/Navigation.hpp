@@ -26,6 +26,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 
 #include <memory>
 #include <vector>
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/Presentation/Field/AttributeField.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
 #include "GRM_pub.h"
@@ -33,7 +34,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 namespace Acdb {
 namespace Presentation {
 
-class Navigation {
+class Navigation : public ArenaObject {
  public:
   // functions
   Navigation(std::string aTitle, std::vector<AttributeField>&& aAttributeFields,
@@ -24,6 +24,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #ifndef ACDB_ReviewDetail_hpp
 #define ACDB_ReviewDetail_hpp
 
+#include "Acdb/MonotonicArena.hpp"
 #include "Acdb/PrvTypes.hpp"
 #include "Acdb/Presentation/Field/LinkField.hpp"
 #include "Acdb/Presentation/Field/ReviewField.hpp"
@@ -33,7 +34,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 namespace Acdb {
 namespace Presentation {
 
-class ReviewDetail {
+class ReviewDetail : public ArenaObject {
  public:
   // functions
   ReviewDetail(std::string&& aTitle, std::unique_ptr<ReviewField> aFeaturedReview,
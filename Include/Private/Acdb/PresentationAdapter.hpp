@@ -63,6 +63,9 @@ class PresentationAdapter {
   Presentation::PresentationMarkerPtr GetMarker(const ACDB_marker_idx_type aIdx,
                                                 const std::string& aCaptainName = std::string());
 
+  Presentation::PresentationMarkerPtr GetMarkerSections(const ACDB_marker_idx_type aIdx,
+                                                        const SectionType aSections);
+
   Presentation::ReviewListPtr GetReviewList(const ACDB_marker_idx_type aIdx, const int aPageNumber,
                                             const int aPageSize,
                                             const std::string& aCaptainName = std::string());
@@ -89,6 +92,10 @@ class PresentationAdapter {
 
   Presentation::FuelPtr GetFuel(const ACDB_marker_idx_type aIdx, const bool aIsRequired);
 
+  Presentation::PresentationMarkerPtr GetMarker(const ACDB_marker_idx_type aIdx,
+                                                const SectionType aSections,
+                                                const std::string& aCaptainName);
+
   Presentation::MooringsPtr GetMoorings(const ACDB_marker_idx_type aIdx, const bool aIsRequired);
 
   Presentation::NavigationPtr GetNavigation(const ACDB_marker_idx_type aIdx,
@@ -40,7 +40,7 @@ class AddressQuery {
 
   bool Get(const ACDB_marker_idx_type aId, AddressTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, AddressTableDataType&& aAddressTableData);
+  bool Write(const ACDB_marker_idx_type aId, const AddressTableDataType& aAddressTableData);
 
  private:
   // Variables
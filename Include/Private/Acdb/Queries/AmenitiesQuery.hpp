@@ -40,7 +40,7 @@ class AmenitiesQuery {
 
   bool Get(const ACDB_marker_idx_type aId, AmenitiesTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, AmenitiesTableDataType&& aAmenitiesTableData);
+  bool Write(const ACDB_marker_idx_type aId, const AmenitiesTableDataType& aAmenitiesTableData);
 
  private:
   // Variables
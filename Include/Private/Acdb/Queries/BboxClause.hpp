@@ -0,0 +1,50 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Plans the spatial part of marker queries, so that a bounding box
+    crossing the antimeridian is read by one statement.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_BboxClause_hpp
+#define ACDB_BboxClause_hpp
+
+#include <string>
+#include <vector>
+
+#include "ACDB_pub_types.h"
+#include "SQLiteCpp/Statement.h"
+
+namespace Acdb {
+namespace BboxClause {
+
+//! Parameters bound for each part of a bounding box
+static constexpr int ParametersPerPart = 4;
+
+std::vector<bbox_type> GetParts(const bbox_type& aBbox);
+
+std::string GetSql(const size_t aPartCount);
+
+int Bind(SQLite::Statement& aStatement, const int aFirstParameter,
+         const std::vector<bbox_type>& aParts);
+
+}  // end of namespace BboxClause
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_BboxClause_hpp
@@ -41,7 +41,8 @@ class BusinessPhotoQuery {
 
   bool Get(const ACDB_marker_idx_type aId, std::vector<BusinessPhotoTableDataType>& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, BusinessPhotoTableDataType&& aBusinessPhotoTableData);
+  bool Write(const ACDB_marker_idx_type aId,
+             const BusinessPhotoTableDataType& aBusinessPhotoTableData);
 
  private:
   // Variables
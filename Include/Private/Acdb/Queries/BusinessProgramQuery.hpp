@@ -41,7 +41,7 @@ class BusinessProgramQuery {
   bool Get(const ACDB_marker_idx_type aId, BusinessProgramTableDataType& aResultOut);
 
   bool Write(const ACDB_marker_idx_type aId,
-             BusinessProgramTableDataType&& aBusinessProgramTableData);
+             const BusinessProgramTableDataType& aBusinessProgramTableData);
 
  private:
   // Variables
@@ -40,7 +40,7 @@ class BusinessQuery {
 
   bool Get(const ACDB_marker_idx_type aId, BusinessTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, BusinessTableDataType&& aBusinessTableData);
+  bool Write(const ACDB_marker_idx_type aId, const BusinessTableDataType& aBusinessTableData);
 
  private:
   // Variables
@@ -46,7 +46,7 @@ class CompetitorQuery {
   bool GetPotentialAdvertisers(const ACDB_marker_idx_type aId,
                                std::vector<ACDB_marker_idx_type>& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, CompetitorTableDataType&& aCompetitorTableData);
+  bool Write(const ACDB_marker_idx_type aId, const CompetitorTableDataType& aCompetitorTableData);
 
  private:
   // Variables
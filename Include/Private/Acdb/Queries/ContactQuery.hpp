@@ -40,7 +40,7 @@ class ContactQuery {
 
   bool Get(const ACDB_marker_idx_type aId, ContactTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, ContactTableDataType&& aContactTableData);
+  bool Write(const ACDB_marker_idx_type aId, const ContactTableDataType& aContactTableData);
 
  private:
   // Variables
@@ -40,7 +40,7 @@ class DockageQuery {
 
   bool Get(const ACDB_marker_idx_type aId, DockageTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, DockageTableDataType&& aDockageTableData);
+  bool Write(const ACDB_marker_idx_type aId, const DockageTableDataType& aDockageTableData);
 
  private:
   std::unique_ptr<SQLite::Statement> mDelete;
@@ -40,7 +40,7 @@ class FuelQuery {
 
   bool Get(const ACDB_marker_idx_type aId, FuelTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, FuelTableDataType&& aFuelTableData);
+  bool Write(const ACDB_marker_idx_type aId, const FuelTableDataType& aFuelTableData);
 
  private:
   // Variables
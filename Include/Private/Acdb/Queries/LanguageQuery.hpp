@@ -37,7 +37,7 @@ class LanguageQuery {
 
   bool GetAll(std::vector<LanguageTableDataType>& aResultOut);
 
-  bool Write(LanguageTableDataType&& aLanguageTableData);
+  bool Write(const LanguageTableDataType& aLanguageTableData);
 
  private:
   // Variables
@@ -0,0 +1,69 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Maintains the attribute index used by search filters.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_MarkerAttributeQuery_hpp
+#define ACDB_MarkerAttributeQuery_hpp
+
+#include "ACDB_pub_types.h"
+#include "Acdb/PrvTypes.hpp"
+#include "SQLiteCpp/Statement.h"
+
+namespace Acdb {
+class MarkerAttributeQuery {
+ public:
+  // functions
+  MarkerAttributeQuery(SQLite::Database& aDatabase);
+
+  static bool CreateFunction(SQLite::Database& aDatabase);
+
+  bool Delete(const ACDB_marker_idx_type aId);
+
+  bool Delete(const uint64_t aGeohashStart, const uint64_t aGeohashEnd);
+
+  bool IsComplete() const;
+
+  bool Rebuild();
+
+  bool Write(const ACDB_marker_idx_type aId);
+
+ private:
+  // functions
+  void PrepareStatements();
+
+  void ResetStatements();
+
+  // Variables
+  SQLite::Database& mDatabase;
+
+  std::unique_ptr<SQLite::Statement> mDelete;
+
+  std::unique_ptr<SQLite::Statement> mDeleteGeohash;
+
+  std::unique_ptr<SQLite::Statement> mReadSections;
+
+  std::unique_ptr<SQLite::Statement> mWrite;
+};  // end of class MarkerAttributeQuery
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_MarkerAttributeQuery_hpp
@@ -40,7 +40,7 @@ class MarkerMetaQuery {
 
   bool Get(const ACDB_marker_idx_type aId, MarkerMetaTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, MarkerMetaTableDataType&& aMarkerMetaTableData);
+  bool Write(const ACDB_marker_idx_type aId, const MarkerMetaTableDataType& aMarkerMetaTableData);
 
  private:
   // Variables
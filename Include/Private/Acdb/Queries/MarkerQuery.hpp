@@ -27,6 +27,7 @@ limitations under the License.
 #include <vector>
 
 #include "ACDB_pub_types.h"
+#include "Acdb/MapMarkerColumns.hpp"
 #include "Acdb/MapMarkerFilter.hpp"
 #include "Acdb/PrvTypes.hpp"
 #include "SQLiteCpp/Statement.h"
@@ -43,14 +44,16 @@ class MarkerQuery {
 
   bool Get(const ACDB_marker_idx_type aId, MarkerTableDataType& aResultOut);
 
-  bool GetFiltered(const MapMarkerFilter& aFilter, std::vector<MarkerTableDataType>& aResultOut);
+  bool GetAll(MapMarkerColumns& aResultOut);
+
+  bool GetFiltered(const MapMarkerFilter& aFilter, MapMarkerColumns& aResultOut);
 
   bool GetLastUpdate(uint64_t& aLastUpdateOut);
 
   bool GetIds(const uint32_t aPageNumber, const uint32_t aPageSize,
               std::vector<ACDB_marker_idx_type>& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, MarkerTableDataType&& aMarkerTableData);
+  bool Write(const ACDB_marker_idx_type aId, const MarkerTableDataType& aMarkerTableData);
 
  private:
   std::unique_ptr<SQLite::Statement> mDelete;
@@ -59,8 +62,12 @@ class MarkerQuery {
 
   std::unique_ptr<SQLite::Statement> mRead;
 
+  std::unique_ptr<SQLite::Statement> mReadAll;
+
   std::unique_ptr<SQLite::Statement> mReadFiltered;
 
+  std::unique_ptr<SQLite::Statement> mReadSplitFiltered;
+
   std::unique_ptr<SQLite::Statement> mReadLastUpdate;
 
   std::unique_ptr<SQLite::Statement> mReadIds;
@@ -40,7 +40,7 @@ class MooringsQuery {
 
   bool Get(const ACDB_marker_idx_type aId, MooringsTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, MooringsTableDataType&& aMooringsTableData);
+  bool Write(const ACDB_marker_idx_type aId, const MooringsTableDataType& aMooringsTableData);
 
  private:
   // Variables
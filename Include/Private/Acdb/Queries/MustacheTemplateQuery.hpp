@@ -39,7 +39,7 @@ class MustacheTemplateQuery {
 
   bool GetAll(std::vector<MustacheTemplateTableDataType>& aResultOut);
 
-  bool Write(MustacheTemplateTableDataType&& aMustacheTemplateTableData);
+  bool Write(const MustacheTemplateTableDataType& aMustacheTemplateTableData);
 
  private:
   // Variables
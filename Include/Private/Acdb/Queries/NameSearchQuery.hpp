@@ -0,0 +1,78 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Maintains the normalized marker names and their trigram index
+    used by fuzzy name search.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_NameSearchQuery_hpp
+#define ACDB_NameSearchQuery_hpp
+
+#include <string>
+
+#include "ACDB_pub_types.h"
+#include "Acdb/PrvTypes.hpp"
+#include "SQLiteCpp/Statement.h"
+
+namespace Acdb {
+class NameSearchQuery {
+ public:
+  // functions
+  NameSearchQuery(SQLite::Database& aDatabase);
+
+  bool Delete(const ACDB_marker_idx_type aId);
+
+  bool Delete(const uint64_t aGeohashStart, const uint64_t aGeohashEnd);
+
+  bool IsComplete() const;
+
+  bool Rebuild();
+
+  bool Write(const ACDB_marker_idx_type aId, const std::string& aName);
+
+ private:
+  // functions
+  bool DeleteName(const ACDB_marker_idx_type aId, const std::string& aNormalizedName);
+
+  void PrepareStatements();
+
+  void ResetStatements();
+
+  bool Read(const ACDB_marker_idx_type aId, std::string& aNormalizedNameOut);
+
+  // Variables
+  SQLite::Database& mDatabase;
+
+  std::unique_ptr<SQLite::Statement> mDelete;
+
+  std::unique_ptr<SQLite::Statement> mDeleteTrigram;
+
+  std::unique_ptr<SQLite::Statement> mRead;
+
+  std::unique_ptr<SQLite::Statement> mReadGeohash;
+
+  std::unique_ptr<SQLite::Statement> mWrite;
+
+  std::unique_ptr<SQLite::Statement> mWriteTrigram;
+};  // end of class NameSearchQuery
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_NameSearchQuery_hpp
@@ -40,7 +40,7 @@ class NavigationQuery {
 
   bool Get(const ACDB_marker_idx_type aId, NavigationTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, NavigationTableDataType&& aNavigationTableData);
+  bool Write(const ACDB_marker_idx_type aId, const NavigationTableDataType& aNavigationTableData);
 
  private:
   // Variables
@@ -40,7 +40,7 @@ class RetailQuery {
 
   bool Get(const ACDB_marker_idx_type aId, RetailTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, RetailTableDataType&& aRetailTableData);
+  bool Write(const ACDB_marker_idx_type aId, const RetailTableDataType& aRetailTableData);
 
  private:
   // Variables
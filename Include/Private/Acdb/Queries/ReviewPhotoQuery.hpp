@@ -48,7 +48,7 @@ class ReviewPhotoQuery {
       uint32_t aPageSize,
       std::map<ACDB_review_idx_type, std::vector<ReviewPhotoTableDataType>>& aResultOut);
 
-  bool Write(const ACDB_review_idx_type aId, ReviewPhotoTableDataType&& aReviewPhotoTableData);
+  bool Write(const ACDB_review_idx_type aId, const ReviewPhotoTableDataType& aReviewPhotoTableData);
 
  private:
   // Variables
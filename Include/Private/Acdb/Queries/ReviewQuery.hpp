@@ -48,7 +48,7 @@ class ReviewQuery {
                uint32_t aPageNumber, uint32_t aPageSize,
                std::vector<ReviewTableDataType>& aResultOut);
 
-  bool Write(const ACDB_review_idx_type aId, ReviewTableDataType&& aReviewTableData);
+  bool Write(const ACDB_review_idx_type aId, const ReviewTableDataType& aReviewTableData);
 
  private:
   // Variables
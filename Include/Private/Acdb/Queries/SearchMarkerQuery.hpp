@@ -24,6 +24,7 @@ limitations under the License.
 #ifndef ACDB_SearchMarkerQuery_hpp
 #define ACDB_SearchMarkerQuery_hpp
 
+#include <string>
 #include <vector>
 
 #include "ACDB_pub_types.h"
@@ -42,12 +43,35 @@ class SearchMarkerQuery {
   bool GetBasicFiltered(const SearchMarkerFilter& aFilter,
                         std::vector<MarkerTableDataType>& aResultOut);
 
+  bool GetExtendedData(std::vector<MarkerTableDataType>& aMarkerList,
+                       std::vector<ExtendedMarkerDataType>& aResultOut);
+
   bool GetExtendedFiltered(const SearchMarkerFilter& aFilter,
                            std::vector<ExtendedMarkerDataType>& aResultOut);
 
  private:
+  // functions
+
+  bool GetFuzzyFiltered(const SearchMarkerFilter& aFilter,
+                        std::vector<MarkerTableDataType>& aResultOut);
+
+  std::string GetAttributesFilterSql(const SearchMarkerFilter& aFilter);
+
+  bool HasAttributeIndex();
+
+  bool HasNameIndex();
+
+  bool ReadOrdered(const SearchMarkerFilter& aFilter, std::vector<MarkerTableDataType>& aResultOut);
+
+  bool ReadFiltered(const std::string& aSqlEnd, const SearchMarkerFilter& aFilter,
+                    std::vector<MarkerTableDataType>& aResultOut);
+
   SQLite::Database& mDatabase;
 
+  bool mHasAttributeIndex;  //!< set once the attribute index is found
+
+  bool mHasNameIndex;  //!< set once the fuzzy name search data is found
+
 };  // end of class SearchMarkerQuery
 }  // end of namespace Acdb
 
@@ -40,7 +40,7 @@ class ServicesQuery {
 
   bool Get(const ACDB_marker_idx_type aId, ServicesTableDataType& aResultOut);
 
-  bool Write(const ACDB_marker_idx_type aId, ServicesTableDataType&& aServicesTableData);
+  bool Write(const ACDB_marker_idx_type aId, const ServicesTableDataType& aServicesTableData);
 
  private:
   // Variables
@@ -38,7 +38,7 @@ class TranslatorQuery {
 
   bool GetAll(std::vector<TranslationTableDataType>& aResultOut);
 
-  bool Write(TranslationTableDataType&& aTranslationTableData);
+  bool Write(const TranslationTableDataType& aTranslationTableData);
 
  private:
   // Variables
@@ -0,0 +1,57 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Applies a QueryControl to the database reads of a thread.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_QueryControlScope_hpp
+#define ACDB_QueryControlScope_hpp
+
+#include "Acdb/QueryControl.hpp"
+#include "SQLiteCpp/Database.h"
+
+namespace Acdb {
+//! Applies a QueryControl to the database reads made by the current
+//! thread until the scope ends
+class QueryControlScope {
+ public:
+  // functions
+  explicit QueryControlScope(const QueryControl* aQueryControl);
+
+  ~QueryControlScope();
+
+  bool WasInterrupted() const;
+
+ private:
+  QueryControlScope(const QueryControlScope&) = delete;
+  QueryControlScope& operator=(const QueryControlScope&) = delete;
+
+  // Variables
+  const QueryControl* mQueryControl;
+  const QueryControl* mPreviousQueryControl;
+  bool* mPreviousInterrupted;
+  bool mInterrupted;  //!< set by the progress handler when it interrupts a read
+};  // end of class QueryControlScope
+
+void SetQueryControlHandler(SQLite::Database& aDatabase);
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_QueryControlScope_hpp
@@ -0,0 +1,94 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Per-statement latency and row counts of database queries.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_QueryStatsRegistry_hpp
+#define ACDB_QueryStatsRegistry_hpp
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Acdb/LatencyHistogram.hpp"
+#include "Acdb/PubTypes.hpp"
+#include "SQLiteCpp/Database.h"
+
+struct sqlite3_stmt;
+
+namespace Acdb {
+//! Collects the stats of every statement run on the databases
+//! attached to it.  Must outlive those databases, or detach them.
+class QueryStatsRegistry {
+ public:
+  // functions
+  QueryStatsRegistry();
+
+  void Attach(SQLite::Database& aDatabase);
+
+  void Detach(SQLite::Database& aDatabase);
+
+  PerformanceStats GetStats() const;
+
+ private:
+  // Constants
+  //! Distinct statements tracked; the runs of any others share one entry
+  static constexpr size_t MaxStatements = 256;
+
+  //! Prepared statements remembered before the oldest are forgotten
+  static constexpr size_t MaxPreparedStatements = 4 * MaxStatements;
+
+  // Types
+  struct Entry {
+    uint64_t mRowCount;
+    uint64_t mBusyCount;
+    LatencyHistogram mLatency;
+  };
+
+  //! Entry of a prepared statement, found by its address on each
+  //! run.  The address of a finalized statement may be reused by
+  //! another one, so its SQL is kept to tell them apart.
+  struct StatementEntry {
+    std::string mSql;
+    Entry* mEntry;
+  };
+
+  // functions
+  QueryStatsRegistry(const QueryStatsRegistry&) = delete;
+  QueryStatsRegistry& operator=(const QueryStatsRegistry&) = delete;
+
+  void Record(sqlite3_stmt* aStatement, const uint64_t aMicroseconds, const uint64_t aRowCount,
+              const uint64_t aBusyCount);
+
+  static int OnBusy(void* aRegistry, int aPriorCalls);
+
+  static int OnTrace(unsigned aType, void* aRegistry, void* aStatement, void* aData);
+
+  // Variables
+  mutable std::mutex mMutex;
+  std::unordered_map<std::string, Entry> mEntries;  //!< by SQL
+  std::unordered_map<sqlite3_stmt*, StatementEntry> mStatementEntries;
+};  // end of class QueryStatsRegistry
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_QueryStatsRegistry_hpp
@@ -25,23 +25,31 @@ limitations under the License.
 #define ACDB_Repository_hpp
 
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <set>
 #include <string>
 
+#include "Acdb/DatabaseConfig.hpp"
 #include "Acdb/InfoAdapter.hpp"
+#include "Acdb/LockStatsRegistry.hpp"
 #include "Acdb/MarkerAdapter.hpp"
+#include "Acdb/MarkerSnapshot.hpp"
 #include "Acdb/MergeAdapter.hpp"
 #include "Acdb/PresentationAdapter.hpp"
 #include "Acdb/PrvTypes.hpp"
 #include "Acdb/PubTypes.hpp"
+#include "Acdb/QueryStatsRegistry.hpp"
 #include "Acdb/ReadWriteLock.hpp"
+#include "Acdb/RwlLocker.hpp"
 #include "Acdb/TranslationAdapter.hpp"
 #include "Acdb/UpdateAdapter.hpp"
 #include "SQLiteCpp/Database.h"
 
 namespace Acdb {
+class MapMarkerColumns;
 class MapMarkerFilter;
+class QueryControl;
 class SearchMarkerFilter;
 class Version;
 
@@ -49,16 +57,16 @@ class Repository {
  public:
   Repository(const std::string& aDbPath = std::string{});
 
-  bool ApplyMarkerUpdateToDb(std::vector<MarkerTableDataCollection>& aMarkerList,
+  bool ApplyMarkerUpdateToDb(std::vector<MarkerTableDataCollection>&& aMarkerList,
                              const TileXY* aTileXY);
 
-  bool ApplyReviewUpdateToDb(std::vector<ReviewTableDataCollection>& aReviewList,
+  bool ApplyReviewUpdateToDb(std::vector<ReviewTableDataCollection>&& aReviewList,
                              const TileXY* aTileXY);
 
   bool ApplySupportTableUpdateToDb(
-      std::vector<LanguageTableDataType>& aLanguageList,
-      std::vector<MustacheTemplateTableDataType>& aMustacheTemplateList,
-      std::vector<TranslationTableDataType>& aTranslations);
+      std::vector<LanguageTableDataType>&& aLanguageList,
+      std::vector<MustacheTemplateTableDataType>&& aMustacheTemplateList,
+      std::vector<TranslationTableDataType>&& aTranslations);
 
   void Delete();
 
@@ -71,23 +79,55 @@ class Repository {
 
   bool GetLastUpdateInfo(LastUpdateInfoType& aUpdateInfoOut);
 
+  LockPerformanceStats GetLockStats() const;
+
   std::string GetMustacheTemplate(const std::string& aName);
 
   IMapMarkerPtr GetMapMarker(const ACDB_marker_idx_type aIdx);
 
   ISearchMarkerPtr GetSearchMarker(const ACDB_marker_idx_type aIdx);
 
-  void GetMapMarkersByFilter(const MapMarkerFilter& aFilter, std::vector<IMapMarkerPtr>& aResults);
+  bool GetMapMarkersByFilter(const MapMarkerFilter& aFilter, std::vector<IMapMarkerPtr>& aResults,
+                             const QueryControl* aQueryControl = nullptr);
+
+  bool GetMapMarkersByFilter(const MapMarkerFilter& aFilter, MapMarkerColumns& aResults,
+                             const QueryControl* aQueryControl = nullptr);
+
+  bool GetMapMarkersByFilters(const std::vector<MapMarkerFilter>& aFilters,
+                              std::vector<IMapMarkerPtr>& aResults,
+                              std::vector<std::vector<size_t>>& aResultIndexes,
+                              const QueryControl* aQueryControl = nullptr);
+
+  PerformanceStats GetPerformanceStats() const;
+
+  bool GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                     std::vector<ISearchMarkerPtr>& aResults,
+                                     const QueryControl* aQueryControl = nullptr);
 
-  void GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                     std::vector<ISearchMarkerPtr>& aResults);
+  bool GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                std::vector<ISearchMarkerPtr>& aResults,
+                                const QueryControl* aQueryControl = nullptr);
 
-  void GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                std::vector<ISearchMarkerPtr>& aResults);
+  bool GetNearestSearchMarkers(const scposn_type& aPosition, const uint32_t aCount,
+                               const SearchMarkerFilter& aFilter,
+                               std::vector<SearchMarkerDistancePair>& aResults,
+                               const QueryControl* aQueryControl = nullptr);
+
+  bool GetSearchMarkersAlongRoute(const std::vector<scposn_type>& aRoute,
+                                  const double aBufferMeters, const SearchMarkerFilter& aFilter,
+                                  const RouteSearchCallback& aCallback,
+                                  const QueryControl* aQueryControl = nullptr);
+
+  bool GetSearchCandidates(const SearchMarkerFilter& aFilter,
+                           std::vector<MarkerTableDataType>& aResults,
+                           const QueryControl* aQueryControl = nullptr);
 
   Presentation::PresentationMarkerPtr GetPresentationMarker(
       const ACDB_marker_idx_type aIdx, const std::string& aCaptainName = std::string{});
 
+  Presentation::PresentationMarkerPtr GetPresentationMarkerSections(const ACDB_marker_idx_type aIdx,
+                                                                    const SectionType aSections);
+
   Presentation::ReviewListPtr GetReviewList(const ACDB_marker_idx_type aIdx, const int aPageNumber,
                                             const int aPageSize,
                                             const std::string& aCaptainName = std::string{});
@@ -121,14 +161,23 @@ class Repository {
 
   bool PrepareSharedDb(const std::string& aPath) const;
 
+  void PreloadLanguages(const std::vector<std::string>& aLanguages);
+
   void SetLanguage(const std::string& aLanguage);
 
+  void SetPerformanceStatsEnabled(const bool aEnabled);
+
+  void SetSlowLockHolderCallback(const uint32_t aThresholdMilliseconds,
+                                 SlowLockHolderCallback aCallback);
+
   bool DeleteTile(const TileXY& aTileToDelete, const bool aCreateTransaction = true);
 
   bool DeleteTileReviews(const TileXY& aTileXY);
 
   bool InstallSingleTileDatabase(const std::string& aTileDatabaseFile, const TileXY& aTileXY);
 
+  void UpdateSearchData();
+
  private:
   // Constants
   static const uint32_t MergePageSize = 50;
@@ -143,18 +192,27 @@ class Repository {
 
   bool DeleteFile(const std::string& aPath);
 
+  void DropMarkerSnapshot();
+
   bool FindNewestDbFile(const std::string aPath, std::string& aFilenameOut) const;
 
+  std::string GetMarkerSnapshotPath();
+
   bool MergeSingleTileDatabase(const std::string& aTileDatabaseFile, const TileXY& aTileXY);
 
   bool IsValidDatabaseFile(const std::string& aFilePath) const;
 
-  bool OpenDatabase(bool updateStateOnFailure);
+  bool OpenDatabase(bool updateStateOnFailure, const bool aMergeSource);
 
   std::unique_ptr<SQLite::Database> OpenDatabaseFile(const std::string& aPath) const;
 
+  void OpenMarkerSnapshot();
+
   bool ReadyDbAccess(SQLite::Database& aDatabase) const;
 
+  void TuneDbAccess(SQLite::Database& aDatabase, const DatabaseConfig::Tuning& aTuning,
+                    const bool aWalMode) const;
+
   bool MakeSplitBoundingBoxForCrossMeridianSearch(const bbox_type& aOriginalBbox,
                                                   bbox_type& aLeftBbox,
                                                   bbox_type& aRightBbox) const;
@@ -171,16 +229,27 @@ class Repository {
   bool GetMergeReviews(const ACDB_marker_idx_type aIdx,
                        std::vector<ReviewTableDataCollection>& aReviews);
 
+  bool WriteMarkerSnapshot();
+
   // Variables
   std::string mDbPath;  //!< path to the database
   ReadWriteLock mRwl;
+  LockStatsRegistry mLockStats;  //!< declared before the lockers reporting to it
+  QueryStatsRegistry mQueryStats;  //!< declared before mDatabase, which reports to it
   std::unique_ptr<SQLite::Database> mDatabase;
+  std::unique_ptr<MarkerSnapshot> mMarkerSnapshot;  //!< declared before the adapter reading it
   std::unique_ptr<InfoAdapter> mInfoAdapter;
   std::unique_ptr<MarkerAdapter> mMarkerAdapter;
   std::unique_ptr<MergeAdapter> mMergeAdapter;
   std::unique_ptr<PresentationAdapter> mPresentationAdapter;
   std::unique_ptr<TranslationAdapter> mTranslationAdapter;
   std::unique_ptr<UpdateAdapter> mUpdateAdapter;
+  std::unique_ptr<RwlLocker> mSideloadLocker;  //!< shared lock held between sideload calls
+  std::mutex mLanguageMutex;
+  std::string mLanguage;  //!< language of the translations kept in the marker snapshot
+  bool mMarkerSnapshotStale;  //!< the database changed since the snapshot was written
+  bool mQueryStatsEnabled;  //!< the database reports its statements to mQueryStats
+  bool mOptimizeOnClose;    //!< the main database refreshes its planner statistics on close
 };  // end of class Repository
 }  // end of namespace Acdb
 
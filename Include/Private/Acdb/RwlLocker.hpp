@@ -24,20 +24,35 @@ limitations under the License.
 #ifndef ACDB_RwlLocker_hpp
 #define ACDB_RwlLocker_hpp
 
+#include <chrono>
+#include <cstdint>
+
 #include "Acdb/ReadWriteLock.hpp"
 
 namespace Acdb {
+class LockStatsRegistry;
+
 class RwlLocker {
  public:
   RwlLocker(ReadWriteLock& aReadWriteLock, const bool aExclusive);
 
+  RwlLocker(ReadWriteLock& aReadWriteLock, const bool aExclusive, LockStatsRegistry& aLockStats,
+            const char* aTag);
+
   ~RwlLocker();
 
  private:
   RwlLocker(const RwlLocker&) = delete;
   RwlLocker& operator=(const RwlLocker&) = delete;
 
+  void Lock();
+
   ReadWriteLock& mReadWriteLock;
+  const bool mExclusive;
+  LockStatsRegistry* mLockStats;  //!< registry to report to, if tagged and recording
+  const char* mTag;
+  uint64_t mWaitMicroseconds;
+  std::chrono::steady_clock::time_point mLockTime;
 };
 
 }  // namespace Acdb
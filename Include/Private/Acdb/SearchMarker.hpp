@@ -34,13 +34,14 @@ class SearchMarker : public ISearchMarker {
  public:
   SearchMarker(const ACDB_marker_idx_type aId, const ACDB_type_type aType,
                const uint64_t aLastUpdated, std::string&& aName, const int32_t aLat,
-               const int32_t aLon, const MapIconType aMapIcon, std::string&& aLocalizedType);
+               const int32_t aLon, const MapIconType aMapIcon,
+               const std::string* aPooledLocalizedType);
 
   SearchMarker(const ACDB_marker_idx_type aId, const ACDB_type_type aType,
                const uint64_t aLastUpdated, std::string&& aName, const int32_t aLat,
                const int32_t aLon, const MapIconType aMapIcon, ContactData&& aContactData,
                FuelData&& aFuelData, ReviewStatsData&& aReviewStatsData,
-               std::string&& aLocalizedType);
+               const std::string* aPooledLocalizedType);
 
   ACDB_marker_idx_type GetId() const override;
 
@@ -77,7 +78,7 @@ class SearchMarker : public ISearchMarker {
   ContactData mContactData;
   FuelData mFuelData;
   ReviewStatsData mReviewStatsData;
-  std::string mLocalizedType;
+  const std::string* mLocalizedType;  //!< pooled, shared by the markers of a type
 };  // end of class SearchMarker
 }  // end of namespace Acdb
 
@@ -0,0 +1,69 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Search-as-you-type session that refines its previous results.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_SearchSession_hpp
+#define ACDB_SearchSession_hpp
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Acdb/ISearchSession.hpp"
+#include "Acdb/PrvTypes.hpp"
+#include "Acdb/QueryControl.hpp"
+#include "Acdb/SearchMarkerFilter.hpp"
+#include "Acdb/TableDataTypes.hpp"
+
+namespace Acdb {
+class SearchSession : public ISearchSession {
+ public:
+  // functions
+  explicit SearchSession(RepositoryPtr aRepositoryPtr);
+
+  void Cancel() override;
+
+  bool Search(const SearchMarkerFilter& aFilter, std::vector<ISearchMarkerPtr>& aResults) override;
+
+  virtual ~SearchSession() = default;
+
+ private:
+  // Constants
+  static const int32_t MaxCandidates = 4096;  //!< larger result sets are not kept for refining
+
+  // functions
+  bool CanRefine(const SearchMarkerFilter& aFilter) const;
+
+  // Variables
+  RepositoryPtr mRepositoryPtr;
+  std::atomic<uint64_t> mGeneration;  //!< incremented by every Search and Cancel call
+
+  std::mutex mMutex;  //!< guards the members below
+  std::shared_ptr<QueryControl> mQueryControl;  //!< stops the database read in progress
+  bool mHasCandidates;
+  SearchMarkerFilter mCandidatesFilter;
+  std::vector<MarkerTableDataType> mCandidates;  //!< every match of mCandidatesFilter
+};  // end of class SearchSession
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_SearchSession_hpp
@@ -24,6 +24,8 @@ limitations under the License.
 #ifndef ACDB_SettingsManager_hpp
 #define ACDB_SettingsManager_hpp
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include "acdb_prv_config.h"
 #include "ACDB_pub_types.h"
@@ -51,6 +53,8 @@ class SettingsManager : public ISettingsManager {
 
   ACDB_unit_type GetDistanceUnit() const override;
 
+  uint32_t GetEpoch() const;
+
   ACDB_unit_type GetVolumeUnit() const override;
 
   void SetCoordinateFormat(const ACDB_coord_format_type aCoordFormat) override;
@@ -79,6 +83,7 @@ class SettingsManager : public ISettingsManager {
   ACDB_date_format_type mDateFormat;
   ACDB_unit_type mDistanceUnit;
   ACDB_unit_type mVolumeUnit;
+  std::atomic<uint32_t> mEpoch;  //!< incremented on every setting change
 
   SettingsManager();
 
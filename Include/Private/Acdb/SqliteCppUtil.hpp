@@ -18,6 +18,13 @@ limitations under the License.
     @file
     SQLiteCpp utility functions.
 
+    The Write() of each query binds the text of the record it is
+    given with bindNoCopy(), so SQLite reads the caller's strings in
+    place: the record must stay alive for the Write() call.  Those
+    bindings survive reset(), but every Write() rebinds all of its
+    parameters before running the statement again, so a record
+    released after its Write() is never read.
+
     Copyright 2020 by Garmin Ltd. or its subsidiaries.
 */
 
@@ -27,10 +34,12 @@ limitations under the License.
 #ifndef ACDB_SqliteCppUtil_hpp
 #define ACDB_SqliteCppUtil_hpp
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 #include "SQLiteCpp/Database.h"
+#include "SQLiteCpp/Statement.h"
 
 namespace Acdb {
 namespace SqliteCppUtil {
@@ -39,6 +48,17 @@ enum class JournalMode { Delete, Truncate, Persist, Wal };
 
 enum class LockingMode { Normal, Exclusive };
 
+enum class Synchronous { Off, Normal, Full };
+
+enum class TempStore { Default, File, Memory };
+
+//! Text of a column of the current row, owned by its statement:
+//! valid until the statement is stepped again, reset or finalized.
+struct ColumnText {
+  const char* mData;
+  size_t mSize;
+};
+
 bool DropDatabaseFile(const std::string& aPath);
 
 bool DropDatabaseFileExt(const std::string& aPath,
@@ -46,6 +66,10 @@ bool DropDatabaseFileExt(const std::string& aPath,
 
 bool FlushWalFile(SQLite::Database& aDatabase);
 
+ColumnText GetColumnText(SQLite::Statement& aStatement, const int aIndex);
+
+bool IsReadOnly(SQLite::Database& aDatabase);
+
 std::unique_ptr<SQLite::Database> OpenDatabaseFile(const std::string& aPath, const int aFlags,
                                                    const int aBusyTimeoutMs = 0);
 
@@ -53,10 +77,26 @@ std::unique_ptr<SQLite::Database> OpenDatabaseFileExt(
     const std::string& aPath, const int aFlags, const int aBusyTimeoutMs = 0,
     const std::vector<std::string>& aVfsIds = std::vector<std::string>{});
 
+bool Optimize(SQLite::Database& aDatabase, const int aAnalysisLimit);
+
+void ResetStatement(SQLite::Statement& aStatement);
+
+bool SetCacheSize(SQLite::Database& aDatabase, const int aCacheSizeKib);
+
 bool SetJournalMode(SQLite::Database& aDatabase, const JournalMode aJournalMode);
 
 bool SetLockingMode(SQLite::Database& aDatabase, const LockingMode aLockingMode);
 
+bool SetMmapSize(SQLite::Database& aDatabase, const int64_t aMmapSize);
+
+bool SetPageSize(SQLite::Database& aDatabase, const int aPageSize);
+
+bool SetSynchronous(SQLite::Database& aDatabase, const Synchronous aSynchronous);
+
+bool SetTempStore(SQLite::Database& aDatabase, const TempStore aTempStore);
+
+bool SetWalAutoCheckpoint(SQLite::Database& aDatabase, const int aPages);
+
 }  // end of namespace SqliteCppUtil
 }  // end of namespace Acdb
 
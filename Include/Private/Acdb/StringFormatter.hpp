@@ -32,6 +32,9 @@ limitations under the License.
 namespace Acdb {
 class StringFormatter {
  public:
+  //! Buffer size that fits any string produced by this class
+  static constexpr size_t MaxFormattedLength = 128;
+
   StringFormatter(StringFormatter const&) = delete;
   StringFormatter(StringFormatter&&) = delete;
   StringFormatter& operator=(StringFormatter const&) = delete;
@@ -41,22 +44,25 @@ class StringFormatter {
 
   std::string FormatPosition(const scposn_type& aPosn) const;
 
+  size_t FormatPosition(const scposn_type& aPosn, char* aBuffer, const size_t aBufferSize) const;
+
   std::string FormatDepthValue(const double aMeters) const;
 
+  size_t FormatDepthValue(const double aMeters, char* aBuffer, const size_t aBufferSize) const;
+
   std::string FormatDate(const uint64_t aUnixTimestamp) const;
 
+  size_t FormatDate(const uint64_t aUnixTimestamp, char* aBuffer, const size_t aBufferSize) const;
+
   std::string FormatDate(const std::string& aIso8601DateTimeStr) const;
 
+  size_t FormatDate(const char* aIso8601DateTimeStr, const size_t aLength, char* aBuffer,
+                    const size_t aBufferSize) const;
+
   virtual ~StringFormatter() = default;
 
  private:
   StringFormatter();
-
-  std::string GetDateString(const Navionics::NavDateTime& aNavDateTime) const;
-
-  std::string GetDegreesMinutesString(const double aDegrees) const;
-
-  std::string GetDegreesMinutesSecondsString(const double aDegrees) const;
 };  // end of class StringFormatter
 }  // end of namespace Acdb
 
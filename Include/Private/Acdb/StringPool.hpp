@@ -0,0 +1,65 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+
+/**
+    @file
+    Pool of interned strings shared by the objects built from the
+    database.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_StringPool_hpp
+#define ACDB_StringPool_hpp
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+namespace Acdb {
+//! Keeps one copy of each string interned in it.  The references it
+//! returns stay valid for the life of the pool, and strings are never
+//! released, so only intern strings from a small set, like labels and
+//! localized type names.  Thread-safe.
+class StringPool {
+ public:
+  // functions
+  StringPool();
+
+  size_t GetBytes() const;
+
+  size_t GetCount() const;
+
+  static StringPool& GetInstance();
+
+  const std::string& Intern(const std::string& aValue);
+
+ private:
+  // functions
+  StringPool(const StringPool&) = delete;
+  StringPool& operator=(const StringPool&) = delete;
+
+  // Variables
+  mutable std::mutex mMutex;
+  std::unordered_set<std::string> mStrings;
+  size_t mBytes;
+};  // end of class StringPool
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_StringPool_hpp
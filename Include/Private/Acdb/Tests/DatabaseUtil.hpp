@@ -34,12 +34,16 @@ namespace Test {
 
 SQLite::Database CreateDatabase(TF_state_type* aState);
 
+SQLite::Database CreateDatabase(TF_state_type* aState, const std::string& aPath);
+
 MarkerTableDataCollection GetMarkerTableDataCollection();
 
 std::vector<ReviewTableDataCollection> GetReviewsTableDataCollection();
 
 void PopulateDatabase(TF_state_type* aState, SQLite::Database& aDatabase);
 
+void PopulateMustacheTemplatesTable(TF_state_type* aState, SQLite::Database& aDatabase);
+
 void PopulateTilesTable(TF_state_type* aState, SQLite::Database& aDatabase);
 
 void PopulateTileLastUpdateTable(TF_state_type* aState, SQLite::Database& aDatabase);
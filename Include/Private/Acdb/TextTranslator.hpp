@@ -24,11 +24,44 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #ifndef ACDB_TextTranslator_hpp
 #define ACDB_TextTranslator_hpp
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
+
+#include "Acdb/PrvTypes.hpp"
 
 namespace Acdb {
 class TextTranslator {
  public:
+  //! Immutable set of translations for a single language
+  class Table {
+   public:
+    Table();
+
+    explicit Table(std::vector<TranslationDataType>&& aTranslations);
+
+    const std::string* Find(const int aTranslationId) const;
+
+    const std::string* FindPooled(const int aTranslationId) const;
+
+    void GetTranslations(std::vector<TranslationDataType>& aTranslationsOut) const;
+
+   private:
+    // Constants
+    static const int MaxDenseId = 4096;
+
+    // Variables
+    std::vector<std::string> mStrings;       //!< the translations; never resized once built
+    std::vector<const std::string*> mDense;  //!< indexed by text handle, nullptr if absent
+    std::unordered_map<int, const std::string*> mSparse;  //!< ids outside the dense range
+    std::unique_ptr<std::atomic<const std::string*>[]> mPooled;  //!< interned mDense strings
+  };  // end of class Table
+
+  using TablePtr = std::shared_ptr<const Table>;
+
   // functions
   TextTranslator(TextTranslator const&) = delete;
   TextTranslator(TextTranslator&&) = delete;
@@ -37,18 +70,40 @@ class TextTranslator {
 
   void Clear();
 
+  void ClearPreloaded();
+
   std::string Find(const int aTranslationId) const;
 
+  uint32_t GetGeneration() const;
+
   static TextTranslator& GetInstance();
 
   bool Insert(const int aTranslationId, std::string&& aValue);
 
+  size_t Insert(std::vector<TranslationDataType>&& aTranslations);
+
+  const std::string& Lookup(const int aTranslationId) const;
+
+  void Preload(const std::string& aLanguage, TablePtr aTable);
+
+  void Publish(TablePtr aTable);
+
+  bool PublishPreloaded(const std::string& aLanguage);
+
  private:
   // functions
   TextTranslator();
 
+  const std::string& GetMissing(const int aTranslationId) const;
+
+  void PublishLocked(TablePtr aTable);
+
   // Variables
-  std::unordered_map<int, std::string> mValue;
+  TablePtr mCurrent;                  //!< only accessed with std::atomic_load/atomic_store
+  std::atomic<uint32_t> mGeneration;  //!< incremented every time a table is published
+  mutable std::mutex mMutex;          //!< guards everything below
+  std::unordered_map<std::string, TablePtr> mPreloaded;
+  mutable std::unordered_map<int, std::string> mMissing;
 
 };  // end of class TextTranslator
 }  // end of namespace Acdb
@@ -0,0 +1,70 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Scoped timing spans; see Acdb/Tracing.hpp.
+
+    ACDB_TRACE_SPAN("Name") times the rest of the enclosing scope.  It
+    expands to nothing unless acdb_TRACING_SUPPORT is set; ScopedSpan
+    itself is always built, so the tests run in every build.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_TraceSpan_hpp
+#define ACDB_TraceSpan_hpp
+
+#include <cstdint>
+
+#include "Acdb/Tracing.hpp"
+#include "acdb_prv_config.h"
+
+namespace Acdb {
+namespace Tracing {
+class ScopedSpan {
+ public:
+  explicit ScopedSpan(const char* aName);
+
+  ~ScopedSpan();
+
+ private:
+  ScopedSpan(const ScopedSpan&) = delete;
+  ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+  ISink* mSink;
+  const char* mName;
+  uint32_t mDepth;
+  uint64_t mStartMicroseconds;
+};  // end of class ScopedSpan
+
+}  // end of namespace Tracing
+}  // end of namespace Acdb
+
+#if (acdb_TRACING_SUPPORT)
+
+#define ACDB_TRACE_SPAN_VARIABLE(aLine) ACDB_TRACE_SPAN_VARIABLE_(aLine)
+#define ACDB_TRACE_SPAN_VARIABLE_(aLine) traceSpan##aLine
+#define ACDB_TRACE_SPAN(aName) \
+  ::Acdb::Tracing::ScopedSpan ACDB_TRACE_SPAN_VARIABLE(__LINE__) { aName }
+
+#else
+
+#define ACDB_TRACE_SPAN(aName)
+
+#endif
+
+#endif  // end of ACDB_TraceSpan_hpp
@@ -25,17 +25,24 @@ limitations under the License.
 #define ACDB_TranslationAdapter_hpp
 
 #include "Acdb/Queries/TranslatorQuery.hpp"
+#include "Acdb/TextTranslator.hpp"
 
 namespace Acdb {
-class TextTranslator;
-
 class TranslationAdapter {
  public:
   TranslationAdapter(SQLite::Database& aDatabase);
 
+  bool GetTranslations(const std::string& aLanguage,
+                       std::vector<TranslationDataType>& aTranslationsOut);
+
   void InitTextTranslator(const std::string& aLanguage);
 
+  void PreloadTextTranslator(const std::string& aLanguage);
+
  private:
+  // Functions
+  TextTranslator::TablePtr LoadTextTable(const std::string& aLanguage);
+
   // Variables
   TranslatorQuery mTranslator;
 
@@ -39,10 +39,12 @@ limitations under the License.
 #include "Acdb/Queries/DockageQuery.hpp"
 #include "Acdb/Queries/FuelQuery.hpp"
 #include "Acdb/Queries/LanguageQuery.hpp"
+#include "Acdb/Queries/MarkerAttributeQuery.hpp"
 #include "Acdb/Queries/MarkerQuery.hpp"
 #include "Acdb/Queries/MarkerMetaQuery.hpp"
 #include "Acdb/Queries/MooringsQuery.hpp"
 #include "Acdb/Queries/MustacheTemplateQuery.hpp"
+#include "Acdb/Queries/NameSearchQuery.hpp"
 #include "Acdb/Queries/NavigationQuery.hpp"
 #include "Acdb/Queries/PositionQuery.hpp"
 #include "Acdb/Queries/RetailQuery.hpp"
@@ -62,15 +64,21 @@ class UpdateAdapter {
 
   bool DeleteTileReviews(const TileXY& aTileXY);
 
-  bool UpdateMarkers(std::vector<MarkerTableDataCollection>& aMarkers,
+  bool IsSearchDataComplete() const;
+
+  bool UpdateMarkers(std::vector<MarkerTableDataCollection>&& aMarkers,
                      uint64_t& aLastUpdateMax_out);
 
-  bool UpdateReviews(std::vector<ReviewTableDataCollection>& aReviews,
+  bool UpdateMarkerAttributes();
+
+  bool UpdateNameSearch();
+
+  bool UpdateReviews(std::vector<ReviewTableDataCollection>&& aReviews,
                      uint64_t& aLastUpdateMax_out);
 
-  bool UpdateSupportTables(std::vector<LanguageTableDataType>& aLanguages,
-                           std::vector<MustacheTemplateTableDataType>& aMustacheTemplates,
-                           std::vector<TranslationTableDataType>& aTranslations);
+  bool UpdateSupportTables(std::vector<LanguageTableDataType>&& aLanguages,
+                           std::vector<MustacheTemplateTableDataType>&& aMustacheTemplates,
+                           std::vector<TranslationTableDataType>&& aTranslations);
 
  private:
   AddressQuery mAddress;
@@ -84,9 +92,11 @@ class UpdateAdapter {
   FuelQuery mFuel;
   LanguageQuery mLanguage;
   MarkerQuery mMarker;
+  MarkerAttributeQuery mMarkerAttribute;
   MarkerMetaQuery mMarkerMeta;
   MooringsQuery mMoorings;
   MustacheTemplateQuery mMustacheTemplate;
+  NameSearchQuery mNameSearch;
   NavigationQuery mNavigation;
   PositionQuery mPosition;
   RetailQuery mRetail;
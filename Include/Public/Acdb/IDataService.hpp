@@ -34,7 +34,9 @@ limitations under the License.
 #include "GRM_pub.h"
 
 namespace Acdb {
+class MapMarkerColumns;
 class MapMarkerFilter;
+class QueryControl;
 class SearchMarkerFilter;
 
 class IDataService {
@@ -42,14 +44,31 @@ class IDataService {
   // Functions
   virtual ~IDataService() = default;
 
+  virtual ISearchSessionPtr CreateSearchSession() const = 0;
+
   virtual std::string GetBusinessPhotoListHtml(const ACDB_marker_idx_type aIdx) const = 0;
 
   virtual ContentViewMapPtr GetContentViewMap(const ACDB_marker_idx_type aIdx) const = 0;
 
+  virtual LockPerformanceStats GetLockStats() const = 0;
+
   virtual IMapMarkerPtr GetMapMarker(const ACDB_marker_idx_type aIdx) const = 0;
 
-  virtual void GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
-                                     std::vector<IMapMarkerPtr>& aResults) const = 0;
+  // The reads taking a QueryControl return false if it stopped them early, in which case the
+  // results are partial.
+  virtual bool GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
+                                     std::vector<IMapMarkerPtr>& aResults,
+                                     const QueryControl* aQueryControl = nullptr) const = 0;
+
+  virtual bool GetMapMarkersByFilter(const MapMarkerFilter& aFilter, MapMarkerColumns& aResults,
+                                     const QueryControl* aQueryControl = nullptr) const = 0;
+
+  virtual bool GetMapMarkersByFilters(const std::vector<MapMarkerFilter>& aFilters,
+                                      std::vector<IMapMarkerPtr>& aResults,
+                                      std::vector<std::vector<size_t>>& aResultIndexes,
+                                      const QueryControl* aQueryControl = nullptr) const = 0;
+
+  virtual PerformanceStats GetPerformanceStats() const = 0;
 
   virtual std::string GetPresentationMarkerHtml(
       const ACDB_marker_idx_type aIdx, const std::string& aCaptainName = std::string()) const = 0;
@@ -60,23 +79,45 @@ class IDataService {
 
   virtual ISearchMarkerPtr GetSearchMarker(const ACDB_marker_idx_type aIdx) const = 0;
 
-  virtual void GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                             std::vector<ISearchMarkerPtr>& aResults) const = 0;
+  virtual bool GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                             std::vector<ISearchMarkerPtr>& aResults,
+                                             const QueryControl* aQueryControl = nullptr) const = 0;
+
+  virtual bool GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                        std::vector<ISearchMarkerPtr>& aResults,
+                                        const QueryControl* aQueryControl = nullptr) const = 0;
 
-  virtual void GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                        std::vector<ISearchMarkerPtr>& aResults) const = 0;
+  virtual bool GetNearestSearchMarkers(const scposn_type& aPosition, const uint32_t aCount,
+                                       const SearchMarkerFilter& aFilter,
+                                       std::vector<SearchMarkerDistancePair>& aResults,
+                                       const QueryControl* aQueryControl = nullptr) const = 0;
+
+  virtual bool GetSearchMarkersAlongRoute(const std::vector<scposn_type>& aRoute,
+                                          const double aBufferMeters,
+                                          const SearchMarkerFilter& aFilter,
+                                          const RouteSearchCallback& aCallback,
+                                          const QueryControl* aQueryControl = nullptr) const = 0;
 
   virtual std::string GetSectionPageHtml(const ACDB_marker_idx_type aIdx,
                                          const std::string& aSectionName) const = 0;
 
   virtual float GetUserReviewAverageStars(const ACDB_marker_idx_type aIdx) const = 0;
 
+  virtual void PreloadLanguages(const std::vector<std::string>& aLanguageIds) = 0;
+
+  virtual void SetContentViewThreadCount(const uint32_t aThreadCount) = 0;
+
   virtual void SetHeadContent(const std::string& aHeadContent) = 0;
 
   virtual void SetImagePrefix(const std::string& aImagePrefix) = 0;
 
   virtual void SetLanguage(const std::string& aLanguageId) = 0;
 
+  virtual void SetPerformanceStatsEnabled(const bool aEnabled) = 0;
+
+  virtual void SetSlowLockHolderCallback(const uint32_t aThresholdMilliseconds,
+                                         SlowLockHolderCallback aCallback) = 0;
+
 };  // end of class IDataService
 }  // end of namespace Acdb
 
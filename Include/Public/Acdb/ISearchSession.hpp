@@ -0,0 +1,53 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Contains the search-as-you-type session interface.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_ISearchSession_hpp
+#define ACDB_ISearchSession_hpp
+
+#include <vector>
+
+#include "Acdb/PubTypes.hpp"
+
+namespace Acdb {
+class SearchMarkerFilter;
+
+//! SearchSession runs the searches of one search-as-you-type field,
+//! answering each keystroke from the previous results when it can
+class ISearchSession {
+ public:
+  // public functions
+  virtual ~ISearchSession() = default;
+
+  //! Cancel the search in progress, if any, stopping its database read.
+  //! Its Search call returns false.
+  virtual void Cancel() = 0;
+
+  //! Find the basic search markers matching aFilter.  Returns false if the
+  //! search was cancelled or superseded by a later Search call.
+  virtual bool Search(const SearchMarkerFilter& aFilter,
+                      std::vector<ISearchMarkerPtr>& aResults) = 0;
+
+};  // end of class ISearchSession
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_ISearchSession_hpp
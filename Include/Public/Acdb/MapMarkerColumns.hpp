@@ -0,0 +1,141 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Map markers read in bulk, stored column by column.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_MapMarkerColumns_hpp
+#define ACDB_MapMarkerColumns_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "ACDB_pub_types.h"
+#include "Acdb/MapIconType.hpp"
+
+namespace Acdb {
+//! Map markers kept in parallel arrays, with every name in one
+//! buffer, so a bulk read allocates per column rather than per
+//! marker.  Rows are views into the columns; they are valid until
+//! the columns are changed.
+class MapMarkerColumns {
+ public:
+  //! One marker of the columns
+  class Row {
+   public:
+    Row(const MapMarkerColumns& aColumns, const size_t aIndex)
+        : mColumns(&aColumns), mIndex(aIndex) {}
+
+    ACDB_marker_idx_type GetId() const { return mColumns->mIds[mIndex]; }
+
+    uint64_t GetLastUpdated() const { return mColumns->mLastUpdated[mIndex]; }
+
+    MapIconType GetMapIcon() const { return mColumns->mMapIcons[mIndex]; }
+
+    //! Null-terminated name, owned by the columns
+    const char* GetName() const { return mColumns->mNames.data() + mColumns->mNameOffsets[mIndex]; }
+
+    scposn_type GetPosition() const { return mColumns->mPositions[mIndex]; }
+
+    ACDB_type_type GetType() const { return mColumns->mTypes[mIndex]; }
+
+   private:
+    const MapMarkerColumns* mColumns;
+    size_t mIndex;
+  };  // end of class Row
+
+  //! Iterates the rows in the order they were added.  Rows are
+  //! returned by value, not by reference, so this is only an input
+  //! iterator; iterators of different columns do not compare.
+  class const_iterator {
+   public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef Row value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef Row reference;
+
+    const_iterator(const MapMarkerColumns& aColumns, const size_t aIndex)
+        : mColumns(&aColumns), mIndex(aIndex) {}
+
+    Row operator*() const { return Row(*mColumns, mIndex); }
+
+    const_iterator& operator++() {
+      mIndex++;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator previous{*this};
+      mIndex++;
+      return previous;
+    }
+
+    bool operator==(const const_iterator& aRhs) const { return mIndex == aRhs.mIndex; }
+
+    bool operator!=(const const_iterator& aRhs) const { return mIndex != aRhs.mIndex; }
+
+   private:
+    const MapMarkerColumns* mColumns;
+    size_t mIndex;
+  };  // end of class const_iterator
+
+  // functions
+  MapMarkerColumns();
+
+  void Add(const ACDB_marker_idx_type aId, const ACDB_type_type aType, const uint64_t aLastUpdated,
+           const char* aName, const size_t aNameLength, const scposn_type& aPosition,
+           const int aBusinessProgramTier);
+
+  void Add(const ACDB_marker_idx_type aId, const ACDB_type_type aType, const uint64_t aLastUpdated,
+           const char* aName, const size_t aNameLength, const scposn_type& aPosition,
+           const MapIconType aMapIcon);
+
+  void Clear();
+
+  bool Empty() const;
+
+  void Reserve(const size_t aCount, const size_t aNameBytes);
+
+  size_t Size() const;
+
+  Row operator[](const size_t aIndex) const;
+
+  const_iterator begin() const;
+
+  const_iterator end() const;
+
+ private:
+  // Variables
+  std::vector<ACDB_marker_idx_type> mIds;
+  std::vector<ACDB_type_type> mTypes;
+  std::vector<uint64_t> mLastUpdated;
+  std::vector<scposn_type> mPositions;
+  std::vector<MapIconType> mMapIcons;
+  std::vector<uint32_t> mNameOffsets;  //!< start of each name in mNames
+  std::string mNames;                  //!< every name, each followed by a null
+};  // end of class MapMarkerColumns
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_MapMarkerColumns_hpp
@@ -25,10 +25,13 @@ limitations under the License.
 /*--------------------------------------------------------------------
                            GENERAL INCLUDES
 --------------------------------------------------------------------*/
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace Acdb {
 
@@ -46,6 +49,24 @@ typedef std::unique_ptr<IMapMarker> IMapMarkerPtr;
 class ISearchMarker;
 typedef std::unique_ptr<ISearchMarker> ISearchMarkerPtr;
 
+// Search marker and its great-circle distance, in meters, from the search position
+typedef std::pair<ISearchMarkerPtr, double> SearchMarkerDistancePair;
+
+// Search marker found within a corridor around a route
+struct RouteSearchMarker {
+  ISearchMarkerPtr mMarker;
+  double mDistanceFromRoute;   //!< meters from the closest point of the route
+  double mDistanceAlongRoute;  //!< meters from the route start to that closest point
+};
+
+// Receives route search results in route order; return false to stop the search.
+// Runs without the database lock held.
+typedef std::function<bool(RouteSearchMarker&& aResult)> RouteSearchCallback;
+
+// Forward declaration to allow declaration of ISearchSessionPtr
+class ISearchSession;
+typedef std::unique_ptr<ISearchSession> ISearchSessionPtr;
+
 // Forward declaration to allow declaration of IPresentationMarkerPtr
 class IPresentationMarker;
 typedef std::unique_ptr<IPresentationMarker> IPresentationMarkerPtr;
@@ -74,6 +95,50 @@ typedef std::unique_ptr<ContentViewMap> ContentViewMapPtr;
 
 enum class EnvironmentType { Test, Stage, Production };
 
+// Runs of one SQL statement since the data service was created.  Percentiles are the upper
+// bounds of power-of-two buckets, so they are within a factor of 2 of the exact value.
+struct QueryStats {
+  std::string mSql;             //!< statement text, without its bound values
+  uint64_t mCallCount;          //!< runs of the statement
+  uint64_t mRowCount;           //!< rows returned by all runs
+  uint64_t mBusyCount;          //!< times a run found the database locked
+  uint64_t mTotalMicroseconds;  //!< time spent in all runs
+  uint64_t mMaxMicroseconds;
+  uint64_t mP50Microseconds;
+  uint64_t mP95Microseconds;
+  uint64_t mP99Microseconds;
+};
+
+// Statement stats, most total time first
+typedef std::vector<QueryStats> PerformanceStats;
+
+// Acquisitions of the repository lock at one call site, with the time spent waiting for the lock
+// and holding it, while performance stats are enabled.  Percentiles are bucketed as in QueryStats.
+struct LockStats {
+  std::string mTag;  //!< call site taking the lock
+  bool mExclusive;
+  uint64_t mAcquireCount;
+  uint64_t mTotalWaitMicroseconds;
+  uint64_t mMaxWaitMicroseconds;
+  uint64_t mP50WaitMicroseconds;
+  uint64_t mP95WaitMicroseconds;
+  uint64_t mP99WaitMicroseconds;
+  uint64_t mTotalHoldMicroseconds;
+  uint64_t mMaxHoldMicroseconds;
+  uint64_t mP50HoldMicroseconds;
+  uint64_t mP95HoldMicroseconds;
+  uint64_t mP99HoldMicroseconds;
+};
+
+// Lock stats, most total hold time first
+typedef std::vector<LockStats> LockPerformanceStats;
+
+// Called with a holder that kept the repository lock longer than the threshold it was set with.
+// Runs on the holder's thread, after the lock is released.
+typedef std::function<void(const std::string& aTag, const bool aExclusive,
+                           const uint64_t aHoldMicroseconds)>
+    SlowLockHolderCallback;
+
 /*--------------------------------------------------------------------
                            PROJECT INCLUDES
 --------------------------------------------------------------------*/
@@ -0,0 +1,56 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Cancellation and deadlines for database reads.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_QueryControl_hpp
+#define ACDB_QueryControl_hpp
+
+#include <atomic>
+#include <chrono>
+
+namespace Acdb {
+//! Stops a database read early, when cancelled from another thread
+//! or when its deadline passes.  Passed to the IDataService reads,
+//! which then return false if they stopped early.
+class QueryControl {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // functions
+  QueryControl();
+
+  explicit QueryControl(const Clock::time_point aDeadline);
+
+  void Cancel();
+
+  bool IsStopped() const;
+
+ private:
+  // Variables
+  std::atomic<bool> mCancelled;
+  bool mHasDeadline;
+  Clock::time_point mDeadline;
+};  // end of class QueryControl
+
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_QueryControl_hpp
@@ -36,8 +36,19 @@ class SearchMarkerFilter {
   typedef enum : uint32_t {
     MatchBeginningOfWord,
     MatchSubstring,
+    MatchFuzzy,  //!< accent and case insensitive, tolerates typos; results ranked by match.
+                 //!< Matched as MatchSubstring until the first sync builds the search data.
   } StringMatchMode;
 
+  typedef enum : uint32_t {
+    SortNone,                   //!< unspecified order
+    SortByName,                 //!< case insensitive, A to Z
+    SortByDistance,             //!< nearest to the reference point first
+    SortByRating,               //!< highest average rating first, unreviewed markers last
+    SortByBusinessProgramTier,  //!< highest tier first
+    SortByLastUpdated,          //!< most recently updated first
+  } SortOrder;
+
   typedef enum : uint64_t {
     MarinasAndMoorings = 0x01,
     FuelStation = 0x02,
@@ -55,6 +66,40 @@ class SearchMarkerFilter {
                               // the compiler)
   } MarkerCategory;
 
+  //! Yes/no fields of the amenities, dockage, fuel, moorings, retail and services sections.  A
+  //! marker has an attribute when the field is "Yes".
+  typedef enum : uint64_t {
+    Gas = 0x01,
+    Diesel = 0x02,
+    EthanolFree = 0x04,
+    Propane = 0x08,
+    PumpOut = 0x10,
+    HasDocks = 0x20,
+    ShorePower = 0x40,
+    Liveaboard = 0x80,
+    DisabilityAccess = 0x100,
+    SecureAccess = 0x200,
+    HasMoorings = 0x400,
+    Bar = 0x800,
+    CourtesyCar = 0x1000,
+    Laundry = 0x2000,
+    Lodging = 0x4000,
+    Pets = 0x8000,
+    Restaurant = 0x10000,
+    Restroom = 0x20000,
+    Shower = 0x40000,
+    Trash = 0x80000,
+    Water = 0x100000,
+    Wifi = 0x200000,
+    FishingSupplies = 0x400000,
+    Grocery = 0x800000,
+    Ice = 0x1000000,
+    MarineRetail = 0x2000000,
+    HaulOut = 0x4000000,
+    RepairServices = 0x8000000,
+    Towing = 0x10000000,
+  } MarkerAttribute;
+
   explicit SearchMarkerFilter();
 
   SearchMarkerFilter(const bbox_type& aBbox, uint32_t aTypesBitmask,
@@ -66,6 +111,8 @@ class SearchMarkerFilter {
 
   uint64_t GetAllowedCategories() const;
 
+  uint64_t GetRequiredAttributes() const;
+
   const std::string& GetSearchString() const;
   StringMatchMode GetStringMatchMode() const;
 
@@ -75,6 +122,9 @@ class SearchMarkerFilter {
 
   void AddCategory(MarkerCategory aCategory);
 
+  // Unlike categories, markers must have every required attribute.
+  void AddRequiredAttribute(MarkerAttribute aAttribute);
+
   void SetSearchString(const std::string& aSearchString,
                        StringMatchMode aMatchMode = MatchSubstring);
 
@@ -82,14 +132,38 @@ class SearchMarkerFilter {
 
   void SetMaxResults(const int32_t aMaxResults);
 
+  SortOrder GetSortOrder() const;
+
+  const scposn_type& GetReferencePoint() const;
+
+  // Ties are ordered by marker ID.  Ignored by MatchFuzzy searches, which rank by match.
+  void SetSortOrder(SortOrder aSortOrder);
+
+  void SetReferencePoint(const scposn_type& aReferencePoint);
+
+  bool GetStartAfter(ACDB_marker_idx_type& aIdOut) const;
+
+  // Page through sorted results: return only the results after aLastResultId, the last result
+  // of the previous page.  Only used with a sort order.
+  void SetStartAfter(const ACDB_marker_idx_type aLastResultId);
+
+  void ClearStartAfter();
+
  private:
   MapMarkerFilter mBaseFilter;
   uint64_t mCategoriesBitmask = 0;
+  uint64_t mRequiredAttributesBitmask = 0;
   int32_t mMaxResults = -1;
 
   std::string mSearchString;
   StringMatchMode mStringMatchMode = MatchSubstring;
 
+  SortOrder mSortOrder = SortNone;
+  scposn_type mReferencePoint = {0, 0};
+
+  bool mHasStartAfter = false;
+  ACDB_marker_idx_type mStartAfterId = 0;
+
 };  // end of class SearchMarkerFilter
 }  // end of namespace Acdb
 
@@ -0,0 +1,86 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Timing spans of SDK requests, for finding where the time of a
+    request goes: lock waits, queries, marker building and
+    rendering.
+
+    Spans are only recorded when the SDK is built with
+    acdb_TRACING_SUPPORT and a sink is installed.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#ifndef ACDB_Tracing_hpp
+#define ACDB_Tracing_hpp
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Acdb {
+namespace Tracing {
+//! A finished span
+struct SpanEvent {
+  const char* mName;              //!< Static name of the span
+  uint32_t mThreadId;             //!< Small id of the thread, unique in the process
+  uint32_t mDepth;                //!< Spans open on the thread when this one started
+  uint64_t mStartMicroseconds;    //!< Start on a steady clock
+  uint64_t mDurationMicroseconds;
+};
+
+//! Receives the spans as they finish, from any thread
+class ISink {
+ public:
+  virtual ~ISink() = default;
+
+  virtual void OnSpan(const SpanEvent& aSpanEvent) = 0;
+};
+
+//! Collects spans and writes them in the Chrome trace event
+//! format, for chrome://tracing or Perfetto.
+class ChromeTraceSink : public ISink {
+ public:
+  // functions
+  ChromeTraceSink();
+
+  void OnSpan(const SpanEvent& aSpanEvent) override;
+
+  std::string GetJson() const;
+
+  bool WriteFile(const std::string& aFilePath) const;
+
+ private:
+  // functions
+  ChromeTraceSink(const ChromeTraceSink&) = delete;
+  ChromeTraceSink& operator=(const ChromeTraceSink&) = delete;
+
+  // Variables
+  mutable std::mutex mMutex;
+  std::vector<SpanEvent> mSpanEvents;
+};  // end of class ChromeTraceSink
+
+// Install the sink receiving spans, or nullptr to stop tracing.  The
+// sink must outlive the requests running while it is installed.
+void SetSink(ISink* aSink);
+
+}  // end of namespace Tracing
+}  // end of namespace Acdb
+
+#endif  // end of ACDB_Tracing_hpp
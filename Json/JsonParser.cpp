@@ -46,14 +46,23 @@ namespace Json {
 //!
 //----------------------------------------------------------------
 bool GetDateTimeEpoch(const rapidjson::Value& aDocument, const char* aNodeName, uint64_t& aOutput) {
-  std::string dateTimeStr;
-  if (!GetString(aDocument, aNodeName, dateTimeStr)) {
+  auto it = aDocument.FindMember(aNodeName);
+  if (it == aDocument.MemberEnd() || !it->value.IsString()) {
     // Node not present in JSON or contains invalid value.
     return false;
   }
 
+  const char* dateTimeStr = it->value.GetString();
+  const size_t dateTimeLength = it->value.GetStringLength();
+
+  // Only YYYYMMDDTHHMMSSZ_FORMAT is accepted here, so skip the millisecond layout.
+  if (dateTimeLength == 20 && NavDateTimeExtensions::Iso8601ToEpoch(
+                                  dateTimeStr, dateTimeLength, EpochType::UNIX_EPOCH, aOutput)) {
+    return true;
+  }
+
   Navionics::NavDateTime dateTime;
-  if (!dateTime.FromString(dateTimeStr, YYYYMMDDTHHMMSSZ_FORMAT)) {
+  if (!dateTime.FromString(std::string(dateTimeStr, dateTimeLength), YYYYMMDDTHHMMSSZ_FORMAT)) {
     // Invalid date format.
     return false;
   }
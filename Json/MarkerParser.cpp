@@ -648,7 +648,8 @@ static void ParseContact(const rapidjson::Value& aDocument, ContactTableDataType
 
   if (!aOutput->mAttributeFieldsJson.empty()) {
     rapidjson::Document attributeFieldsDocument;
-    attributeFieldsDocument.Parse(aOutput->mAttributeFieldsJson.c_str());
+    attributeFieldsDocument.Parse(aOutput->mAttributeFieldsJson.c_str(),
+                                  aOutput->mAttributeFieldsJson.size());
 
     if (attributeFieldsDocument.IsArray()) {
       for (auto it = attributeFieldsDocument.GetArray().begin();
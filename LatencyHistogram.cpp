@@ -0,0 +1,127 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Latency distribution in power-of-two microsecond buckets.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "Acdb/LatencyHistogram.hpp"
+
+namespace Acdb {
+
+constexpr size_t LatencyHistogram::BucketCount;
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create an empty histogram.
+//!
+//----------------------------------------------------------------
+LatencyHistogram::LatencyHistogram()
+    : mCount{0}, mTotalMicroseconds{0}, mMaxMicroseconds{0}, mBuckets{} {
+}  // end of LatencyHistogram
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Add a duration.
+//!
+//----------------------------------------------------------------
+void LatencyHistogram::Add(const uint64_t aMicroseconds) {
+  size_t bucket = 0;
+  while (bucket < BucketCount - 1 && aMicroseconds >= (UINT64_C(1) << bucket)) {
+    bucket++;
+  }
+
+  mCount++;
+  mTotalMicroseconds += aMicroseconds;
+  mMaxMicroseconds = std::max(mMaxMicroseconds, aMicroseconds);
+  mBuckets[bucket]++;
+}  // end of Add
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @return the number of durations added
+//!
+//----------------------------------------------------------------
+uint64_t LatencyHistogram::GetCount() const { return mCount; }  // end of GetCount
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @return the longest duration added
+//!
+//----------------------------------------------------------------
+uint64_t LatencyHistogram::GetMaxMicroseconds() const {
+  return mMaxMicroseconds;
+}  // end of GetMaxMicroseconds
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @return the upper bound of the bucket holding the aFraction
+//!   percentile of the durations, capped to the longest one
+//!
+//----------------------------------------------------------------
+uint64_t LatencyHistogram::GetPercentile(const double aFraction) const {
+  const uint64_t rank =
+      std::max(static_cast<uint64_t>(std::ceil(aFraction * mCount)), UINT64_C(1));
+
+  uint64_t count = 0;
+  for (size_t bucket = 0; bucket < BucketCount; bucket++) {
+    count += mBuckets[bucket];
+    if (count >= rank) {
+      return std::min(UINT64_C(1) << bucket, mMaxMicroseconds);
+    }
+  }
+
+  return mMaxMicroseconds;
+}  // end of GetPercentile
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @return the sum of the durations added
+//!
+//----------------------------------------------------------------
+uint64_t LatencyHistogram::GetTotalMicroseconds() const {
+  return mTotalMicroseconds;
+}  // end of GetTotalMicroseconds
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Add the durations of aOther.
+//!
+//----------------------------------------------------------------
+void LatencyHistogram::Merge(const LatencyHistogram& aOther) {
+  mCount += aOther.mCount;
+  mTotalMicroseconds += aOther.mTotalMicroseconds;
+  mMaxMicroseconds = std::max(mMaxMicroseconds, aOther.mMaxMicroseconds);
+
+  for (size_t bucket = 0; bucket < BucketCount; bucket++) {
+    mBuckets[bucket] += aOther.mBuckets[bucket];
+  }
+}  // end of Merge
+
+}  // end of namespace Acdb
@@ -0,0 +1,192 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Wait and hold times of the repository lock, by call site.
+
+    Tagged RwlLockers report each acquisition once they release the
+    lock, so slow holders are reported without the lock held.  The
+    stats are only recorded while enabled, like the query stats:
+    every report takes the registry mutex, which would otherwise
+    serialize the release of concurrent readers.  Lockers check
+    IsRecording first and skip timing and reporting when it is off.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#include <algorithm>
+#include <map>
+#include <string>
+
+#include "Acdb/LockStatsRegistry.hpp"
+
+namespace Acdb {
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create an empty, disabled registry, without a slow
+//!   holder callback.
+//!
+//----------------------------------------------------------------
+LockStatsRegistry::LockStatsRegistry()
+    : mEnabled{false},
+      mHasSlowHolderCallback{false},
+      mSlowHolderThresholdMicroseconds{0},
+      mSlowHolderCallback{} {}  // end of LockStatsRegistry
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get a snapshot of the stats of every call site that
+//!   took the lock so far.
+//!
+//----------------------------------------------------------------
+LockPerformanceStats LockStatsRegistry::GetStats() const {
+  std::map<std::string, Entry> entries;
+
+  {
+    std::lock_guard<std::mutex> lock{mMutex};
+
+    for (const auto& it : mEntries) {
+      auto entryIt = entries.find(it.first);
+      if (entryIt == entries.end()) {
+        entries.emplace(it.first, it.second);
+      } else {
+        entryIt->second.mWait.Merge(it.second.mWait);
+        entryIt->second.mHold.Merge(it.second.mHold);
+      }
+    }
+  }
+
+  LockPerformanceStats result;
+  result.reserve(entries.size());
+
+  for (const auto& it : entries) {
+    const Entry& entry = it.second;
+
+    LockStats stats;
+    stats.mTag = it.first;
+    stats.mExclusive = entry.mExclusive;
+    stats.mAcquireCount = entry.mHold.GetCount();
+    stats.mTotalWaitMicroseconds = entry.mWait.GetTotalMicroseconds();
+    stats.mMaxWaitMicroseconds = entry.mWait.GetMaxMicroseconds();
+    stats.mP50WaitMicroseconds = entry.mWait.GetPercentile(0.50);
+    stats.mP95WaitMicroseconds = entry.mWait.GetPercentile(0.95);
+    stats.mP99WaitMicroseconds = entry.mWait.GetPercentile(0.99);
+    stats.mTotalHoldMicroseconds = entry.mHold.GetTotalMicroseconds();
+    stats.mMaxHoldMicroseconds = entry.mHold.GetMaxMicroseconds();
+    stats.mP50HoldMicroseconds = entry.mHold.GetPercentile(0.50);
+    stats.mP95HoldMicroseconds = entry.mHold.GetPercentile(0.95);
+    stats.mP99HoldMicroseconds = entry.mHold.GetPercentile(0.99);
+
+    result.push_back(std::move(stats));
+  }
+
+  std::sort(result.begin(), result.end(), [](const LockStats& aLhs, const LockStats& aRhs) {
+    return aLhs.mTotalHoldMicroseconds > aRhs.mTotalHoldMicroseconds;
+  });
+
+  return result;
+}  // end of GetStats
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Check whether acquisitions are wanted, either for the
+//!   stats or for the slow holder callback, without locking.
+//!
+//----------------------------------------------------------------
+bool LockStatsRegistry::IsRecording() const {
+  return mEnabled.load(std::memory_order_relaxed) ||
+         mHasSlowHolderCallback.load(std::memory_order_relaxed);
+}  // end of IsRecording
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Add a released acquisition of the lock by the call
+//!   site aTag if enabled, and report it if it was held too long.
+//!   aTag must outlive the registry, as string literals do.
+//!
+//----------------------------------------------------------------
+void LockStatsRegistry::Record(const char* aTag, const bool aExclusive,
+                               const uint64_t aWaitMicroseconds,
+                               const uint64_t aHoldMicroseconds) {
+  const bool enabled = mEnabled.load(std::memory_order_relaxed);
+  const bool slow = mHasSlowHolderCallback.load(std::memory_order_relaxed) &&
+                    aHoldMicroseconds >= mSlowHolderThresholdMicroseconds.load();
+  if (!enabled && !slow) {
+    return;
+  }
+
+  SlowLockHolderCallback slowHolderCallback;
+
+  {
+    std::lock_guard<std::mutex> lock{mMutex};
+
+    if (enabled) {
+      auto it = mEntries.find(aTag);
+      if (it == mEntries.end()) {
+        it = mEntries.emplace(aTag, Entry{aExclusive, LatencyHistogram(), LatencyHistogram()})
+                 .first;
+      }
+
+      Entry& entry = it->second;
+      entry.mWait.Add(aWaitMicroseconds);
+      entry.mHold.Add(aHoldMicroseconds);
+    }
+
+    if (slow) {
+      slowHolderCallback = mSlowHolderCallback;
+    }
+  }
+
+  // The callback may take its time; don't hold up the other holders reporting meanwhile.
+  if (slowHolderCallback) {
+    slowHolderCallback(aTag, aExclusive, aHoldMicroseconds);
+  }
+}  // end of Record
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Start or stop adding acquisitions to the stats.  The
+//!   stats recorded so far are kept.
+//!
+//----------------------------------------------------------------
+void LockStatsRegistry::SetEnabled(const bool aEnabled) {
+  mEnabled = aEnabled;
+}  // end of SetEnabled
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Report the holders keeping the lock for at least
+//!   aThresholdMicroseconds to aCallback; an empty callback stops
+//!   the reports.  Reports do not need the stats to be enabled.
+//!
+//----------------------------------------------------------------
+void LockStatsRegistry::SetSlowHolderCallback(const uint64_t aThresholdMicroseconds,
+                                              SlowLockHolderCallback aCallback) {
+  std::lock_guard<std::mutex> lock{mMutex};
+  mSlowHolderThresholdMicroseconds = aThresholdMicroseconds;
+  mHasSlowHolderCallback = static_cast<bool>(aCallback);
+  mSlowHolderCallback = std::move(aCallback);
+}  // end of SetSlowHolderCallback
+
+}  // end of namespace Acdb
@@ -0,0 +1,150 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Marker attributes indexed for search filters.
+
+    The yes/no fields of the marker sections are stored as JSON
+    arrays of { "fieldTextHandle": ..., "value": ... } objects.  The
+    field text handles are the same in every section, so each one
+    maps to a single SearchMarkerFilter::MarkerAttribute bit.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "MarkerAttributes"
+
+#include <utility>
+
+#include "Acdb/MarkerAttributes.hpp"
+#include "Acdb/SearchMarkerFilter.hpp"
+#include "Acdb/StringUtil.hpp"
+#include "Acdb/TextHandle.hpp"
+#include "DBG_pub.h"
+#include "rapidjson/document.h"
+
+namespace Acdb {
+namespace MarkerAttributes {
+
+//! Field text handle of each attribute
+static const std::pair<TextHandle, SearchMarkerFilter::MarkerAttribute> AttributeFields[] = {
+    {TextHandle::GasLabel, SearchMarkerFilter::Gas},
+    {TextHandle::DieselLabel, SearchMarkerFilter::Diesel},
+    {TextHandle::EthanolFreeLabel, SearchMarkerFilter::EthanolFree},
+    {TextHandle::PropaneLabel, SearchMarkerFilter::Propane},
+    {TextHandle::PumpOutLabel, SearchMarkerFilter::PumpOut},
+    {TextHandle::HasDocksLabel, SearchMarkerFilter::HasDocks},
+    {TextHandle::ShorePowerLabel, SearchMarkerFilter::ShorePower},
+    {TextHandle::LiveaboardLabel, SearchMarkerFilter::Liveaboard},
+    {TextHandle::DisabilityAccessLabel, SearchMarkerFilter::DisabilityAccess},
+    {TextHandle::SecureAccessLabel, SearchMarkerFilter::SecureAccess},
+    {TextHandle::HasMooringsLabel, SearchMarkerFilter::HasMoorings},
+    {TextHandle::BarLabel, SearchMarkerFilter::Bar},
+    {TextHandle::CourtesyCarLabel, SearchMarkerFilter::CourtesyCar},
+    {TextHandle::LaundryLabel, SearchMarkerFilter::Laundry},
+    {TextHandle::LodgingLabel, SearchMarkerFilter::Lodging},
+    {TextHandle::PetsLabel, SearchMarkerFilter::Pets},
+    {TextHandle::RestaurantLabel, SearchMarkerFilter::Restaurant},
+    {TextHandle::RestroomLabel, SearchMarkerFilter::Restroom},
+    {TextHandle::ShowerLabel, SearchMarkerFilter::Shower},
+    {TextHandle::TrashLabel, SearchMarkerFilter::Trash},
+    {TextHandle::WaterLabel, SearchMarkerFilter::Water},
+    {TextHandle::WifiLabel, SearchMarkerFilter::Wifi},
+    {TextHandle::FishingSuppliesLabel, SearchMarkerFilter::FishingSupplies},
+    {TextHandle::GroceryLabel, SearchMarkerFilter::Grocery},
+    {TextHandle::IceLabel, SearchMarkerFilter::Ice},
+    {TextHandle::MarineRetailLabel, SearchMarkerFilter::MarineRetail},
+    {TextHandle::HaulOutLabel, SearchMarkerFilter::HaulOut},
+    {TextHandle::RepairLabel, SearchMarkerFilter::RepairServices},
+    {TextHandle::TowingLabel, SearchMarkerFilter::Towing}};
+
+static uint64_t GetAttribute(const int aFieldTextHandle);
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the attributes of a yes/no fields JSON array of
+//!   aLength bytes, which need not be null-terminated: the
+//!   attributes of the fields whose value is "Yes".
+//!
+//----------------------------------------------------------------
+uint64_t GetAttributes(const char* aYesNoJson, const size_t aLength) {
+  if (aLength == 0) {
+    return 0;
+  }
+
+  rapidjson::Document document;
+  document.Parse(aYesNoJson, aLength);
+
+  uint64_t attributes = 0;
+
+  if (document.IsArray()) {
+    for (auto& fieldDocument : document.GetArray()) {
+      if (!fieldDocument.IsObject()) {
+        continue;
+      }
+
+      auto fieldTextHandleIterator = fieldDocument.FindMember("fieldTextHandle");
+      auto valueIterator = fieldDocument.FindMember("value");
+      if (fieldTextHandleIterator == fieldDocument.MemberEnd() ||
+          !fieldTextHandleIterator->value.IsInt() || valueIterator == fieldDocument.MemberEnd() ||
+          !valueIterator->value.IsString()) {
+        continue;
+      }
+
+      if (String::ToLower(valueIterator->value.GetString()) == "yes") {
+        attributes |= GetAttribute(fieldTextHandleIterator->value.GetInt());
+      }
+    }
+  } else {
+    DBG_W("Unexpected yes/no fields: %.*s", static_cast<int>(aLength), aYesNoJson);
+  }
+
+  return attributes;
+}  // end of GetAttributes
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the attributes of a yes/no fields JSON array.
+//!
+//----------------------------------------------------------------
+uint64_t GetAttributes(const std::string& aYesNoJson) {
+  return GetAttributes(aYesNoJson.data(), aYesNoJson.size());
+}  // end of GetAttributes
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get the attribute of a field.
+//!
+//!   @return 0 if the field is not indexed
+//!
+//----------------------------------------------------------------
+static uint64_t GetAttribute(const int aFieldTextHandle) {
+  for (const auto& attributeField : AttributeFields) {
+    if (static_cast<int>(attributeField.first) == aFieldTextHandle) {
+      return attributeField.second;
+    }
+  }
+
+  return 0;
+}  // end of GetAttribute
+
+}  // end of namespace MarkerAttributes
+}  // end of namespace Acdb
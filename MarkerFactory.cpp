@@ -37,8 +37,6 @@ limitations under the License.
 #include "Acdb/TextTranslator.hpp"
 
 namespace Acdb {
-static MapIconType GetMapIcon(ACDB_type_type aMarkerType, int aBusinessProgramTier);
-
 static constexpr int MinBusinessProgramIconTier =
     2;  // Program tiers 2 and above receive special icons.
 
@@ -93,6 +91,22 @@ MapMarkerPtr GetMapMarker(MarkerTableDataType& aMarkerData) {
   return marker;
 }  // End of GetMapMarker
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Creates a MapMarker from a marker of a bulk read.
+//!   @return pointer to a MapMarker object
+//!
+//----------------------------------------------------------------
+MapMarkerPtr GetMapMarker(const MapMarkerColumns::Row& aMarkerRow) {
+  const scposn_type posn = aMarkerRow.GetPosition();
+
+  return MapMarkerPtr(new MapMarker(aMarkerRow.GetId(), aMarkerRow.GetType(),
+                                    aMarkerRow.GetLastUpdated(), aMarkerRow.GetName(), posn.lat,
+                                    posn.lon, aMarkerRow.GetMapIcon()));
+}  // End of GetMapMarker
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -108,12 +122,13 @@ SearchMarkerPtr GetSearchMarker(MarkerTableDataType& aMarkerData) {
   MapIconType mapIcon = GetMapIcon(aMarkerData.mType, aMarkerData.mBusinessProgramTier);
 
   TextHandle markerTypeTextHandle = GetMarkerTypeTextHandle(aMarkerData.mType);
-  std::string localizedType =
-      TextTranslator::GetInstance().Find(static_cast<ACDB_text_handle_type>(markerTypeTextHandle));
+  // Translations are pooled, so every marker of a type shares its localized type.
+  const std::string* localizedType = &TextTranslator::GetInstance().Lookup(
+      static_cast<ACDB_text_handle_type>(markerTypeTextHandle));
 
   auto marker = SearchMarkerPtr(new SearchMarker(
       aMarkerData.mId, aMarkerData.mType, aMarkerData.mLastUpdated, std::move(aMarkerData.mName),
-      aMarkerData.mPosn.lat, aMarkerData.mPosn.lon, mapIcon, std::move(localizedType)));
+      aMarkerData.mPosn.lat, aMarkerData.mPosn.lon, mapIcon, localizedType));
 
   return marker;
 }  // End of GetSearchMarker
@@ -133,27 +148,28 @@ SearchMarkerPtr GetSearchMarker(ExtendedMarkerDataType& aMarkerData) {
   MapIconType mapIcon = GetMapIcon(aMarkerData.mType, aMarkerData.mBusinessProgramTier);
 
   TextHandle markerTypeTextHandle = GetMarkerTypeTextHandle(aMarkerData.mType);
-  std::string localizedType =
-      TextTranslator::GetInstance().Find(static_cast<ACDB_text_handle_type>(markerTypeTextHandle));
+  // Translations are pooled, so every marker of a type shares its localized type.
+  const std::string* localizedType = &TextTranslator::GetInstance().Lookup(
+      static_cast<ACDB_text_handle_type>(markerTypeTextHandle));
 
   auto marker = SearchMarkerPtr(new SearchMarker(
       aMarkerData.mId, aMarkerData.mType, aMarkerData.mLastUpdated, std::move(aMarkerData.mName),
       aMarkerData.mPosn.lat, aMarkerData.mPosn.lon, mapIcon, std::move(aMarkerData.mContactData),
       std::move(aMarkerData.mFuelData), std::move(aMarkerData.mReviewStatsData),
-      std::move(localizedType)));
+      localizedType));
 
   return marker;
 }  // End of GetSearchMarker
 
 //----------------------------------------------------------------
 //!
-//!   @private
+//!   @public
 //!   @detail
 //!         Determine map icon for the given marker object.
 //!   @return MapIconType object
 //!
 //----------------------------------------------------------------
-static MapIconType GetMapIcon(ACDB_type_type aMarkerType, int aBusinessProgramTier) {
+MapIconType GetMapIcon(ACDB_type_type aMarkerType, int aBusinessProgramTier) {
   static const std::map<ACDB_type_type, MapIconType> markerTypeDefaultMapIcons = {
       {ACDB_UNKNOWN_TYPE, MapIconType::Unknown},
       {ACDB_ANCHORAGE, MapIconType::Anchorage},
@@ -0,0 +1,442 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+
+/**
+    @file
+    Read-only snapshot of the map markers and of one language's
+    translations, memory-mapped at startup.
+
+    The file is a header, the record index of each grid cell, the
+    marker records sorted by cell, the marker names, then the
+    translation records and their text.  Sections are aligned to 8
+    bytes and written in the native byte order: the file is a cache
+    of the database on the same device, rebuilt whenever it does not
+    match.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "MarkerSnapshot"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "Acdb/FileUtil.hpp"
+#include "Acdb/MarkerSnapshot.hpp"
+#include "Acdb/Queries/BboxClause.hpp"
+#include "DBG_pub.h"
+
+namespace Acdb {
+
+//! "ACMS", to tell snapshot files from anything else
+static const uint32_t Magic = 0x534D4341;
+
+//! Incremented whenever the file layout changes
+static const uint32_t FormatVersion = 1;
+
+static const size_t VersionSize = 32;
+static const size_t LanguageSize = 16;
+
+struct MarkerSnapshot::Header {
+  uint32_t mMagic;
+  uint32_t mFormatVersion;
+  char mVersion[VersionSize];    //!< database version, null-terminated
+  char mLanguage[LanguageSize];  //!< language of the translations, null-terminated
+  uint64_t mMarkerLastUpdate;
+  uint32_t mMarkerCount;
+  uint32_t mNameBytes;
+  uint32_t mTranslationCount;
+  uint32_t mTranslationBytes;
+};
+
+//! Offsets of the sections of a file, and its size
+struct MarkerSnapshot::Layout {
+  size_t mCellOffsets;
+  size_t mMarkers;
+  size_t mNames;
+  size_t mTranslations;
+  size_t mTranslationText;
+  size_t mSize;
+};
+
+struct MarkerSnapshot::MarkerRecord {
+  uint64_t mId;
+  uint64_t mLastUpdated;
+  int32_t mLat;
+  int32_t mLon;
+  int32_t mType;
+  int32_t mMapIcon;
+  uint32_t mNameOffset;
+  uint32_t mNameLength;
+};
+
+struct MarkerSnapshot::TranslationRecord {
+  int32_t mId;
+  uint32_t mTextOffset;
+  uint32_t mTextLength;
+};
+
+static size_t Align(const size_t aOffset);
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Wrap a mapped file that Open() has validated.
+//!
+//----------------------------------------------------------------
+MarkerSnapshot::MarkerSnapshot(const char* aData, const uint64_t aSize)
+    : mData(aData),
+      mSize(aSize),
+      mHeader(reinterpret_cast<const Header*>(aData)),
+      mCellOffsets(),
+      mMarkers(),
+      mNames(),
+      mTranslations(),
+      mTranslationText() {
+  const Layout layout = GetLayout(*mHeader);
+
+  mCellOffsets = reinterpret_cast<const uint32_t*>(mData + layout.mCellOffsets);
+  mMarkers = reinterpret_cast<const MarkerRecord*>(mData + layout.mMarkers);
+  mNames = mData + layout.mNames;
+  mTranslations = reinterpret_cast<const TranslationRecord*>(mData + layout.mTranslations);
+  mTranslationText = mData + layout.mTranslationText;
+}  // end of MarkerSnapshot
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Unmap the file.
+//!
+//----------------------------------------------------------------
+MarkerSnapshot::~MarkerSnapshot() { FileUtil::Unmap(mData, mSize); }  // end of ~MarkerSnapshot
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return number of markers in the snapshot
+//!
+//----------------------------------------------------------------
+size_t MarkerSnapshot::GetMarkerCount() const {
+  return mHeader->mMarkerCount;
+}  // end of GetMarkerCount
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the markers matching the filter, as
+//!   MarkerQuery::GetFiltered() would: strictly inside the
+//!   bounding box and of an allowed type.
+//!
+//----------------------------------------------------------------
+void MarkerSnapshot::GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
+                                           MapMarkerColumns& aResults) const {
+  const uint32_t allowedTypes = aFilter.GetAllowedTypes();
+
+  for (const bbox_type& part : BboxClause::GetParts(aFilter.GetBbox())) {
+    const uint32_t firstColumn = GetCell(part.swc.lon);
+    const uint32_t lastColumn = GetCell(part.nec.lon);
+    if (lastColumn < firstColumn) {
+      continue;
+    }
+
+    for (uint32_t row = GetCell(part.swc.lat); row <= GetCell(part.nec.lat); row++) {
+      // The cells of a row are contiguous, so its part of the box is one run of records.
+      const uint32_t* rowOffsets = mCellOffsets + row * GridSize;
+
+      for (uint32_t i = rowOffsets[firstColumn]; i < rowOffsets[lastColumn + 1]; i++) {
+        const MarkerRecord& marker = mMarkers[i];
+
+        if (marker.mLon > part.swc.lon && marker.mLon < part.nec.lon &&
+            marker.mLat > part.swc.lat && marker.mLat < part.nec.lat &&
+            (static_cast<uint32_t>(marker.mType) & allowedTypes) != 0 &&
+            marker.mNameOffset <= mHeader->mNameBytes &&
+            marker.mNameLength <= mHeader->mNameBytes - marker.mNameOffset) {
+          scposn_type posn;
+          posn.lat = marker.mLat;
+          posn.lon = marker.mLon;
+
+          aResults.Add(marker.mId, marker.mType, marker.mLastUpdated, mNames + marker.mNameOffset,
+                       marker.mNameLength, posn, static_cast<MapIconType>(marker.mMapIcon));
+        }
+      }
+    }
+  }
+}  // end of GetMapMarkersByFilter
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the translations of aLanguage, if they are the
+//!   ones in the snapshot.
+//!
+//!   @return false if the snapshot has no translations for
+//!   aLanguage
+//!
+//----------------------------------------------------------------
+bool MarkerSnapshot::GetTranslations(const std::string& aLanguage,
+                                     std::vector<TranslationDataType>& aTranslationsOut) const {
+  if (aLanguage.empty() || aLanguage != mHeader->mLanguage || mHeader->mTranslationCount == 0) {
+    return false;
+  }
+
+  aTranslationsOut.reserve(aTranslationsOut.size() + mHeader->mTranslationCount);
+
+  for (uint32_t i = 0; i < mHeader->mTranslationCount; i++) {
+    const TranslationRecord& translation = mTranslations[i];
+
+    if (translation.mTextOffset <= mHeader->mTranslationBytes &&
+        translation.mTextLength <= mHeader->mTranslationBytes - translation.mTextOffset) {
+      aTranslationsOut.emplace_back(
+          translation.mId,
+          std::string(mTranslationText + translation.mTextOffset, translation.mTextLength));
+    }
+  }
+
+  return true;
+}  // end of GetTranslations
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Map the snapshot at aPath, if it was written for
+//!   the database version and marker update time given.  Reviews
+//!   are not part of the snapshot, so their update time is not
+//!   checked.
+//!
+//!   @return the snapshot, or nullptr if the file is missing or
+//!   does not match
+//!
+//----------------------------------------------------------------
+std::unique_ptr<MarkerSnapshot> MarkerSnapshot::Open(const std::string& aPath,
+                                                     const Version& aVersion,
+                                                     const LastUpdateInfoType& aLastUpdateInfo) {
+  uint64_t size = 0;
+  const char* data = FileUtil::MapReadOnly(aPath, size);
+  if (data == nullptr) {
+    return nullptr;
+  }
+
+  std::unique_ptr<MarkerSnapshot> snapshot;
+
+  bool valid = size >= sizeof(Header);
+  if (valid) {
+    const Header& header = *reinterpret_cast<const Header*>(data);
+
+    valid = header.mMagic == Magic && header.mFormatVersion == FormatVersion &&
+            header.mVersion[VersionSize - 1] == '\0' &&
+            header.mLanguage[LanguageSize - 1] == '\0' &&
+            aVersion.ToString() == header.mVersion &&
+            aLastUpdateInfo.mMarkerLastUpdate == header.mMarkerLastUpdate &&
+            GetLayout(header).mSize == size;
+  }
+
+  if (valid) {
+    snapshot.reset(new MarkerSnapshot(data, size));
+
+    // Cell runs must stay within the records; the records themselves are checked as read.
+    const uint32_t* cellOffsets = snapshot->mCellOffsets;
+    valid = cellOffsets[0] == 0 && cellOffsets[CellCount] == snapshot->mHeader->mMarkerCount;
+    for (uint32_t cell = 0; valid && cell < CellCount; cell++) {
+      valid = cellOffsets[cell] <= cellOffsets[cell + 1];
+    }
+  } else {
+    FileUtil::Unmap(data, size);
+  }
+
+  if (!valid) {
+    DBG_I("Marker snapshot '%s' does not match the database.", aPath.c_str());
+    return nullptr;
+  }
+
+  return snapshot;
+}  // end of Open
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Write a snapshot of aMarkers, and of the
+//!   translations of aLanguage if it is not empty, for the
+//!   database version and update time given.
+//!
+//----------------------------------------------------------------
+bool MarkerSnapshot::Write(const std::string& aPath, const Version& aVersion,
+                           const LastUpdateInfoType& aLastUpdateInfo,
+                           const MapMarkerColumns& aMarkers, const std::string& aLanguage,
+                           const std::vector<TranslationDataType>& aTranslations) {
+  const std::string version = aVersion.ToString();
+  const bool hasLanguage = !aLanguage.empty() && aLanguage.size() < LanguageSize;
+  if (version.size() >= VersionSize) {
+    return false;
+  }
+
+  Header header;
+  std::memset(&header, 0, sizeof(header));
+  header.mMagic = Magic;
+  header.mFormatVersion = FormatVersion;
+  std::memcpy(header.mVersion, version.c_str(), version.size());
+  header.mMarkerLastUpdate = aLastUpdateInfo.mMarkerLastUpdate;
+  header.mMarkerCount = static_cast<uint32_t>(aMarkers.Size());
+
+  uint64_t nameBytes = 0;
+  for (const MapMarkerColumns::Row& row : aMarkers) {
+    nameBytes += std::strlen(row.GetName());
+  }
+
+  uint64_t translationBytes = 0;
+  if (hasLanguage) {
+    std::memcpy(header.mLanguage, aLanguage.c_str(), aLanguage.size());
+    header.mTranslationCount = static_cast<uint32_t>(aTranslations.size());
+
+    for (const TranslationDataType& translation : aTranslations) {
+      translationBytes += translation.second.size();
+    }
+  }
+
+  // Sizes and offsets are 32 bits, like the file writes.
+  const uint64_t MaxBytes = std::numeric_limits<uint32_t>::max() / 2;
+  if (aMarkers.Size() * sizeof(MarkerRecord) + nameBytes + translationBytes > MaxBytes) {
+    DBG_W("Too many markers for a snapshot.");
+    return false;
+  }
+
+  header.mNameBytes = static_cast<uint32_t>(nameBytes);
+  header.mTranslationBytes = static_cast<uint32_t>(translationBytes);
+
+  const Layout layout = GetLayout(header);
+  std::string buffer(layout.mSize, '\0');
+  char* data = &buffer[0];
+
+  std::memcpy(data, &header, sizeof(header));
+
+  // Order the markers by cell, then by id so that rewriting the same markers gives the same file.
+  std::vector<uint32_t> cells;
+  std::vector<uint32_t> order;
+  cells.reserve(aMarkers.Size());
+  order.reserve(aMarkers.Size());
+  for (const MapMarkerColumns::Row& row : aMarkers) {
+    const scposn_type posn = row.GetPosition();
+    order.push_back(static_cast<uint32_t>(cells.size()));
+    cells.push_back(GetCell(posn.lat) * GridSize + GetCell(posn.lon));
+  }
+
+  std::sort(order.begin(), order.end(), [&](const uint32_t aLhs, const uint32_t aRhs) {
+    return cells[aLhs] != cells[aRhs] ? cells[aLhs] < cells[aRhs]
+                                      : aMarkers[aLhs].GetId() < aMarkers[aRhs].GetId();
+  });
+
+  uint32_t* cellOffsets = reinterpret_cast<uint32_t*>(data + layout.mCellOffsets);
+  MarkerRecord* markers = reinterpret_cast<MarkerRecord*>(data + layout.mMarkers);
+  char* names = data + layout.mNames;
+
+  uint32_t nameOffset = 0;
+  uint32_t cell = 0;
+  for (uint32_t i = 0; i < order.size(); i++) {
+    const MapMarkerColumns::Row row = aMarkers[order[i]];
+
+    for (; cell <= cells[order[i]]; cell++) {
+      cellOffsets[cell] = i;
+    }
+
+    const scposn_type posn = row.GetPosition();
+    const uint32_t nameLength = static_cast<uint32_t>(std::strlen(row.GetName()));
+
+    MarkerRecord& marker = markers[i];
+    marker.mId = row.GetId();
+    marker.mLastUpdated = row.GetLastUpdated();
+    marker.mLat = posn.lat;
+    marker.mLon = posn.lon;
+    marker.mType = row.GetType();
+    marker.mMapIcon = static_cast<int32_t>(row.GetMapIcon());
+    marker.mNameOffset = nameOffset;
+    marker.mNameLength = nameLength;
+
+    std::memcpy(names + nameOffset, row.GetName(), nameLength);
+    nameOffset += nameLength;
+  }
+
+  for (; cell <= CellCount; cell++) {
+    cellOffsets[cell] = header.mMarkerCount;
+  }
+
+  if (hasLanguage) {
+    TranslationRecord* translations =
+        reinterpret_cast<TranslationRecord*>(data + layout.mTranslations);
+    char* translationText = data + layout.mTranslationText;
+
+    uint32_t textOffset = 0;
+    for (size_t i = 0; i < aTranslations.size(); i++) {
+      const std::string& text = aTranslations[i].second;
+
+      translations[i].mId = aTranslations[i].first;
+      translations[i].mTextOffset = textOffset;
+      translations[i].mTextLength = static_cast<uint32_t>(text.size());
+
+      std::memcpy(translationText + textOffset, text.data(), text.size());
+      textOffset += static_cast<uint32_t>(text.size());
+    }
+  }
+
+  return FileUtil::Write(aPath, buffer.data(), static_cast<uint32_t>(buffer.size()));
+}  // end of Write
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get the grid row of a latitude or the grid column of
+//!   a longitude.  The order of the coordinates is kept, so a
+//!   range of coordinates is a range of rows or columns.
+//!
+//----------------------------------------------------------------
+uint32_t MarkerSnapshot::GetCell(const int32_t aCoordinate) {
+  return (static_cast<uint32_t>(aCoordinate) ^ 0x80000000u) >> (32 - GridBits);
+}  // end of GetCell
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get the layout of a file from its header.
+//!
+//----------------------------------------------------------------
+MarkerSnapshot::Layout MarkerSnapshot::GetLayout(const Header& aHeader) {
+  Layout layout;
+  layout.mCellOffsets = Align(sizeof(Header));
+  layout.mMarkers = Align(layout.mCellOffsets + (CellCount + 1) * sizeof(uint32_t));
+  layout.mNames = layout.mMarkers + aHeader.mMarkerCount * sizeof(MarkerRecord);
+  layout.mTranslations = Align(layout.mNames + aHeader.mNameBytes);
+  layout.mTranslationText =
+      layout.mTranslations + aHeader.mTranslationCount * sizeof(TranslationRecord);
+  layout.mSize = layout.mTranslationText + aHeader.mTranslationBytes;
+
+  return layout;
+}  // end of GetLayout
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Round an offset up to the alignment of the sections.
+//!
+//----------------------------------------------------------------
+static size_t Align(const size_t aOffset) {
+  const size_t Alignment = 8;
+  return (aOffset + Alignment - 1) / Alignment * Alignment;
+}  // end of Align
+
+}  // end of namespace Acdb
@@ -0,0 +1,220 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+
+/**
+    @file
+    Monotonic arena for the objects built to serve one request.
+
+    An ArenaObject is prefixed with the arena it came from, or null
+    if it came from the heap, so that deleting it frees heap memory
+    only.  The arena counts its live objects, so that one kept past
+    the request, which would point into freed memory, is caught when
+    the arena is destroyed.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "MonotonicArena"
+
+#include <algorithm>
+
+#include "Acdb/MonotonicArena.hpp"
+#include "DBG_pub.h"
+
+namespace Acdb {
+
+constexpr size_t MonotonicArena::DefaultBlockSize;
+
+//! Alignment of every allocation
+static const size_t Alignment = alignof(std::max_align_t);
+
+//! Size of the prefix of an ArenaObject, keeping the object aligned
+static const size_t HeaderSize =
+    (sizeof(MonotonicArena*) + Alignment - 1) / Alignment * Alignment;
+
+//! Arena of the innermost ArenaScope on this thread
+static thread_local MonotonicArena* CurrentArena = nullptr;
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create an empty arena, which allocates its blocks
+//!   aBlockSize bytes at a time.
+//!
+//----------------------------------------------------------------
+MonotonicArena::MonotonicArena(const size_t aBlockSize)
+    : mBlockSize{aBlockSize},
+      mNext{nullptr},
+      mRemaining{0},
+      mAllocationCount{0},
+      mBytesAllocated{0},
+      mLiveObjectCount{0} {}  // end of MonotonicArena
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Free every block.  The ArenaObjects allocated from the
+//!   arena must all have been deleted.
+//!
+//----------------------------------------------------------------
+MonotonicArena::~MonotonicArena() {
+  DBG_ASSERT(mLiveObjectCount == 0, "ArenaObjects outlive their arena.");
+}  // end of ~MonotonicArena
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Allocate aSize bytes, aligned for any type.  A request
+//!   larger than the block size gets a block of its own.
+//!
+//----------------------------------------------------------------
+void* MonotonicArena::Allocate(const size_t aSize) {
+  const size_t size = (std::max(aSize, size_t{1}) + Alignment - 1) / Alignment * Alignment;
+
+  if (size > mRemaining) {
+    const size_t blockSize = std::max(mBlockSize, size);
+    mBlocks.emplace_back(new char[blockSize]);
+    mNext = mBlocks.back().get();
+    mRemaining = blockSize;
+  }
+
+  void* result = mNext;
+  mNext += size;
+  mRemaining -= size;
+
+  mAllocationCount++;
+  mBytesAllocated += size;
+
+  return result;
+}  // end of Allocate
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the number of allocations served so far.
+//!
+//----------------------------------------------------------------
+size_t MonotonicArena::GetAllocationCount() const {
+  return mAllocationCount;
+}  // end of GetAllocationCount
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the number of blocks taken from the heap so far.
+//!
+//----------------------------------------------------------------
+size_t MonotonicArena::GetBlockCount() const {
+  return mBlocks.size();
+}  // end of GetBlockCount
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the bytes handed out so far, padding included.
+//!
+//----------------------------------------------------------------
+size_t MonotonicArena::GetBytesAllocated() const {
+  return mBytesAllocated;
+}  // end of GetBytesAllocated
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the number of ArenaObjects allocated from the
+//!   arena and not yet deleted.
+//!
+//----------------------------------------------------------------
+size_t MonotonicArena::GetLiveObjectCount() const {
+  return mLiveObjectCount;
+}  // end of GetLiveObjectCount
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Allocate ArenaObjects from aArena on this thread.
+//!
+//----------------------------------------------------------------
+ArenaScope::ArenaScope(MonotonicArena& aArena) : mPrevious{CurrentArena} {
+  CurrentArena = &aArena;
+}  // end of ArenaScope
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Restore the arena of the enclosing scope, if any.
+//!
+//----------------------------------------------------------------
+ArenaScope::~ArenaScope() {
+  CurrentArena = mPrevious;
+}  // end of ~ArenaScope
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the arena of the innermost scope on this thread.
+//!
+//!   @return the arena, or nullptr outside of any scope
+//!
+//----------------------------------------------------------------
+MonotonicArena* ArenaScope::GetCurrent() {
+  return CurrentArena;
+}  // end of GetCurrent
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Allocate an object from the current arena, or from
+//!   the heap outside of any scope.
+//!
+//----------------------------------------------------------------
+void* ArenaObject::operator new(const size_t aSize) {
+  MonotonicArena* arena = CurrentArena;
+  void* block = arena != nullptr ? arena->Allocate(HeaderSize + aSize)
+                                 : ::operator new(HeaderSize + aSize);
+
+  if (arena != nullptr) {
+    arena->mLiveObjectCount++;
+  }
+
+  *static_cast<MonotonicArena**>(block) = arena;
+  return static_cast<char*>(block) + HeaderSize;
+}  // end of operator new
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Free an object allocated from the heap; arena memory
+//!   is left to its arena.
+//!
+//----------------------------------------------------------------
+void ArenaObject::operator delete(void* aPtr) {
+  if (aPtr == nullptr) {
+    return;
+  }
+
+  void* block = static_cast<char*>(aPtr) - HeaderSize;
+  MonotonicArena* arena = *static_cast<MonotonicArena**>(block);
+  if (arena == nullptr) {
+    ::operator delete(block);
+  } else {
+    arena->mLiveObjectCount--;
+  }
+}  // end of operator delete
+
+}  // end of namespace Acdb
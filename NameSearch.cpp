@@ -0,0 +1,436 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Marker name normalization and fuzzy matching.
+
+    Names are normalized to lower case words without diacritics,
+    separated by single spaces.  Each word, padded with a space on
+    both ends, is indexed by its trigrams (three consecutive code
+    points); a query finds candidates by shared trigrams and ranks
+    them by edit distance.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#include <algorithm>
+#include "Acdb/NameSearch.hpp"
+
+namespace Acdb {
+namespace NameSearch {
+
+//! Base letters of U+00C0 to U+00FF; ' ' for the multiplication and division signs
+static const char Latin1Folding[] =
+    "aaaaaa ceeeeiiiidnooooo ouuuuy  aaaaaa ceeeeiiiidnooooo ouuuuy y";
+
+//! Base letters of U+0100 to U+017F
+static const char LatinExtendedAFolding[] =
+    "aaaaaaccccccccddddeeeeeeeeeegggggggghhhhiiiiiiiiii  jjkkklllllll"
+    "lllnnnnnnnnnoooooo  rrrrrrssssssssttttttuuuuuuuuuuuuwwyyyzzzzzzs";
+
+static const char32_t WordSeparator = ' ';
+
+static bool DecodeUtf8(const std::string& aStr, size_t& aPos, char32_t& aCodePointOut);
+
+static void EncodeUtf8(const char32_t aCodePoint, std::string& aStrOut);
+
+static size_t FoldCodePoint(const char32_t aCodePoint, char32_t (&aFoldedOut)[2]);
+
+static uint32_t GetMaxEdits(const size_t aWordLength);
+
+static uint32_t GetPrefixEditDistance(const std::u32string& aQueryWord,
+                                      const std::u32string& aNameWord);
+
+static std::vector<std::u32string> GetWords(const std::string& aNormalizedName);
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Normalize a name for searching: fold case, strip
+//!           diacritics and replace punctuation and white space
+//!           with single spaces between words.
+//!
+//!   @return normalized name, in UTF-8
+//!
+//----------------------------------------------------------------
+std::string Normalize(const std::string& aName) {
+  std::string result;
+  result.reserve(aName.size());
+
+  bool pendingSeparator = false;
+  size_t pos = 0;
+  char32_t codePoint;
+
+  while (DecodeUtf8(aName, pos, codePoint)) {
+    char32_t folded[2];
+    const size_t foldedCount = FoldCodePoint(codePoint, folded);
+
+    if (foldedCount == 1 && folded[0] == WordSeparator) {
+      pendingSeparator = !result.empty();
+      continue;
+    }
+
+    if (foldedCount != 0 && pendingSeparator) {
+      result.push_back(' ');
+      pendingSeparator = false;
+    }
+
+    for (size_t i = 0; i < foldedCount; i++) {
+      EncodeUtf8(folded[i], result);
+    }
+  }
+
+  return result;
+}  // end of Normalize()
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the trigrams of every word of a normalized name.
+//!           Each trigram packs three 21-bit code points.
+//!
+//!   @return sorted, unique trigrams
+//!
+//----------------------------------------------------------------
+std::vector<int64_t> GetTrigrams(const std::string& aNormalizedName) {
+  std::vector<int64_t> result;
+
+  for (const auto& word : GetWords(aNormalizedName)) {
+    const std::u32string padded = WordSeparator + word + WordSeparator;
+
+    for (size_t i = 0; i + 2 < padded.size(); i++) {
+      result.push_back((static_cast<int64_t>(padded[i]) << 42) |
+                       (static_cast<int64_t>(padded[i + 1]) << 21) |
+                       static_cast<int64_t>(padded[i + 2]));
+    }
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+
+  return result;
+}  // end of GetTrigrams()
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the number of query trigrams a name must share to
+//!           possibly match.  An edit changes at most three
+//!           trigrams of a word, and a query word matching the
+//!           beginning of a longer word loses its last trigram.
+//!
+//!   @return minimum shared trigrams, at least 1
+//!
+//----------------------------------------------------------------
+uint32_t GetMinSharedTrigrams(const std::string& aNormalizedQuery) {
+  uint32_t result = 0;
+
+  for (const auto& word : GetWords(aNormalizedQuery)) {
+    const int64_t required =
+        static_cast<int64_t>(word.size()) - 3 * static_cast<int64_t>(GetMaxEdits(word.size())) - 1;
+    result += static_cast<uint32_t>(std::max<int64_t>(required, 0));
+  }
+
+  return std::max<uint32_t>(result, 1);
+}  // end of GetMinSharedTrigrams()
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get how far a normalized name is from a normalized
+//!           query.  Each query word is matched to the beginning of
+//!           the closest name word, allowing one edit for words of
+//!           three to five letters and two for longer words.
+//!           Adjacent transpositions count as one edit.
+//!
+//!   @return total edits over all query words, or NoMatch
+//!
+//----------------------------------------------------------------
+uint32_t GetMatchDistance(const std::string& aNormalizedQuery,
+                          const std::string& aNormalizedName) {
+  const std::vector<std::u32string> nameWords = GetWords(aNormalizedName);
+  uint32_t result = 0;
+
+  for (const auto& queryWord : GetWords(aNormalizedQuery)) {
+    uint32_t best = NoMatch;
+    for (const auto& nameWord : nameWords) {
+      best = std::min(best, GetPrefixEditDistance(queryWord, nameWord));
+    }
+
+    if (best > GetMaxEdits(queryWord.size())) {
+      return NoMatch;
+    }
+
+    result += best;
+  }
+
+  return result;
+}  // end of GetMatchDistance()
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Decode the UTF-8 code point at aPos and advance aPos
+//!           past it.  Malformed sequences decode to U+FFFD.
+//!
+//!   @return false at the end of the string
+//!
+//----------------------------------------------------------------
+static bool DecodeUtf8(const std::string& aStr, size_t& aPos, char32_t& aCodePointOut) {
+  if (aPos >= aStr.size()) {
+    return false;
+  }
+
+  const unsigned char lead = static_cast<unsigned char>(aStr[aPos++]);
+  size_t continuationCount;
+
+  if (lead < 0x80) {
+    aCodePointOut = lead;
+    return true;
+  } else if ((lead & 0xE0) == 0xC0) {
+    aCodePointOut = lead & 0x1F;
+    continuationCount = 1;
+  } else if ((lead & 0xF0) == 0xE0) {
+    aCodePointOut = lead & 0x0F;
+    continuationCount = 2;
+  } else if ((lead & 0xF8) == 0xF0) {
+    aCodePointOut = lead & 0x07;
+    continuationCount = 3;
+  } else {
+    aCodePointOut = 0xFFFD;
+    return true;
+  }
+
+  for (size_t i = 0; i < continuationCount; i++) {
+    if (aPos >= aStr.size() || (static_cast<unsigned char>(aStr[aPos]) & 0xC0) != 0x80) {
+      aCodePointOut = 0xFFFD;
+      return true;
+    }
+
+    aCodePointOut = (aCodePointOut << 6) | (static_cast<unsigned char>(aStr[aPos++]) & 0x3F);
+  }
+
+  return true;
+}  // end of DecodeUtf8()
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Append a code point to a string, in UTF-8.
+//!
+//----------------------------------------------------------------
+static void EncodeUtf8(const char32_t aCodePoint, std::string& aStrOut) {
+  if (aCodePoint < 0x80) {
+    aStrOut.push_back(static_cast<char>(aCodePoint));
+  } else if (aCodePoint < 0x800) {
+    aStrOut.push_back(static_cast<char>(0xC0 | (aCodePoint >> 6)));
+    aStrOut.push_back(static_cast<char>(0x80 | (aCodePoint & 0x3F)));
+  } else if (aCodePoint < 0x10000) {
+    aStrOut.push_back(static_cast<char>(0xE0 | (aCodePoint >> 12)));
+    aStrOut.push_back(static_cast<char>(0x80 | ((aCodePoint >> 6) & 0x3F)));
+    aStrOut.push_back(static_cast<char>(0x80 | (aCodePoint & 0x3F)));
+  } else {
+    aStrOut.push_back(static_cast<char>(0xF0 | (aCodePoint >> 18)));
+    aStrOut.push_back(static_cast<char>(0x80 | ((aCodePoint >> 12) & 0x3F)));
+    aStrOut.push_back(static_cast<char>(0x80 | ((aCodePoint >> 6) & 0x3F)));
+    aStrOut.push_back(static_cast<char>(0x80 | (aCodePoint & 0x3F)));
+  }
+}  // end of EncodeUtf8()
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Fold a code point to lower case without diacritics.
+//!           Latin, Greek and Cyrillic letters are folded; other
+//!           scripts are kept as they are.  Punctuation and white
+//!           space fold to WordSeparator, and apostrophes and
+//!           combining marks are dropped.
+//!
+//!   @return number of code points written to aFoldedOut
+//!
+//----------------------------------------------------------------
+static size_t FoldCodePoint(const char32_t aCodePoint, char32_t (&aFoldedOut)[2]) {
+  aFoldedOut[0] = aCodePoint;
+
+  if (aCodePoint < 0x80) {
+    if (aCodePoint >= 'A' && aCodePoint <= 'Z') {
+      aFoldedOut[0] = aCodePoint - 'A' + 'a';
+    } else if (aCodePoint == '\'') {
+      return 0;
+    } else if (!(aCodePoint >= 'a' && aCodePoint <= 'z') &&
+               !(aCodePoint >= '0' && aCodePoint <= '9')) {
+      aFoldedOut[0] = WordSeparator;
+    }
+
+    return 1;
+  }
+
+  switch (aCodePoint) {
+    case 0x00C6:  // Æ
+    case 0x00E6:  // æ
+      aFoldedOut[0] = 'a';
+      aFoldedOut[1] = 'e';
+      return 2;
+    case 0x00DE:  // Þ
+    case 0x00FE:  // þ
+      aFoldedOut[0] = 't';
+      aFoldedOut[1] = 'h';
+      return 2;
+    case 0x00DF:  // ß
+      aFoldedOut[0] = 's';
+      aFoldedOut[1] = 's';
+      return 2;
+    case 0x0132:  // Ĳ
+    case 0x0133:  // ĳ
+      aFoldedOut[0] = 'i';
+      aFoldedOut[1] = 'j';
+      return 2;
+    case 0x0152:  // Œ
+    case 0x0153:  // œ
+      aFoldedOut[0] = 'o';
+      aFoldedOut[1] = 'e';
+      return 2;
+    case 0x03C2:  // final sigma
+      aFoldedOut[0] = 0x03C3;
+      return 1;
+    case 0x0401:  // Ё
+    case 0x0451:  // ё
+      aFoldedOut[0] = 0x0435;
+      return 1;
+    case 0x2019:  // right single quotation mark, used as apostrophe
+      return 0;
+    case 0xFFFD:  // replacement character, from malformed UTF-8
+      aFoldedOut[0] = WordSeparator;
+      return 1;
+    default:
+      break;
+  }
+
+  if (aCodePoint < 0xC0) {
+    // Latin-1 symbols and the no-break space
+    aFoldedOut[0] = WordSeparator;
+  } else if (aCodePoint < 0x100) {
+    aFoldedOut[0] = Latin1Folding[aCodePoint - 0xC0];
+  } else if (aCodePoint < 0x180) {
+    aFoldedOut[0] = LatinExtendedAFolding[aCodePoint - 0x100];
+  } else if (aCodePoint >= 0x0300 && aCodePoint < 0x0370) {
+    // Combining diacritical marks
+    return 0;
+  } else if (aCodePoint >= 0x0391 && aCodePoint <= 0x03A9) {
+    aFoldedOut[0] = aCodePoint + 0x20;
+  } else if (aCodePoint >= 0x0400 && aCodePoint < 0x0410) {
+    aFoldedOut[0] = aCodePoint + 0x50;
+  } else if (aCodePoint >= 0x0410 && aCodePoint < 0x0430) {
+    aFoldedOut[0] = aCodePoint + 0x20;
+  } else if (aCodePoint >= 0x2000 && aCodePoint < 0x2070) {
+    // General punctuation and spaces
+    aFoldedOut[0] = WordSeparator;
+  }
+
+  return 1;
+}  // end of FoldCodePoint()
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @return Number of edits allowed when matching a query word
+//!
+//----------------------------------------------------------------
+static uint32_t GetMaxEdits(const size_t aWordLength) {
+  if (aWordLength <= 2) {
+    return 0;
+  } else if (aWordLength <= 5) {
+    return 1;
+  }
+
+  return 2;
+}  // end of GetMaxEdits()
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Optimal string alignment distance between aQueryWord
+//!           and the closest beginning of aNameWord.
+//!
+//!   @return number of edits
+//!
+//----------------------------------------------------------------
+static uint32_t GetPrefixEditDistance(const std::u32string& aQueryWord,
+                                      const std::u32string& aNameWord) {
+  const size_t columns = aNameWord.size() + 1;
+
+  // Rows i - 2, i - 1 and i of the distance matrix.
+  std::vector<uint32_t> previousPrevious(columns);
+  std::vector<uint32_t> previous(columns);
+  std::vector<uint32_t> current(columns);
+
+  for (size_t j = 0; j < columns; j++) {
+    current[j] = static_cast<uint32_t>(j);
+  }
+
+  for (size_t i = 1; i <= aQueryWord.size(); i++) {
+    previousPrevious.swap(previous);
+    previous.swap(current);
+
+    current[0] = static_cast<uint32_t>(i);
+    for (size_t j = 1; j < columns; j++) {
+      const uint32_t substitution = aQueryWord[i - 1] == aNameWord[j - 1] ? 0 : 1;
+      current[j] = std::min({previous[j] + 1, current[j - 1] + 1,
+                             previous[j - 1] + substitution});
+
+      if (i > 1 && j > 1 && aQueryWord[i - 1] == aNameWord[j - 2] &&
+          aQueryWord[i - 2] == aNameWord[j - 1]) {
+        current[j] = std::min(current[j], previousPrevious[j - 2] + 1);
+      }
+    }
+  }
+
+  return *std::min_element(current.begin(), current.end());
+}  // end of GetPrefixEditDistance()
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @return Words of a normalized name, as code points
+//!
+//----------------------------------------------------------------
+static std::vector<std::u32string> GetWords(const std::string& aNormalizedName) {
+  std::vector<std::u32string> result;
+  std::u32string word;
+  size_t pos = 0;
+  char32_t codePoint;
+
+  while (DecodeUtf8(aNormalizedName, pos, codePoint)) {
+    if (codePoint == WordSeparator) {
+      if (!word.empty()) {
+        result.push_back(std::move(word));
+        word.clear();
+      }
+    } else {
+      word.push_back(codePoint);
+    }
+  }
+
+  if (!word.empty()) {
+    result.push_back(std::move(word));
+  }
+
+  return result;
+}  // end of GetWords()
+
+}  // end of namespace NameSearch
+}  // end of namespace Acdb
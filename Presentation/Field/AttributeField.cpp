@@ -36,14 +36,33 @@ namespace Presentation {
 //!
 //!   @public
 //!   @brief Constructor
+//!   @detail Keeps its own copy of aLabel, for labels from the data
+//!   that should not grow the StringPool.
 //!
 //----------------------------------------------------------------
-AttributeField::AttributeField(std::string&& aLabel, std::string&& aValue, std::string&& aNote,
-                               std::string&& aHyperLink)
-    : mHyperLink(aHyperLink),
-      mLabel(aLabel),
-      mNote(aNote),
-      mValue(aValue) {}  // end of AttributeField
+AttributeField::AttributeField(const std::string& aLabel, std::string&& aValue,
+                               std::string&& aNote, std::string&& aHyperLink)
+    : mHyperLink(std::move(aHyperLink)),
+      mLabel(nullptr),
+      mOwnedLabel(aLabel),
+      mNote(std::move(aNote)),
+      mValue(std::move(aValue)) {}  // end of AttributeField
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Constructor
+//!   @detail Shares aPooledLabel, which must outlive the field, like
+//!   the strings of the StringPool and of TextTranslator::Lookup().
+//!
+//----------------------------------------------------------------
+AttributeField::AttributeField(const std::string* aPooledLabel, std::string&& aValue,
+                               std::string&& aNote, std::string&& aHyperLink)
+    : mHyperLink(std::move(aHyperLink)),
+      mLabel(aPooledLabel),
+      mOwnedLabel(),
+      mNote(std::move(aNote)),
+      mValue(std::move(aValue)) {}  // end of AttributeField
 
 //----------------------------------------------------------------
 //!
@@ -52,7 +71,7 @@ AttributeField::AttributeField(std::string&& aLabel, std::string&& aValue, std::
 //!
 //----------------------------------------------------------------
 bool AttributeField::operator==(const AttributeField& aRhs) const {
-  return mHyperLink == aRhs.mHyperLink && mLabel == aRhs.mLabel && mNote == aRhs.mNote &&
+  return mHyperLink == aRhs.mHyperLink && GetLabel() == aRhs.GetLabel() && mNote == aRhs.mNote &&
          mValue == aRhs.mValue;
 }  // end of operator==
 
@@ -64,7 +83,9 @@ bool AttributeField::operator==(const AttributeField& aRhs) const {
 //!   @return value of the hyperlink member
 //!
 //----------------------------------------------------------------
-std::string AttributeField::GetHyperLink() const { return mHyperLink; }  // end of GetHyperLink
+const std::string& AttributeField::GetHyperLink() const {
+  return mHyperLink;
+}  // end of GetHyperLink
 
 //----------------------------------------------------------------
 //!
@@ -74,7 +95,9 @@ std::string AttributeField::GetHyperLink() const { return mHyperLink; }  // end
 //!   @return value of the label member
 //!
 //----------------------------------------------------------------
-std::string AttributeField::GetLabel() const { return mLabel; }  // end of GetLabel
+const std::string& AttributeField::GetLabel() const {
+  return (mLabel != nullptr) ? *mLabel : mOwnedLabel;
+}  // end of GetLabel
 
 //----------------------------------------------------------------
 //!
@@ -84,7 +107,7 @@ std::string AttributeField::GetLabel() const { return mLabel; }  // end of GetLa
 //!   @return value of the note member
 //!
 //----------------------------------------------------------------
-std::string AttributeField::GetNote() const { return mNote; }  // end of GetNote
+const std::string& AttributeField::GetNote() const { return mNote; }  // end of GetNote
 
 //----------------------------------------------------------------
 //!
@@ -94,7 +117,7 @@ std::string AttributeField::GetNote() const { return mNote; }  // end of GetNote
 //!   @return value of the attribute
 //!
 //----------------------------------------------------------------
-std::string AttributeField::GetValue() const { return mValue; }  // end of GetValue
+const std::string& AttributeField::GetValue() const { return mValue; }  // end of GetValue
 
 }  // end of namespace Presentation
 }  // end of namespace Acdb
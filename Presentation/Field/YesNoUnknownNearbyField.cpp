@@ -29,6 +29,7 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 
 #include "Acdb/Presentation/Field/YesNoUnknownNearbyField.hpp"
 #include "Acdb/PrvTypes.hpp"
+#include "Acdb/StringPool.hpp"
 
 namespace Acdb {
 namespace Presentation {
@@ -39,12 +40,12 @@ namespace Presentation {
 //!   @brief Constructor
 //!
 //----------------------------------------------------------------
-YesNoUnknownNearbyField::YesNoUnknownNearbyField(std::string&& aLabel, std::string&& aValue,
+YesNoUnknownNearbyField::YesNoUnknownNearbyField(const std::string& aLabel, std::string&& aValue,
                                                  std::string&& aNote, std::string&& aAltText)
-    : mLabel(aLabel),
-      mNote(aNote),
-      mValue(aValue),
-      mAltText(aAltText) {}  // end of YesNoUnknownNearbyField
+    : mLabel(&StringPool::GetInstance().Intern(aLabel)),
+      mNote(std::move(aNote)),
+      mValue(std::move(aValue)),
+      mAltText(std::move(aAltText)) {}  // end of YesNoUnknownNearbyField
 
 //----------------------------------------------------------------
 //!
@@ -53,7 +54,7 @@ YesNoUnknownNearbyField::YesNoUnknownNearbyField(std::string&& aLabel, std::stri
 //!
 //----------------------------------------------------------------
 bool YesNoUnknownNearbyField::operator==(const YesNoUnknownNearbyField& aRhs) const {
-  return mLabel == aRhs.mLabel && mNote == aRhs.mNote && mValue == aRhs.mValue &&
+  return *mLabel == *aRhs.mLabel && mNote == aRhs.mNote && mValue == aRhs.mValue &&
          mAltText == aRhs.mAltText;
 }  // end of operator==
 
@@ -65,7 +66,7 @@ bool YesNoUnknownNearbyField::operator==(const YesNoUnknownNearbyField& aRhs) co
 //!   @return value of the label member
 //!
 //----------------------------------------------------------------
-std::string YesNoUnknownNearbyField::GetLabel() const { return mLabel; }  // end of GetLabel
+const std::string& YesNoUnknownNearbyField::GetLabel() const { return *mLabel; }  // end of GetLabel
 
 //----------------------------------------------------------------
 //!
@@ -75,7 +76,7 @@ std::string YesNoUnknownNearbyField::GetLabel() const { return mLabel; }  // end
 //!   @return value of the note member
 //!
 //----------------------------------------------------------------
-std::string YesNoUnknownNearbyField::GetNote() const { return mNote; }  // end of GetNote
+const std::string& YesNoUnknownNearbyField::GetNote() const { return mNote; }  // end of GetNote
 
 //----------------------------------------------------------------
 //!
@@ -85,7 +86,7 @@ std::string YesNoUnknownNearbyField::GetNote() const { return mNote; }  // end o
 //!   @return value of the attribute
 //!
 //----------------------------------------------------------------
-std::string YesNoUnknownNearbyField::GetValue() const { return mValue; }  // end of GetValue
+const std::string& YesNoUnknownNearbyField::GetValue() const { return mValue; }  // end of GetValue
 
 //----------------------------------------------------------------
 //!
@@ -95,7 +96,9 @@ std::string YesNoUnknownNearbyField::GetValue() const { return mValue; }  // end
 //!   @return value of the alt text
 //!
 //----------------------------------------------------------------
-std::string YesNoUnknownNearbyField::GetAltText() const { return mAltText; }  // end of GetAltText
+const std::string& YesNoUnknownNearbyField::GetAltText() const {
+  return mAltText;
+}  // end of GetAltText
 
 //----------------------------------------------------------------
 //!
@@ -22,8 +22,10 @@ limitations under the License.
 */
 
 #include "Acdb/Presentation/MustacheContext.hpp"
+#include "Acdb/Presentation/MustacheTemplateCache.hpp"
 #include "Acdb/Repository.hpp"
 #include "Acdb/PrvTypes.hpp"
+#include "Acdb/TraceSpan.hpp"
 
 namespace Acdb {
 namespace Presentation {
@@ -31,7 +33,14 @@ namespace Presentation {
 MustacheContext::MustacheContext(RepositoryPtr aRepositoryPtr,
                                  const kainjow::mustache::data* aContext)
     : kainjow::mustache::context<std::string>(aContext),
-      mRepositoryPtr(std::move(aRepositoryPtr)) {}  // end of MustacheContext::MustacheContext()
+      mRepositoryPtr(std::move(aRepositoryPtr)),
+      mTemplateCache(nullptr) {}  // end of MustacheContext::MustacheContext()
+
+MustacheContext::MustacheContext(MustacheTemplateCache& aTemplateCache,
+                                 const kainjow::mustache::data* aContext)
+    : kainjow::mustache::context<std::string>(aContext),
+      mRepositoryPtr(),
+      mTemplateCache(&aTemplateCache) {}  // end of MustacheContext::MustacheContext()
 
 const kainjow::mustache::basic_data<std::string>* MustacheContext::get_partial(
     const std::string& aName) const {
@@ -40,7 +49,9 @@ const kainjow::mustache::basic_data<std::string>* MustacheContext::get_partial(
     return &it->second;
   }
 
-  std::string templateContents = mRepositoryPtr->GetMustacheTemplate(aName);
+  ACDB_TRACE_SPAN("MustacheContext::get_partial");
+  std::string templateContents = mTemplateCache ? mTemplateCache->Get(aName)
+                                                : mRepositoryPtr->GetMustacheTemplate(aName);
   if (templateContents.empty()) {
     return nullptr;
   }
@@ -0,0 +1,65 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Thread-safe cache of Mustache templates shared by render tasks.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#include "Acdb/Presentation/MustacheTemplateCache.hpp"
+#include "Acdb/Repository.hpp"
+
+namespace Acdb {
+namespace Presentation {
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Constructor
+//!
+//----------------------------------------------------------------
+MustacheTemplateCache::MustacheTemplateCache(RepositoryPtr aRepositoryPtr)
+    : mRepositoryPtr(std::move(aRepositoryPtr)),
+      mMutex(),
+      mTemplates() {}  // end of MustacheTemplateCache::MustacheTemplateCache()
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!   @detail Templates are read from the repository the first time
+//!           they are requested.  The cache mutex is held during
+//!           the read so the repository's prepared statements are
+//!           never used by two render tasks at once.
+//!
+//!   @return contents of the named template, empty if not found
+//!
+//----------------------------------------------------------------
+std::string MustacheTemplateCache::Get(const std::string& aName) {
+  std::lock_guard<std::mutex> lock{mMutex};
+
+  auto it = mTemplates.find(aName);
+  if (it == mTemplates.end()) {
+    it = mTemplates.insert(std::make_pair(aName, mRepositoryPtr->GetMustacheTemplate(aName))).first;
+  }
+
+  return it->second;
+}  // end of MustacheTemplateCache::Get()
+
+}  // end of namespace Presentation
+}  // end of namespace Acdb
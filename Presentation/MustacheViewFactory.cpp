@@ -26,26 +26,53 @@ limitations under the License.
 #define DBG_TAG "MustacheViewFactory"
 
 #include <inttypes.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include "DBG_pub.h"
 #include "ACDB_pub_types.h"
 #include "Acdb/Presentation/BusinessPhotoList.hpp"
 #include "Acdb/Presentation/MustacheContext.hpp"
+#include "Acdb/Presentation/MustacheTemplateCache.hpp"
 #include "Acdb/Presentation/MustacheViewFactory.hpp"
 #include "Acdb/Presentation/PresentationMarker.hpp"
 #include "Acdb/Presentation/ReviewList.hpp"
 #include "Acdb/PrvTypes.hpp"
 #include "Acdb/SectionType.hpp"
 #include "Acdb/StringUtil.hpp"
+#include "Acdb/TraceSpan.hpp"
 #include "mustache.hpp"
 
 namespace Acdb {
 namespace Presentation {
 static std::string sHeadContent;
 static std::string sImagePrefix;
+static std::atomic<uint32_t> sContentViewThreadCount{1};
+
+//! A single content view to be rendered by GetContentViewMap
+struct ContentViewTask {
+  ContentViewTask(const ContentViewStringType aViewType, const std::string& aTemplate,
+                  const kainjow::mustache::data* aData)
+      : mViewType(aViewType), mTemplate(aTemplate), mData(aData), mHtml() {}
+
+  ContentViewStringType mViewType;
+  std::string mTemplate;
+  const kainjow::mustache::data* mData;
+  std::string mHtml;
+};  // end of struct ContentViewTask
+
+static void RenderContentViewTasks(std::vector<ContentViewTask>& aTasks,
+                                   MustacheTemplateCache& aTemplateCache,
+                                   std::atomic<size_t>& aNextTask);
+
+static std::string RenderHtml(kainjow::mustache::mustache& aMustache, MustacheContext& aContext);
 
 static kainjow::mustache::data GetAttributeFieldData(const AttributeField& aAttributeField);
 
@@ -275,6 +302,7 @@ static kainjow::mustache::data GetBusinessPhotoFieldData(
 //----------------------------------------------------------------
 std::string GetBusinessPhotoListHtml(const BusinessPhotoList& aBusinessPhotoList,
                                      const RepositoryPtr& aRepositoryPtr) {
+  ACDB_TRACE_SPAN("MustacheViewFactory::GetBusinessPhotoListHtml");
   const std::string BUSINESS_PHOTO_LIST_PAGE = "{{> V2_BusinessPhotoListPage}}";
 
   kainjow::mustache::mustache mustache(BUSINESS_PHOTO_LIST_PAGE);
@@ -282,7 +310,7 @@ std::string GetBusinessPhotoListHtml(const BusinessPhotoList& aBusinessPhotoList
   kainjow::mustache::data data = GetBusinessPhotoListPageData(aBusinessPhotoList);
   MustacheContext context(aRepositoryPtr, &data);
 
-  auto html = mustache.render(context);
+  auto html = RenderHtml(mustache, context);
 
   return html;
 }  // end of GetBusinessPhotoListHtml
@@ -326,6 +354,7 @@ static kainjow::mustache::data GetBusinessPhotoListData(
 //----------------------------------------------------------------
 static kainjow::mustache::data GetBusinessPhotoListPageData(
     const BusinessPhotoList& aBusinessPhotoList) {
+  ACDB_TRACE_SPAN("MustacheViewFactory::GetBusinessPhotoListPageData");
   const std::string HEAD_TAG = "Head";
   const std::string IMG_PREFIX_TAG = "ImgPrefix";
   const std::string REVIEW_LIST_TAG = "BusinessPhotoList";
@@ -405,71 +434,97 @@ static kainjow::mustache::data GetBusinessPromotionListFieldData(
 ContentViewMapPtr GetContentViewMap(const PresentationMarker& aPresentationMarker,
                                     const ReviewListPtr& aReviewListPtr,
                                     const RepositoryPtr& aRepositoryPtr) {
+  ACDB_TRACE_SPAN("MustacheViewFactory::GetContentViewMap");
   kainjow::mustache::data markerData = GetPresentationMarkerData(aPresentationMarker);
-  MustacheContext markerContext(aRepositoryPtr, &markerData);
+  kainjow::mustache::data reviewData;
 
-  ContentViewMapPtr result = ContentViewMapPtr(new ContentViewMap());
+  std::vector<ContentViewTask> tasks;
 
-  std::string generalViewTemplate;
-  std::string navigationViewTemplate;
-  std::string servicesViewTemplate;
-  std::string fuelViewTemplate;
-  std::string dockageViewTemplate;
-  std::string reviewsViewTemplate;
-
-  generalViewTemplate =
-      "{{> GML_PointOfInterestSection}}<br><br>"
-      "{{> GML_AddressSection}}<br><br>"
-      "{{> GML_ContactSection}}<br><br>"
-      "{{> GML_BusinessSection}}";
-
-  kainjow::mustache::mustache mustacheGeneral(generalViewTemplate);
-  result->insert(
-      ContentViewPair(ContentViewGeneralInformation, mustacheGeneral.render(markerContext)));
+  tasks.push_back(ContentViewTask(ContentViewGeneralInformation,
+                                  "{{> GML_PointOfInterestSection}}<br><br>"
+                                  "{{> GML_AddressSection}}<br><br>"
+                                  "{{> GML_ContactSection}}<br><br>"
+                                  "{{> GML_BusinessSection}}",
+                                  &markerData));
 
   if (aPresentationMarker.GetNavigation()) {
-    navigationViewTemplate = "{{> GML_NavigationSection}}";
-
-    kainjow::mustache::mustache mustacheNavigation(navigationViewTemplate);
-    result->insert(
-        ContentViewPair(ContentViewNavigation, mustacheNavigation.render(markerContext)));
+    tasks.push_back(
+        ContentViewTask(ContentViewNavigation, "{{> GML_NavigationSection}}", &markerData));
   }
 
   if (aPresentationMarker.GetAmenities() || aPresentationMarker.GetServices() ||
       aPresentationMarker.GetRetail()) {
-    servicesViewTemplate =
-        "{{> GML_AmenitiesSection}}<br><br>"
-        "{{> GML_ServicesSection}}<br><br>"
-        "{{> GML_RetailSection}}";
-
-    kainjow::mustache::mustache mustacheServices(servicesViewTemplate);
-    result->insert(ContentViewPair(ContentViewServices, mustacheServices.render(markerContext)));
+    tasks.push_back(ContentViewTask(ContentViewServices,
+                                    "{{> GML_AmenitiesSection}}<br><br>"
+                                    "{{> GML_ServicesSection}}<br><br>"
+                                    "{{> GML_RetailSection}}",
+                                    &markerData));
   }
 
   if (aPresentationMarker.GetFuel()) {
-    fuelViewTemplate = "{{> GML_FuelSection}}";
-
-    kainjow::mustache::mustache mustacheFuel(fuelViewTemplate);
-    result->insert(ContentViewPair(ContentViewFuel, mustacheFuel.render(markerContext)));
+    tasks.push_back(ContentViewTask(ContentViewFuel, "{{> GML_FuelSection}}", &markerData));
   }
 
   if (aPresentationMarker.GetDockage() || aPresentationMarker.GetMoorings()) {
-    dockageViewTemplate =
-        "{{> GML_DockageSection}}<br><br>"
-        "{{> GML_MooringsSection}}";
-
-    kainjow::mustache::mustache mustacheDockage(dockageViewTemplate);
-    result->insert(ContentViewPair(ContentViewDockage, mustacheDockage.render(markerContext)));
+    tasks.push_back(ContentViewTask(ContentViewDockage,
+                                    "{{> GML_DockageSection}}<br><br>"
+                                    "{{> GML_MooringsSection}}",
+                                    &markerData));
   }
 
   if (aReviewListPtr && aReviewListPtr->GetReviews().size() != 0) {
-    kainjow::mustache::data reviewData = GetReviewListPageData(*aReviewListPtr);
-    MustacheContext reviewContext(aRepositoryPtr, &reviewData);
+    reviewData = GetReviewListPageData(*aReviewListPtr);
+    tasks.push_back(
+        ContentViewTask(ContentViewUserReview, "{{> GML_ReviewsSection}}", &reviewData));
+  }
+
+  // Partials are shared between views (and between the general and review sections), so each
+  // template is only read from the repository once regardless of how many tasks use it.
+  MustacheTemplateCache templateCache(aRepositoryPtr);
+  std::atomic<size_t> nextTask{0};
+
+  size_t workerCount = std::min<size_t>(sContentViewThreadCount.load(), tasks.size());
+  std::vector<std::future<void>> workers;
+  std::exception_ptr renderError;
+
+  for (size_t i = 1; i < workerCount; i++) {
+    try {
+      workers.push_back(std::async(std::launch::async, RenderContentViewTasks, std::ref(tasks),
+                                   std::ref(templateCache), std::ref(nextTask)));
+    } catch (const std::system_error& e) {
+      // No thread available; the threads already started (and this one) pick up the rest.
+      DBG_W("Content view worker not started: %s", e.what());
+      break;
+    }
+  }
 
-    reviewsViewTemplate = "{{> GML_ReviewsSection}}";
+  // The calling thread always takes part, so a thread count of 1 renders serially.
+  try {
+    RenderContentViewTasks(tasks, templateCache, nextTask);
+  } catch (...) {
+    renderError = std::current_exception();
+  }
+
+  // Every worker references tasks and templateCache, so all of them are joined before the
+  // first failure (if any) is passed on to the caller.
+  for (auto& worker : workers) {
+    try {
+      worker.get();
+    } catch (...) {
+      if (!renderError) {
+        renderError = std::current_exception();
+      }
+    }
+  }
 
-    kainjow::mustache::mustache mustacheReviews(reviewsViewTemplate);
-    result->insert(ContentViewPair(ContentViewUserReview, mustacheReviews.render(reviewContext)));
+  if (renderError) {
+    std::rethrow_exception(renderError);
+  }
+
+  ContentViewMapPtr result = ContentViewMapPtr(new ContentViewMap());
+
+  for (auto& task : tasks) {
+    result->insert(ContentViewPair(task.mViewType, std::move(task.mHtml)));
   }
 
   return result;
@@ -484,6 +539,7 @@ ContentViewMapPtr GetContentViewMap(const PresentationMarker& aPresentationMarke
 //----------------------------------------------------------------
 std::string GetPresentationMarkerHtml(const PresentationMarker& aPresentationMarker,
                                       const RepositoryPtr& aRepositoryPtr) {
+  ACDB_TRACE_SPAN("MustacheViewFactory::GetPresentationMarkerHtml");
   const std::string FULL_VIEW = "{{> V2_FullView}}";
   const std::string SUMMARY = "{{> V2_Summary}}";
   const std::string ENABLE_WEB_VIEWS_TAG = "EnableWebViews";
@@ -497,13 +553,13 @@ std::string GetPresentationMarkerHtml(const PresentationMarker& aPresentationMar
   MustacheContext context(aRepositoryPtr, &data);
 
   kainjow::mustache::mustache summaryMustache(SUMMARY);
-  auto html = summaryMustache.render(context);
+  auto html = RenderHtml(summaryMustache, context);
 
   if (html.empty()) {
     // Summary template was not present -- the MustacheTemplates table may not be up-to-date.
     // Fall back to using the FullView template.
     kainjow::mustache::mustache fullViewMustache(FULL_VIEW);
-    html = fullViewMustache.render(context);
+    html = RenderHtml(fullViewMustache, context);
   }
 
   return html;
@@ -517,6 +573,7 @@ std::string GetPresentationMarkerHtml(const PresentationMarker& aPresentationMar
 //----------------------------------------------------------------
 static kainjow::mustache::data GetPresentationMarkerData(
     const PresentationMarker& aPresentationMarker) {
+  ACDB_TRACE_SPAN("MustacheViewFactory::GetPresentationMarkerData");
   const std::string ADDRESS_SECTION_TAG = "AddressSection";
   const std::string AMENITIES_SECTION_TAG = "AmenitiesSection";
   const std::string BUSINESS_SECTION_TAG = "BusinessSection";
@@ -602,6 +659,7 @@ static kainjow::mustache::data GetPresentationMarkerData(
 //!
 //----------------------------------------------------------------
 std::string GetReviewListHtml(const ReviewList& aReviewList, const RepositoryPtr& aRepositoryPtr) {
+  ACDB_TRACE_SPAN("MustacheViewFactory::GetReviewListHtml");
   const std::string REVIEW_LIST_PAGE = "{{> V2_ReviewListPage}}";
   const std::string ENABLE_WEB_VIEWS_TAG = "EnableWebViews";
 
@@ -615,7 +673,7 @@ std::string GetReviewListHtml(const ReviewList& aReviewList, const RepositoryPtr
 
   MustacheContext context(aRepositoryPtr, &data);
 
-  auto html = mustache.render(context);
+  auto html = RenderHtml(mustache, context);
 
   return html;
 }  // end of GetReviewListHtml
@@ -677,6 +735,7 @@ static kainjow::mustache::data GetReviewListData(const ReviewList& aReviewList)
 //!
 //----------------------------------------------------------------
 static kainjow::mustache::data GetReviewListPageData(const ReviewList& aReviewList) {
+  ACDB_TRACE_SPAN("MustacheViewFactory::GetReviewListPageData");
   const std::string HEAD_TAG = "Head";
   const std::string IMG_PREFIX_TAG = "ImgPrefix";
   const std::string REVIEW_LIST_TAG = "ReviewList";
@@ -690,6 +749,31 @@ static kainjow::mustache::data GetReviewListPageData(const ReviewList& aReviewLi
   return data;
 }  // end of GetReviewListPageData
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Get section type displayed by a section page
+//!   @return SectionType for aSectionName, None if the name is not
+//!           a valid section page
+//!
+//----------------------------------------------------------------
+SectionType::Value GetSectionPageType(const std::string& aSectionName) {
+  static const std::map<std::string, SectionType::Value> compactSectionTypes = {
+      {"amenities", SectionType::Amenities},
+      {"dockage", SectionType::Dockage},
+      {"moorings", SectionType::Moorings},
+      {"retail", SectionType::Retail},
+      {"services", SectionType::Services}};
+
+  auto sectionTypeIter = compactSectionTypes.find(String::ToLower(aSectionName));
+  if (sectionTypeIter == compactSectionTypes.end()) {
+    DBG_ASSERT_ALWAYS("Invalid compact section type name.");
+    return SectionType::None;
+  }
+
+  return sectionTypeIter->second;
+}  // end of GetSectionPageType
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -700,6 +784,7 @@ static kainjow::mustache::data GetReviewListPageData(const ReviewList& aReviewLi
 std::string GetSectionPageHtml(const PresentationMarker& aPresentationMarker,
                                const std::string& aSectionName,
                                const RepositoryPtr& aRepositoryPtr) {
+  ACDB_TRACE_SPAN("MustacheViewFactory::GetSectionPageHtml");
   const std::string AMENITIES_SECTION_TAG = "AmenitiesSection";
   const std::string BACK_BUTTON_FIELD_TAG = "BackButtonField";
   const std::string DOCKAGE_SECTION_TAG = "DockageSection";
@@ -710,21 +795,11 @@ std::string GetSectionPageHtml(const PresentationMarker& aPresentationMarker,
   const std::string RETAIL_SECTION_TAG = "RetailSection";
   const std::string SERVICES_SECTION_TAG = "ServicesSection";
 
-  static const std::map<std::string, SectionType::Value> compactSectionTypes = {
-      {"amenities", SectionType::Amenities},
-      {"dockage", SectionType::Dockage},
-      {"moorings", SectionType::Moorings},
-      {"retail", SectionType::Retail},
-      {"services", SectionType::Services}};
-
-  auto sectionTypeIter = compactSectionTypes.find(String::ToLower(aSectionName));
-  if (sectionTypeIter == compactSectionTypes.end()) {
-    DBG_ASSERT_ALWAYS("Invalid compact section type name.");
+  SectionType::Value sectionType = GetSectionPageType(aSectionName);
+  if (sectionType == SectionType::None) {
     return std::string();
   }
 
-  SectionType::Value sectionType = sectionTypeIter->second;
-
   std::string sectionPageTemplate;
 
   kainjow::mustache::data data;
@@ -770,7 +845,7 @@ std::string GetSectionPageHtml(const PresentationMarker& aPresentationMarker,
 
   MustacheContext context(aRepositoryPtr, &data);
 
-  auto html = mustache.render(context);
+  auto html = RenderHtml(mustache, context);
 
   return html;
 }  // end of GetSectionPageHtml
@@ -1687,6 +1762,37 @@ static kainjow::mustache::data GetReviewPhotoFieldListData(
   return data;
 }  // end of GetReviewPhotoFieldListData
 
+//----------------------------------------------------------------
+//!
+//!   @brief Render content view tasks until none remain
+//!   @detail Safe to call from several threads at once; each call
+//!           claims the next unrendered task and renders it with
+//!           its own context.
+//!
+//----------------------------------------------------------------
+static void RenderContentViewTasks(std::vector<ContentViewTask>& aTasks,
+                                   MustacheTemplateCache& aTemplateCache,
+                                   std::atomic<size_t>& aNextTask) {
+  for (size_t i = aNextTask++; i < aTasks.size(); i = aNextTask++) {
+    ContentViewTask& task = aTasks[i];
+
+    MustacheContext context(aTemplateCache, task.mData);
+    kainjow::mustache::mustache view(task.mTemplate);
+    task.mHtml = RenderHtml(view, context);
+  }
+}  // end of RenderContentViewTasks
+
+//----------------------------------------------------------------
+//!
+//!   @brief Render a template, reading its partials as needed
+//!   @return Rendered HTML string
+//!
+//----------------------------------------------------------------
+static std::string RenderHtml(kainjow::mustache::mustache& aMustache, MustacheContext& aContext) {
+  ACDB_TRACE_SPAN("MustacheViewFactory::RenderHtml");
+  return aMustache.render(aContext);
+}  // end of RenderHtml
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -1707,5 +1813,16 @@ void SetImagePrefix(const std::string& aImagePrefix) {
   sImagePrefix = aImagePrefix;
 }  // end of SetImagePrefix
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Set number of threads used to render content views
+//!   @detail 0 and 1 both render serially on the calling thread.
+//!
+//----------------------------------------------------------------
+void SetContentViewThreadCount(const uint32_t aThreadCount) {
+  sContentViewThreadCount.store((aThreadCount == 0) ? 1 : aThreadCount);
+}  // end of SetContentViewThreadCount
+
 }  // end of namespace Presentation
 }  // end of namespace Acdb
@@ -42,12 +42,16 @@ limitations under the License.
 #include "Acdb/StringUtil.hpp"
 #include "Acdb/TextHandle.hpp"
 #include "Acdb/TextTranslator.hpp"
+#include "Acdb/TraceSpan.hpp"
 #include "NavDateTimeExtensions.hpp"
 #include "rapidjson/document.h"
 
 namespace Acdb {
 namespace Presentation {
 
+//! Label of the fields that have none
+static const std::string NoLabel;
+
 static AttributeField GetAttributeField(const rapidjson::Value& aDocument,
                                         const bool aIsMultiValue = false);
 
@@ -121,6 +125,7 @@ static const ACDB_type_type COMMENTS_SECTION_TYPES =
 //----------------------------------------------------------------
 AddressPtr GetAddress(const ACDB_marker_idx_type aIdx,
                       const AddressTableDataType& aAddressTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetAddress");
   auto title = TextTranslator::GetInstance().Find(aAddressTableData.mSectionTitle);
 
   auto stringFields = GetStringFields(aAddressTableData.mStringFieldsJson);
@@ -141,6 +146,7 @@ AddressPtr GetAddress(const ACDB_marker_idx_type aIdx,
 //----------------------------------------------------------------
 AmenitiesPtr GetAmenities(const ACDB_marker_idx_type aIdx,
                           const AmenitiesTableDataType& aAmenitiesTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetAmenities");
   auto title = TextTranslator::GetInstance().Find(aAmenitiesTableData.mSectionTitle);
 
   auto sectionNote = GetAttributeFieldOptional(aAmenitiesTableData.mSectionNoteJson);
@@ -165,6 +171,7 @@ AmenitiesPtr GetAmenities(const ACDB_marker_idx_type aIdx,
 //----------------------------------------------------------------
 BusinessPtr GetBusiness(const ACDB_marker_idx_type aIdx,
                         const BusinessTableDataType& aBusinessTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetBusiness");
   auto title = TextTranslator::GetInstance().Find(aBusinessTableData.mSectionTitle);
 
   auto attributeFields = GetAttributeFields(aBusinessTableData.mAttributeFieldsJson);
@@ -200,6 +207,7 @@ BusinessPtr GetBusiness(const ACDB_marker_idx_type aIdx,
 BusinessPhotoListPtr GetBusinessPhotoList(
     const ACDB_marker_idx_type aIdx,
     std::vector<BusinessPhotoTableDataType>&& aBusinessPhotoTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetBusinessPhotoList");
   std::string title = TextTranslator::GetInstance().Find(static_cast<int>(TextHandle::PhotosTitle));
 
   std::vector<BusinessPhotoField> businessPhotoFields;
@@ -223,6 +231,7 @@ BusinessPhotoListPtr GetBusinessPhotoList(
 //----------------------------------------------------------------
 CompetitorAdPtr GetCompetitorAd(const ACDB_marker_idx_type aIdx,
                                 std::vector<AdvertiserTableDataCollection>&& aAdvertiserTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetCompetitorAd");
   std::string title = TextTranslator::GetInstance().Find(static_cast<int>(TextHandle::AdsTitle));
 
   std::vector<CompetitorAdField> competitorAdFields;
@@ -244,7 +253,8 @@ CompetitorAdPtr GetCompetitorAd(const ACDB_marker_idx_type aIdx,
 static CompetitorAdField GetCompetitorAdField(
     AdvertiserTableDataCollection&& aAdvertiserTableData) {
   rapidjson::Document document;
-  document.Parse(aAdvertiserTableData.mBusinessProgram.mCompetitorAdJson.c_str());
+  document.Parse(aAdvertiserTableData.mBusinessProgram.mCompetitorAdJson.c_str(),
+                 aAdvertiserTableData.mBusinessProgram.mCompetitorAdJson.size());
 
   std::string text;
   std::string photoUrl;
@@ -276,6 +286,7 @@ static CompetitorAdField GetCompetitorAdField(
 //----------------------------------------------------------------
 ContactPtr GetContact(const ACDB_marker_idx_type aIdx,
                       const ContactTableDataType& aContactTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetContact");
   auto title = TextTranslator::GetInstance().Find(aContactTableData.mSectionTitle);
 
   auto attributeFields = GetAttributeFields(aContactTableData.mAttributeFieldsJson);
@@ -295,6 +306,7 @@ ContactPtr GetContact(const ACDB_marker_idx_type aIdx,
 //----------------------------------------------------------------
 DockagePtr GetDockage(const ACDB_marker_idx_type aIdx,
                       const DockageTableDataType& aDockageTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetDockage");
   auto title = TextTranslator::GetInstance().Find(aDockageTableData.mSectionTitle);
 
   auto yesNoMultiValueFields = GetYesNoMultiValueFields(aDockageTableData.mYesNoMultiValueJson);
@@ -321,6 +333,7 @@ DockagePtr GetDockage(const ACDB_marker_idx_type aIdx,
 //!
 //----------------------------------------------------------------
 FuelPtr GetFuel(const ACDB_marker_idx_type aIdx, const FuelTableDataType& aFuelTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetFuel");
   auto title = TextTranslator::GetInstance().Find(aFuelTableData.mSectionTitle);
 
   auto yesNoPriceFields = GetYesNoPriceFields(aFuelTableData.mYesNoPriceJson);
@@ -349,6 +362,7 @@ MarkerDetail GetMarkerDetail(const ACDB_marker_idx_type aIdx,
                              const MarkerMetaTableDataType& aMarkerMetaTableData,
                              const ReviewSummaryTableDataType& aReviewSummaryTableData,
                              std::vector<BusinessPhotoTableDataType>& aBusinessPhotoTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetMarkerDetail");
   std::string name(aMarkerTableData.mName);
 
   std::string lastModifiedDateStr;
@@ -357,7 +371,7 @@ MarkerDetail GetMarkerDetail(const ACDB_marker_idx_type aIdx,
   }
 
   AttributeField lastModifiedAttributeField(
-      TextTranslator::GetInstance().Find((ACDB_text_handle_type)TextHandle::DateLastModifiedLabel),
+      &TextTranslator::GetInstance().Lookup(static_cast<int>(TextHandle::DateLastModifiedLabel)),
       std::move(lastModifiedDateStr), std::string(), std::string());
 
   std::string locationStr = StringFormatter::GetInstance().FormatPosition(aMarkerTableData.mPosn);
@@ -365,7 +379,7 @@ MarkerDetail GetMarkerDetail(const ACDB_marker_idx_type aIdx,
 
   TextHandle markerTypeTextHandle = GetMarkerTypeTextHandle(aMarkerTableData.mType);
   auto markerTypeAttributeField = AttributeField(
-      std::string(),
+      &NoLabel,
       TextTranslator::GetInstance().Find((ACDB_text_handle_type)markerTypeTextHandle),
       std::string(), std::string());
 
@@ -407,6 +421,7 @@ MarkerDetail GetMarkerDetail(const ACDB_marker_idx_type aIdx,
 //----------------------------------------------------------------
 MooringsPtr GetMoorings(const ACDB_marker_idx_type aIdx,
                         const MooringsTableDataType& aMooringsTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetMoorings");
   auto title = TextTranslator::GetInstance().Find(aMooringsTableData.mSectionTitle);
 
   auto attributeFields = GetAttributeFields(aMooringsTableData.mAttributeFieldsJson);
@@ -433,6 +448,7 @@ MooringsPtr GetMoorings(const ACDB_marker_idx_type aIdx,
 //----------------------------------------------------------------
 NavigationPtr GetNavigation(const ACDB_marker_idx_type aIdx,
                             const NavigationTableDataType& aNavigationTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetNavigation");
   auto title = TextTranslator::GetInstance().Find(aNavigationTableData.mSectionTitle);
 
   auto attributeFields = GetAttributeFields(aNavigationTableData.mAttributeFieldsJson);
@@ -452,6 +468,7 @@ NavigationPtr GetNavigation(const ACDB_marker_idx_type aIdx,
 //!
 //----------------------------------------------------------------
 RetailPtr GetRetail(const ACDB_marker_idx_type aIdx, const RetailTableDataType& aRetailTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetRetail");
   auto title = TextTranslator::GetInstance().Find(aRetailTableData.mSectionTitle);
 
   auto sectionNote = GetAttributeFieldOptional(aRetailTableData.mSectionNoteJson);
@@ -479,6 +496,7 @@ ReviewDetailPtr GetReviewDetail(
     std::vector<ReviewPhotoTableDataType>&& aFeaturedReviewPhotoTableData,
     const ACDB_type_type aType, const ReviewSummaryTableDataType& aReviewSummaryTableData,
     const std::string& aCaptainName) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetReviewDetail");
   TextHandle titleTextHandle;
   TextHandle editTextHandle;
   bool includeStars;
@@ -547,6 +565,7 @@ ReviewListPtr GetReviewList(const ACDB_marker_idx_type aIdx, const ACDB_type_typ
 
                             const std::string& aCaptainName, const int aPageNumber,
                             const int aPageSize) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetReviewList");
   TextHandle titleTextHandle;
   bool includeStars;
   TextHandle userReviewEditTextHandle;
@@ -630,6 +649,7 @@ ReviewListPtr GetReviewList(const ACDB_marker_idx_type aIdx, const ACDB_type_typ
 //----------------------------------------------------------------
 ReviewSummaryPtr GetReviewSummary(const ReviewSummaryTableDataType& aReviewSummaryData,
                                   const ACDB_type_type aType) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetReviewSummary");
   bool includeStars = !IsCommentsSectionType(aType);
 
   auto reviewSummary = ReviewSummaryPtr(new ReviewSummary(
@@ -645,6 +665,7 @@ ReviewSummaryPtr GetReviewSummary(const ReviewSummaryTableDataType& aReviewSumma
 //----------------------------------------------------------------
 ServicesPtr GetServices(const ACDB_marker_idx_type aIdx,
                         const ServicesTableDataType& aServicesTableData) {
+  ACDB_TRACE_SPAN("PresentationMarkerFactory::GetServices");
   auto title = TextTranslator::GetInstance().Find(aServicesTableData.mSectionTitle);
 
   auto sectionNote = GetAttributeFieldOptional(aServicesTableData.mSectionNoteJson);
@@ -669,7 +690,9 @@ ServicesPtr GetServices(const ACDB_marker_idx_type aIdx,
 //----------------------------------------------------------------
 static AttributeField GetAttributeField(const rapidjson::Value& aDocument,
                                         const bool aIsMultiValue) {
-  std::string label;
+  // Translations are pooled and shared by the field; labels from the data are copied.
+  const std::string* label = &NoLabel;
+  std::string ownedLabel;
   std::string value;
   std::string hyperLink;
   std::string note;
@@ -677,11 +700,12 @@ static AttributeField GetAttributeField(const rapidjson::Value& aDocument,
   auto fieldTextHandleIterator = aDocument.FindMember("fieldTextHandle");
   if (fieldTextHandleIterator != aDocument.MemberEnd()) {
     auto fieldTextHandle = fieldTextHandleIterator->value.GetInt();
-    label = TextTranslator::GetInstance().Find(fieldTextHandle);
+    label = &TextTranslator::GetInstance().Lookup(fieldTextHandle);
   } else {
     auto fieldIterator = aDocument.FindMember("field");
     if (fieldIterator != aDocument.MemberEnd()) {
-      label = fieldIterator->value.GetString();
+      label = nullptr;
+      ownedLabel = fieldIterator->value.GetString();
     }
   }
 
@@ -728,7 +752,11 @@ static AttributeField GetAttributeField(const rapidjson::Value& aDocument,
     note = noteIterator->value.GetString();
   }
 
-  return AttributeField(std::move(label), std::move(value), std::move(note), std::move(hyperLink));
+  if (label == nullptr) {
+    return AttributeField(ownedLabel, std::move(value), std::move(note), std::move(hyperLink));
+  }
+
+  return AttributeField(label, std::move(value), std::move(note), std::move(hyperLink));
 }  // end of GetAttributeField
 
 //----------------------------------------------------------------
@@ -743,7 +771,7 @@ static std::unique_ptr<AttributeField> GetAttributeFieldOptional(const std::stri
   std::unique_ptr<AttributeField> attributeField = nullptr;
 
   rapidjson::Document document;
-  document.Parse(aJson.c_str());
+  document.Parse(aJson.c_str(), aJson.size());
 
   if (document.IsObject()) {
     attributeField.reset(new AttributeField(GetAttributeField(document)));
@@ -761,7 +789,7 @@ static std::unique_ptr<AttributeField> GetAttributeFieldOptional(const std::stri
 static std::vector<AttributeField> GetAttributeFields(const std::string& aJson,
                                                       const bool aIsMultiValue) {
   rapidjson::Document document;
-  document.Parse(aJson.c_str());
+  document.Parse(aJson.c_str(), aJson.size());
 
   std::vector<AttributeField> attributeFields;
 
@@ -818,7 +846,7 @@ static AttributePriceField GetAttributePriceField(const rapidjson::Value& aDocum
 //----------------------------------------------------------------
 static std::vector<AttributePriceField> GetAttributePriceFields(const std::string& aJson) {
   rapidjson::Document document;
-  document.Parse(aJson.c_str());
+  document.Parse(aJson.c_str(), aJson.size());
 
   std::vector<AttributePriceField> attributePriceFields;
 
@@ -879,7 +907,7 @@ static BusinessPromotionField GetBusinessPromotionField(const rapidjson::Value&
 static BusinessPromotionListField GetBusinessPromotionListField(const std::string& aJson) {
   rapidjson::Document document;
 
-  document.Parse(aJson.c_str());
+  document.Parse(aJson.c_str(), aJson.size());
 
   std::string label;
   std::vector<BusinessPromotionField> businessPromotionFields;
@@ -926,7 +954,7 @@ static BusinessPromotionListField GetBusinessPromotionListField(const std::strin
 static LinkField GetLinkField(const std::string& aJson) {
   rapidjson::Document document;
 
-  document.Parse(aJson.c_str());
+  document.Parse(aJson.c_str(), aJson.size());
 
   std::string linkUrl;
   std::string linkText;
@@ -1103,7 +1131,7 @@ static StringField GetStringField(const rapidjson::Value& aDocument) {
 //----------------------------------------------------------------
 static std::vector<StringField> GetStringFields(const std::string& aJson) {
   rapidjson::Document document;
-  document.Parse(aJson.c_str());
+  document.Parse(aJson.c_str(), aJson.size());
 
   std::vector<StringField> stringFields;
 
@@ -1153,7 +1181,7 @@ static YesNoMultiValueField GetYesNoMultiValueField(const rapidjson::Value& aDoc
 //----------------------------------------------------------------
 static std::vector<YesNoMultiValueField> GetYesNoMultiValueFields(const std::string& aJson) {
   rapidjson::Document document;
-  document.Parse(aJson.c_str());
+  document.Parse(aJson.c_str(), aJson.size());
 
   std::vector<YesNoMultiValueField> yesNoMultiValueFields;
   std::vector<std::string> values;
@@ -1211,7 +1239,7 @@ static YesNoPriceField GetYesNoPriceField(const rapidjson::Value& aDocument) {
 //----------------------------------------------------------------
 static std::vector<YesNoPriceField> GetYesNoPriceFields(const std::string& aJson) {
   rapidjson::Document document;
-  document.Parse(aJson.c_str());
+  document.Parse(aJson.c_str(), aJson.size());
 
   std::vector<YesNoPriceField> yesNoPriceFields;
 
@@ -1234,7 +1262,7 @@ static std::vector<YesNoPriceField> GetYesNoPriceFields(const std::string& aJson
 //!
 //----------------------------------------------------------------
 static YesNoUnknownNearbyField GetYesNoUnknownNearbyField(const rapidjson::Value& aDocument) {
-  std::string label;
+  const std::string* label = &NoLabel;
   std::string value;
   std::string note;
   std::string altText;
@@ -1242,7 +1270,7 @@ static YesNoUnknownNearbyField GetYesNoUnknownNearbyField(const rapidjson::Value
   auto fieldTextHandleIterator = aDocument.FindMember("fieldTextHandle");
   if (fieldTextHandleIterator != aDocument.MemberEnd()) {
     auto fieldTextHandle = fieldTextHandleIterator->value.GetInt();
-    label = TextTranslator::GetInstance().Find(fieldTextHandle);
+    label = &TextTranslator::GetInstance().Lookup(fieldTextHandle);
   }
 
   auto valueIterator = aDocument.FindMember("value");
@@ -1258,8 +1286,7 @@ static YesNoUnknownNearbyField GetYesNoUnknownNearbyField(const rapidjson::Value
   auto altTextHandle = GetYesNoUnknownNearbyTextHandle(value);
   altText = TextTranslator::GetInstance().Find(static_cast<int>(altTextHandle));
 
-  return YesNoUnknownNearbyField(std::move(label), std::move(value), std::move(note),
-                                 std::move(altText));
+  return YesNoUnknownNearbyField(*label, std::move(value), std::move(note), std::move(altText));
 }  // end of GetYesNoUnknownNearbyField
 
 //----------------------------------------------------------------
@@ -1270,7 +1297,7 @@ static YesNoUnknownNearbyField GetYesNoUnknownNearbyField(const rapidjson::Value
 //----------------------------------------------------------------
 static std::vector<YesNoUnknownNearbyField> GetYesNoUnknownNearbyFields(const std::string& aJson) {
   rapidjson::Document document;
-  document.Parse(aJson.c_str());
+  document.Parse(aJson.c_str(), aJson.size());
 
   std::vector<YesNoUnknownNearbyField> yesNoUnknownNearbyFields;
 
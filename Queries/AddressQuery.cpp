@@ -161,7 +161,8 @@ bool AddressQuery::Get(const ACDB_marker_idx_type aId, AddressTableDataType& aRe
 //!   @brief Write address to database
 //!
 //----------------------------------------------------------------
-bool AddressQuery::Write(const ACDB_marker_idx_type aId, AddressTableDataType&& aAddressTableData) {
+bool AddressQuery::Write(const ACDB_marker_idx_type aId,
+                         const AddressTableDataType& aAddressTableData) {
   enum Parameters { Id = 1, SectionTitle, String, Labeled };
 
   if (!mWrite) {
@@ -173,8 +174,8 @@ bool AddressQuery::Write(const ACDB_marker_idx_type aId, AddressTableDataType&&
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aAddressTableData.mSectionTitle);
-    mWrite->bind(Parameters::String, aAddressTableData.mStringFieldsJson);
-    mWrite->bind(Parameters::Labeled, aAddressTableData.mAttributeFieldsJson);
+    mWrite->bindNoCopy(Parameters::String, aAddressTableData.mStringFieldsJson);
+    mWrite->bindNoCopy(Parameters::Labeled, aAddressTableData.mAttributeFieldsJson);
 
     success = mWrite->exec();
 
@@ -163,7 +163,7 @@ bool AmenitiesQuery::Get(const ACDB_marker_idx_type aId, AmenitiesTableDataType&
 //!
 //----------------------------------------------------------------
 bool AmenitiesQuery::Write(const ACDB_marker_idx_type aId,
-                           AmenitiesTableDataType&& aAmenitiesTableData) {
+                           const AmenitiesTableDataType& aAmenitiesTableData) {
   enum Parameters { Id = 1, SectionTitle, SectionNote, YesNo };
 
   if (!mWrite) {
@@ -175,8 +175,8 @@ bool AmenitiesQuery::Write(const ACDB_marker_idx_type aId,
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aAmenitiesTableData.mSectionTitle);
-    mWrite->bind(Parameters::SectionNote, aAmenitiesTableData.mSectionNoteJson);
-    mWrite->bind(Parameters::YesNo, aAmenitiesTableData.mYesNoJson);
+    mWrite->bindNoCopy(Parameters::SectionNote, aAmenitiesTableData.mSectionNoteJson);
+    mWrite->bindNoCopy(Parameters::YesNo, aAmenitiesTableData.mYesNoJson);
 
     success = mWrite->exec();
 
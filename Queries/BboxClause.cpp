@@ -0,0 +1,120 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Plans the spatial part of marker queries, so that a bounding box
+    crossing the antimeridian is read by one statement.
+
+    A bounding box is normalized into one or two parts.  One part is
+    matched directly against rIndex; several parts are probed in a
+    UNION ALL subquery.  Either way the query keeps a single WHERE
+    clause, so its LIMIT and ORDER BY apply to all parts at once.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "BboxClause"
+
+#include "Acdb/Queries/BboxClause.hpp"
+#include "Acdb/GeoUtil.hpp"
+#include "DBG_pub.h"
+
+namespace Acdb {
+namespace BboxClause {
+
+// ri is the rIndex entry joined to the markers m of the query.
+static const std::string PartSql{"minLon > ? AND maxLon < ? AND minLat > ? AND maxLat < ? "};
+static const std::string PartsSqlStart{"m.id IN ("};
+static const std::string PartSqlStart{"SELECT id FROM rIndex WHERE "};
+static const std::string PartsSqlSeparator{"UNION ALL "};
+static const std::string PartsSqlEnd{") "};
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Normalize a bounding box into the parts to search:
+//!   the box itself, or the parts West and East of the
+//!   antimeridian if it crosses it.
+//!
+//----------------------------------------------------------------
+std::vector<bbox_type> GetParts(const bbox_type& aBbox) {
+  bbox_type leftBbox;
+  bbox_type rightBbox;
+  if (Geo::SplitCrossMeridianBbox(aBbox, leftBbox, rightBbox)) {
+    return {leftBbox, rightBbox};
+  }
+
+  return {aBbox};
+}  // end of GetParts
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the WHERE clause condition matching markers in
+//!   aPartCount bounding box parts, for a query of markers m
+//!   joined to rIndex ri.
+//!
+//----------------------------------------------------------------
+std::string GetSql(const size_t aPartCount) {
+  DBG_ASSERT(aPartCount > 0, "Bounding box without parts.");
+
+  if (aPartCount == 1) {
+    return PartSql;
+  }
+
+  std::string sql = PartsSqlStart;
+  for (size_t i = 0; i < aPartCount; i++) {
+    if (i > 0) {
+      sql += PartsSqlSeparator;
+    }
+
+    sql += PartSqlStart + PartSql;
+  }
+  sql += PartsSqlEnd;
+
+  return sql;
+}  // end of GetSql
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Bind the bounding box parts to the parameters of the
+//!   clause from GetSql, starting at aFirstParameter.
+//!
+//!   @return the parameter following the clause
+//!
+//----------------------------------------------------------------
+int Bind(SQLite::Statement& aStatement, const int aFirstParameter,
+         const std::vector<bbox_type>& aParts) {
+  enum Parameters { MinLon = 0, MaxLon, MinLat, MaxLat };
+
+  int parameter = aFirstParameter;
+  for (const bbox_type& part : aParts) {
+    aStatement.bind(parameter + Parameters::MinLon, part.swc.lon);
+    aStatement.bind(parameter + Parameters::MaxLon, part.nec.lon);
+    aStatement.bind(parameter + Parameters::MinLat, part.swc.lat);
+    aStatement.bind(parameter + Parameters::MaxLat, part.nec.lat);
+
+    parameter += ParametersPerPart;
+  }
+
+  return parameter;
+}  // end of Bind
+
+}  // end of namespace BboxClause
+}  // end of namespace Acdb
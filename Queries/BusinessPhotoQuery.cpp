@@ -167,7 +167,7 @@ bool BusinessPhotoQuery::Get(const ACDB_marker_idx_type aId,
 //!
 //----------------------------------------------------------------
 bool BusinessPhotoQuery::Write(const ACDB_marker_idx_type aId,
-                               BusinessPhotoTableDataType&& aBusinessPhotoTableData) {
+                               const BusinessPhotoTableDataType& aBusinessPhotoTableData) {
   enum Parameters { Id = 1, Ordinal, DownloadUrl };
   if (!mWrite) {
     return false;
@@ -178,7 +178,7 @@ bool BusinessPhotoQuery::Write(const ACDB_marker_idx_type aId,
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::Ordinal, aBusinessPhotoTableData.mOrdinal);
-    mWrite->bind(Parameters::DownloadUrl, aBusinessPhotoTableData.mDownloadUrl);
+    mWrite->bindNoCopy(Parameters::DownloadUrl, aBusinessPhotoTableData.mDownloadUrl);
 
     success = mWrite->exec();
 
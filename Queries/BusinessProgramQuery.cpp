@@ -164,7 +164,7 @@ bool BusinessProgramQuery::Get(const ACDB_marker_idx_type aId,
 //!
 //----------------------------------------------------------------
 bool BusinessProgramQuery::Write(const ACDB_marker_idx_type aId,
-                                 BusinessProgramTableDataType&& aBusinessProgramTableData) {
+                                 const BusinessProgramTableDataType& aBusinessProgramTableData) {
   enum Parameters { Id = 1, CompetitorAd, ProgramTier };
   if (!mWrite) {
     return false;
@@ -174,7 +174,7 @@ bool BusinessProgramQuery::Write(const ACDB_marker_idx_type aId,
 
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
-    mWrite->bind(Parameters::CompetitorAd, aBusinessProgramTableData.mCompetitorAdJson);
+    mWrite->bindNoCopy(Parameters::CompetitorAd, aBusinessProgramTableData.mCompetitorAdJson);
     mWrite->bind(Parameters::ProgramTier, aBusinessProgramTableData.mProgramTier);
 
     success = mWrite->exec();
@@ -166,7 +166,7 @@ bool BusinessQuery::Get(const ACDB_marker_idx_type aId, BusinessTableDataType& a
 //!
 //----------------------------------------------------------------
 bool BusinessQuery::Write(const ACDB_marker_idx_type aId,
-                          BusinessTableDataType&& aBusinessTableData) {
+                          const BusinessTableDataType& aBusinessTableData) {
   enum Parameters {
     Id = 1,
     SectionTitle,
@@ -185,10 +185,11 @@ bool BusinessQuery::Write(const ACDB_marker_idx_type aId,
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aBusinessTableData.mSectionTitle);
-    mWrite->bind(Parameters::Labeled, aBusinessTableData.mAttributeFieldsJson);
-    mWrite->bind(Parameters::CommaSeparatedList, aBusinessTableData.mAttributeMultiValueFieldsJson);
-    mWrite->bind(Parameters::BusinessPromotions, aBusinessTableData.mBusinessPromotionsJson);
-    mWrite->bind(Parameters::CallToAction, aBusinessTableData.mCallToActionJson);
+    mWrite->bindNoCopy(Parameters::Labeled, aBusinessTableData.mAttributeFieldsJson);
+    mWrite->bindNoCopy(Parameters::CommaSeparatedList,
+                       aBusinessTableData.mAttributeMultiValueFieldsJson);
+    mWrite->bindNoCopy(Parameters::BusinessPromotions, aBusinessTableData.mBusinessPromotionsJson);
+    mWrite->bindNoCopy(Parameters::CallToAction, aBusinessTableData.mCallToActionJson);
 
     success = mWrite->exec();
 
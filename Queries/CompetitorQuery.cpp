@@ -261,7 +261,7 @@ bool CompetitorQuery::GetPotentialAdvertisers(const ACDB_marker_idx_type aId,
 //!
 //----------------------------------------------------------------
 bool CompetitorQuery::Write(const ACDB_marker_idx_type aId,
-                            CompetitorTableDataType&& aCompetitorTableData) {
+                            const CompetitorTableDataType& aCompetitorTableData) {
   enum Parameters { PoiId = 1, CompetitorPoiId, Ordinal };
 
   if (!mWrite) {
@@ -163,7 +163,8 @@ bool ContactQuery::Get(const ACDB_marker_idx_type aId, ContactTableDataType& aRe
 //!   @brief Write contact to database
 //!
 //----------------------------------------------------------------
-bool ContactQuery::Write(const ACDB_marker_idx_type aId, ContactTableDataType&& aContactTableData) {
+bool ContactQuery::Write(const ACDB_marker_idx_type aId,
+                         const ContactTableDataType& aContactTableData) {
   enum Parameters { Id = 1, SectionTitle, Labeled, Phone, VhfChannel };
 
   if (!mWrite) {
@@ -175,9 +176,9 @@ bool ContactQuery::Write(const ACDB_marker_idx_type aId, ContactTableDataType&&
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aContactTableData.mSectionTitle);
-    mWrite->bind(Parameters::Labeled, aContactTableData.mAttributeFieldsJson);
-    mWrite->bind(Parameters::Phone, aContactTableData.mPhone);
-    mWrite->bind(Parameters::VhfChannel, aContactTableData.mVhfChannel);
+    mWrite->bindNoCopy(Parameters::Labeled, aContactTableData.mAttributeFieldsJson);
+    mWrite->bindNoCopy(Parameters::Phone, aContactTableData.mPhone);
+    mWrite->bindNoCopy(Parameters::VhfChannel, aContactTableData.mVhfChannel);
 
     success = mWrite->exec();
 
@@ -175,7 +175,8 @@ bool DockageQuery::Get(const ACDB_marker_idx_type aId, DockageTableDataType& aRe
 //!   @brief Write Dockage to database
 //!
 //----------------------------------------------------------------
-bool DockageQuery::Write(const ACDB_marker_idx_type aId, DockageTableDataType&& aDockageTableData) {
+bool DockageQuery::Write(const ACDB_marker_idx_type aId,
+                         const DockageTableDataType& aDockageTableData) {
   enum Parameters {
     Id = 1,
     SectionTitle,
@@ -196,11 +197,11 @@ bool DockageQuery::Write(const ACDB_marker_idx_type aId, DockageTableDataType&&
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aDockageTableData.mSectionTitle);
-    mWrite->bind(Parameters::CommaSeparatedList, aDockageTableData.mYesNoMultiValueJson);
-    mWrite->bind(Parameters::Price, aDockageTableData.mAttributePriceJson);
-    mWrite->bind(Parameters::Labeled, aDockageTableData.mAttributeFieldsJson);
-    mWrite->bind(Parameters::SectionNote, aDockageTableData.mSectionNoteJson);
-    mWrite->bind(Parameters::YesNo, aDockageTableData.mYesNoJson);
+    mWrite->bindNoCopy(Parameters::CommaSeparatedList, aDockageTableData.mYesNoMultiValueJson);
+    mWrite->bindNoCopy(Parameters::Price, aDockageTableData.mAttributePriceJson);
+    mWrite->bindNoCopy(Parameters::Labeled, aDockageTableData.mAttributeFieldsJson);
+    mWrite->bindNoCopy(Parameters::SectionNote, aDockageTableData.mSectionNoteJson);
+    mWrite->bindNoCopy(Parameters::YesNo, aDockageTableData.mYesNoJson);
     mWrite->bind(Parameters::DistanceUnit, aDockageTableData.mDistanceUnit);
 
     success = mWrite->exec();
@@ -180,7 +180,7 @@ bool FuelQuery::Get(const ACDB_marker_idx_type aId, FuelTableDataType& aResultOu
 //!   @brief Write fuel to database
 //!
 //----------------------------------------------------------------
-bool FuelQuery::Write(const ACDB_marker_idx_type aId, FuelTableDataType&& aFuelTableData) {
+bool FuelQuery::Write(const ACDB_marker_idx_type aId, const FuelTableDataType& aFuelTableData) {
   enum Parameters {
     Id = 1,
     SectionTitle,
@@ -204,12 +204,12 @@ bool FuelQuery::Write(const ACDB_marker_idx_type aId, FuelTableDataType&& aFuelT
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aFuelTableData.mSectionTitle);
-    mWrite->bind(Parameters::PriceList, aFuelTableData.mYesNoPriceJson);
-    mWrite->bind(Parameters::YesNo, aFuelTableData.mYesNoJson);
-    mWrite->bind(Parameters::Labeled, aFuelTableData.mAttributeFieldsJson);
-    mWrite->bind(Parameters::SectionNote, aFuelTableData.mSectionNoteJson);
+    mWrite->bindNoCopy(Parameters::PriceList, aFuelTableData.mYesNoPriceJson);
+    mWrite->bindNoCopy(Parameters::YesNo, aFuelTableData.mYesNoJson);
+    mWrite->bindNoCopy(Parameters::Labeled, aFuelTableData.mAttributeFieldsJson);
+    mWrite->bindNoCopy(Parameters::SectionNote, aFuelTableData.mSectionNoteJson);
     mWrite->bind(Parameters::DistanceUnit, aFuelTableData.mDistanceUnit);
-    mWrite->bind(Parameters::Currency, aFuelTableData.mCurrency);
+    mWrite->bindNoCopy(Parameters::Currency, aFuelTableData.mCurrency);
     mWrite->bind(Parameters::DieselPrice, aFuelTableData.mDieselPrice);
     mWrite->bind(Parameters::GasPrice, aFuelTableData.mGasPrice);
     mWrite->bind(Parameters::VolumeUnit, aFuelTableData.mVolumeUnit);
@@ -93,7 +93,7 @@ bool LanguageQuery::GetAll(std::vector<LanguageTableDataType>& aResultOut) {
 //!   @brief Write language to database
 //!
 //----------------------------------------------------------------
-bool LanguageQuery::Write(LanguageTableDataType&& aLanguageTableData) {
+bool LanguageQuery::Write(const LanguageTableDataType& aLanguageTableData) {
   enum Parameters { Id = 1, IsoCode };
 
   if (!mWrite) {
@@ -104,7 +104,7 @@ bool LanguageQuery::Write(LanguageTableDataType&& aLanguageTableData) {
 
   try {
     mWrite->bind(Parameters::Id, aLanguageTableData.mId);
-    mWrite->bind(Parameters::IsoCode, aLanguageTableData.mIsoCode);
+    mWrite->bindNoCopy(Parameters::IsoCode, aLanguageTableData.mIsoCode);
 
     success = mWrite->exec();
 
@@ -0,0 +1,364 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Maintains the attribute index used by search filters.
+
+    The markers table comes from the server, so the index lives in
+    a table created and maintained on the client: markerAttributes
+    holds a SearchMarkerFilter::MarkerAttribute bitmask for every
+    marker, computed from the yes/no fields of its sections.  The
+    bitmask is recomputed from the stored sections, so it always
+    matches them, whichever sections an update carried.
+
+    The table is created and filled in one transaction by Rebuild,
+    and every marker write after that keeps it current, so its
+    presence is the record that the index is complete.  Opening a
+    database never issues DDL.
+
+    Until Rebuild runs, search filters compute the bitmask from the
+    stored sections with the acdbMarkerAttributes() SQL function
+    registered by CreateFunction.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "MarkerAttributeQuery"
+
+#include "ACDB_pub_types.h"
+#include "Acdb/MarkerAttributes.hpp"
+#include "Acdb/Queries/MarkerAttributeQuery.hpp"
+#include "Acdb/SqliteCppUtil.hpp"
+#include "DBG_pub.h"
+#include "SQLiteCpp/Column.h"
+#include "SQLiteCpp/Database.h"
+#include "sqlite3.h"
+
+namespace Acdb {
+
+static const char* const AttributesFunction = "acdbMarkerAttributes";
+static const std::string AttributesTable{"markerAttributes"};
+static const std::string CreateTableSql{
+    "CREATE TABLE IF NOT EXISTS markerAttributes( id INTEGER PRIMARY KEY NOT NULL, "
+    "attributes INTEGER NOT NULL );"};
+static const std::string ClearSql{"DELETE FROM markerAttributes;"};
+static const std::string DeleteSql{"DELETE FROM markerAttributes WHERE id = ?;"};
+static const std::string DeleteGeohashSql{
+    "DELETE FROM markerAttributes "
+    "WHERE id IN (SELECT id FROM markers WHERE geohash BETWEEN ? AND ?);"};
+// Every JSON column with yes/no fields.
+static const std::string ReadSectionsSql{
+    "SELECT m.id, a.yesNo, d.commaSeparatedList, d.yesNo, f.priceList, f.yesNo, mo.price, "
+    "    mo.yesNo, r.yesNo, s.yesNo "
+    "FROM markers m "
+    "    LEFT JOIN amenities a ON m.id = a.id "
+    "    LEFT JOIN dockage d ON m.id = d.id "
+    "    LEFT JOIN fuel f ON m.id = f.id "
+    "    LEFT JOIN mooring mo ON m.id = mo.id "
+    "    LEFT JOIN retail r ON m.id = r.id "
+    "    LEFT JOIN services s ON m.id = s.id "};
+static const std::string ReadSectionsByIdSql{ReadSectionsSql + "WHERE m.id = ?;"};
+static const std::string WriteSql{
+    "INSERT OR REPLACE INTO markerAttributes (id, attributes) VALUES (?, ?);"};
+
+static void OnAttributes(sqlite3_context* aContext, int aArgCount, sqlite3_value** aArgs);
+
+static uint64_t ReadAttributes(SQLite::Statement& aStatement);
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create MarkerAttribute query object.  Statements are
+//!   only prepared if the database already has the attribute
+//!   table; otherwise they are prepared by Rebuild.
+//!
+//----------------------------------------------------------------
+MarkerAttributeQuery::MarkerAttributeQuery(SQLite::Database& aDatabase) : mDatabase{aDatabase} {
+  try {
+    if (aDatabase.tableExists(AttributesTable)) {
+      PrepareStatements();
+    }
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+  }
+}  // End of MarkerAttributeQuery
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Register acdbMarkerAttributes() on aDatabase.  It
+//!   returns the attributes of the yes/no fields JSON columns
+//!   passed to it, ignoring NULLs, like the index stores them.
+//!
+//----------------------------------------------------------------
+bool MarkerAttributeQuery::CreateFunction(SQLite::Database& aDatabase) {
+  const int result = sqlite3_create_function_v2(
+      aDatabase.getHandle(), AttributesFunction, -1, SQLITE_UTF8 | SQLITE_DETERMINISTIC,
+      nullptr, OnAttributes, nullptr, nullptr, nullptr);
+  DBG_W_IF(result != SQLITE_OK, "Failed to create %s: %i", AttributesFunction, result);
+
+  return result == SQLITE_OK;
+}  // End of CreateFunction
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Delete the attributes of the specified marker.
+//!
+//----------------------------------------------------------------
+bool MarkerAttributeQuery::Delete(const ACDB_marker_idx_type aId) {
+  enum Parameters { Id = 1 };
+
+  if (!IsComplete()) {
+    // Nothing to maintain until Rebuild indexes every marker.
+    return true;
+  }
+
+  bool success = false;
+
+  try {
+    mDelete->bind(Parameters::Id, static_cast<int64_t>(aId));
+
+    mDelete->exec();
+    success = mDelete->isDone();
+
+    mDelete->reset();
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  return success;
+}  // End of Delete
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Delete attributes from database by geohash.  Must be
+//!   called before the markers are deleted.
+//!
+//----------------------------------------------------------------
+bool MarkerAttributeQuery::Delete(const uint64_t aGeohashStart, const uint64_t aGeohashEnd) {
+  enum Parameters { GeohashStart = 1, GeohashEnd };
+
+  if (!IsComplete()) {
+    // Nothing to maintain until Rebuild indexes every marker.
+    return true;
+  }
+
+  bool success = false;
+
+  try {
+    mDeleteGeohash->bind(Parameters::GeohashStart, static_cast<int64_t>(aGeohashStart));
+    mDeleteGeohash->bind(Parameters::GeohashEnd, static_cast<int64_t>(aGeohashEnd));
+
+    mDeleteGeohash->exec();
+    success = mDeleteGeohash->isDone();
+
+    mDeleteGeohash->reset();
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  return success;
+}  // End of Delete
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Check whether the attribute table has been built.
+//!   This does not read the database.
+//!
+//!   @return false if the attribute table needs to be rebuilt
+//!
+//----------------------------------------------------------------
+bool MarkerAttributeQuery::IsComplete() const {
+  return mWrite != nullptr;
+}  // End of IsComplete
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create the attribute table if needed and recreate the
+//!   attributes of all markers.  Callers should wrap this in a
+//!   transaction, so that the table only exists once filled.
+//!
+//----------------------------------------------------------------
+bool MarkerAttributeQuery::Rebuild() {
+  enum Parameters { Id = 1, Attributes };
+  enum Columns { ColId = 0 };
+
+  bool success = false;
+
+  try {
+    mDatabase.exec(CreateTableSql);
+
+    if (!IsComplete()) {
+      PrepareStatements();
+    }
+
+    mDatabase.exec(ClearSql);
+
+    SQLite::Statement readSections{mDatabase, ReadSectionsSql + ";"};
+
+    success = true;
+    while (success && readSections.executeStep()) {
+      mWrite->bind(Parameters::Id, readSections.getColumn(Columns::ColId).getInt64());
+      mWrite->bind(Parameters::Attributes, static_cast<int64_t>(ReadAttributes(readSections)));
+
+      success = mWrite->exec();
+
+      mWrite->reset();
+    }
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  if (!success) {
+    // The caller rolls back, possibly dropping the new table.
+    ResetStatements();
+  }
+
+  return success;
+}  // End of Rebuild
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Write the attributes of the specified marker from its
+//!   stored sections.  Must be called after the sections are
+//!   written.
+//!
+//----------------------------------------------------------------
+bool MarkerAttributeQuery::Write(const ACDB_marker_idx_type aId) {
+  enum Parameters { Id = 1, Attributes };
+  enum ReadParameters { ReadId = 1 };
+
+  if (!IsComplete()) {
+    // Nothing to maintain until Rebuild indexes every marker.
+    return true;
+  }
+
+  bool success = false;
+
+  try {
+    mReadSections->bind(ReadParameters::ReadId, static_cast<int64_t>(aId));
+
+    uint64_t attributes = 0;
+    success = mReadSections->executeStep();
+    if (success) {
+      attributes = ReadAttributes(*mReadSections);
+    }
+
+    mReadSections->reset();
+
+    if (success) {
+      mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
+      mWrite->bind(Parameters::Attributes, static_cast<int64_t>(attributes));
+
+      success = mWrite->exec();
+
+      mWrite->reset();
+    }
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  return success;
+}  // End of Write
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Prepare the statements on the attribute table, which
+//!   must exist.  On failure no statement is kept.
+//!
+//----------------------------------------------------------------
+void MarkerAttributeQuery::PrepareStatements() {
+  try {
+    mDelete.reset(new SQLite::Statement{mDatabase, DeleteSql});
+    mDeleteGeohash.reset(new SQLite::Statement{mDatabase, DeleteGeohashSql});
+    mReadSections.reset(new SQLite::Statement{mDatabase, ReadSectionsByIdSql});
+    mWrite.reset(new SQLite::Statement{mDatabase, WriteSql});
+  } catch (const SQLite::Exception&) {
+    ResetStatements();
+    throw;
+  }
+}  // End of PrepareStatements
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Drop the prepared statements, e.g. when a failed
+//!   rebuild is about to be rolled back with its table.
+//!
+//----------------------------------------------------------------
+void MarkerAttributeQuery::ResetStatements() {
+  mDelete.reset();
+  mDeleteGeohash.reset();
+  mReadSections.reset();
+  mWrite.reset();
+}  // End of ResetStatements
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Implement acdbMarkerAttributes(), see CreateFunction.
+//!
+//----------------------------------------------------------------
+static void OnAttributes(sqlite3_context* aContext, int aArgCount, sqlite3_value** aArgs) {
+  uint64_t attributes = 0;
+
+  for (int i = 0; i < aArgCount; i++) {
+    const unsigned char* yesNoJson = sqlite3_value_text(aArgs[i]);
+    if (yesNoJson != nullptr) {
+      attributes |= MarkerAttributes::GetAttributes(reinterpret_cast<const char*>(yesNoJson),
+                                                    sqlite3_value_bytes(aArgs[i]));
+    }
+  }
+
+  sqlite3_result_int64(aContext, static_cast<sqlite3_int64>(attributes));
+}  // End of OnAttributes
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get the attributes of all yes/no fields columns read
+//!   by aStatement.
+//!
+//----------------------------------------------------------------
+static uint64_t ReadAttributes(SQLite::Statement& aStatement) {
+  // The yes/no fields columns follow the id.
+  const int FirstColumn = 1;
+
+  uint64_t attributes = 0;
+
+  for (int column = FirstColumn; column < aStatement.getColumnCount(); column++) {
+    if (!aStatement.isColumnNull(column)) {
+      const SqliteCppUtil::ColumnText yesNoJson = SqliteCppUtil::GetColumnText(aStatement, column);
+      attributes |= MarkerAttributes::GetAttributes(yesNoJson.mData, yesNoJson.mSize);
+    }
+  }
+
+  return attributes;
+}  // End of ReadAttributes
+
+}  // end of namespace Acdb
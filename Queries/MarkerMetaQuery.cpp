@@ -161,7 +161,7 @@ bool MarkerMetaQuery::Get(const ACDB_marker_idx_type aId, MarkerMetaTableDataTyp
 //!
 //----------------------------------------------------------------
 bool MarkerMetaQuery::Write(const ACDB_marker_idx_type aId,
-                            MarkerMetaTableDataType&& aMarkerMetaTableData) {
+                            const MarkerMetaTableDataType& aMarkerMetaTableData) {
   enum Parameters { Id = 1, SectionTitle, SectionNote };
 
   if (!mWrite) {
@@ -173,7 +173,7 @@ bool MarkerMetaQuery::Write(const ACDB_marker_idx_type aId,
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aMarkerMetaTableData.mSectionTitle);
-    mWrite->bind(Parameters::SectionNote, aMarkerMetaTableData.mSectionNoteJson);
+    mWrite->bindNoCopy(Parameters::SectionNote, aMarkerMetaTableData.mSectionNoteJson);
 
     success = mWrite->exec();
 
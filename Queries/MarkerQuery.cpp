@@ -25,7 +25,9 @@ limitations under the License.
 #define DBG_TAG "MarkerQuery"
 
 #include "ACDB_pub_types.h"
+#include "Acdb/Queries/BboxClause.hpp"
 #include "Acdb/Queries/MarkerQuery.hpp"
+#include "Acdb/SqliteCppUtil.hpp"
 #include "DBG_pub.h"
 #include "SQLiteCpp/Column.h"
 
@@ -37,12 +39,12 @@ static const std::string ReadSql{
     "SELECT m.id, m.poi_type, m.lastUpdate, m.name, m.searchFilter, m.geohash, ri.minLon, ri.minLat, COALESCE(bp.programTier, -1) programTier "
     "FROM markers m INNER JOIN rIndex ri ON m.Id = ri.Id LEFT JOIN businessProgram bp ON m.Id = bp.Id "
     "WHERE m.id = ?;"};
-static const std::string ReadFilteredSql{
+static const std::string ReadAllSql{
     "SELECT m.id, m.poi_type, m.lastUpdate, m.name, m.searchFilter, m.geohash, ri.minLon, ri.minLat, COALESCE(bp.programTier, -1) programTier "
-    "FROM markers m INNER JOIN rIndex ri ON m.Id = ri.Id LEFT JOIN businessProgram bp ON m.Id = bp.Id "
-    "WHERE minLon > ? AND maxLon < ? "
-    "AND minLat > ? AND maxLat < ? "
-    "AND m.poi_type & ?;"};
+    "FROM markers m INNER JOIN rIndex ri ON m.Id = ri.Id LEFT JOIN businessProgram bp ON m.Id = bp.Id "};
+// The bounding box clause is filled in between the start and the end.
+static const std::string ReadFilteredSqlStart{ReadAllSql + "WHERE "};
+static const std::string ReadFilteredSqlEnd{"AND m.poi_type & ?;"};
 static const std::string ReadIds{
     "SELECT id "
     "FROM markers "
@@ -52,6 +54,8 @@ static const std::string ReadLastUpdateSql{"SELECT MAX(lastUpdate) FROM markers;
 static const std::string WriteSql{
     "INSERT OR REPLACE INTO markers (id, poi_type, lastUpdate, name, searchFilter, geohash) VALUES (?, ?, ?, ?, ?, ?)"};
 
+static void ReadColumns(SQLite::Statement& aStatement, MapMarkerColumns& aResultOut);
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -63,7 +67,11 @@ MarkerQuery::MarkerQuery(SQLite::Database& aDatabase) {
     mDelete.reset(new SQLite::Statement{aDatabase, DeleteSql});
     mDeleteGeohash.reset(new SQLite::Statement{aDatabase, DeleteGeohashSql});
     mRead.reset(new SQLite::Statement{aDatabase, ReadSql});
-    mReadFiltered.reset(new SQLite::Statement{aDatabase, ReadFilteredSql});
+    mReadAll.reset(new SQLite::Statement{aDatabase, ReadAllSql});
+    mReadFiltered.reset(new SQLite::Statement{
+        aDatabase, ReadFilteredSqlStart + BboxClause::GetSql(1) + ReadFilteredSqlEnd});
+    mReadSplitFiltered.reset(new SQLite::Statement{
+        aDatabase, ReadFilteredSqlStart + BboxClause::GetSql(2) + ReadFilteredSqlEnd});
     mReadIds.reset(new SQLite::Statement{aDatabase, ReadIds});
     mReadLastUpdate.reset(new SQLite::Statement{aDatabase, ReadLastUpdateSql});
     mWrite.reset(new SQLite::Statement{aDatabase, WriteSql});
@@ -72,7 +80,9 @@ MarkerQuery::MarkerQuery(SQLite::Database& aDatabase) {
     mDelete.reset();
     mDeleteGeohash.reset();
     mRead.reset();
+    mReadAll.reset();
     mReadFiltered.reset();
+    mReadSplitFiltered.reset();
     mReadIds.reset();
     mReadLastUpdate.reset();
     mWrite.reset();
@@ -194,64 +204,71 @@ bool MarkerQuery::Get(const ACDB_marker_idx_type aId, MarkerTableDataType& aResu
 //----------------------------------------------------------------
 //!
 //!   @public
-//!   @detail Get a list of item records based on the specified
-//!   filer.
+//!   @detail Get the markers matching the specified filter as
+//!   columns.
 //!
 //----------------------------------------------------------------
-bool MarkerQuery::GetFiltered(const MapMarkerFilter& aFilter,
-                              std::vector<MarkerTableDataType>& aResultOut) {
-  enum Parameters { MinLon = 1, MaxLon, MinLat, MaxLat, PoiTypeMask };
-  enum Columns {
-    ColId = 0,
-    PoiType,
-    LastUpdate,
-    Name,
-    SearchFilter,
-    Geohash,
-    Lon,
-    Lat,
-    ProgramTier
-  };
+bool MarkerQuery::GetFiltered(const MapMarkerFilter& aFilter, MapMarkerColumns& aResultOut) {
+  enum Parameters { FirstBbox = 1 };
+  enum FilterParameters { PoiTypeMask = 0 };
+
+  const std::vector<bbox_type> bboxes = BboxClause::GetParts(aFilter.GetBbox());
+  const std::unique_ptr<SQLite::Statement>& readFiltered =
+      (bboxes.size() == 1) ? mReadFiltered : mReadSplitFiltered;
 
-  if (!mReadFiltered) {
+  if (!readFiltered) {
     return false;
   }
 
   bool success = false;
+  const size_t initialSize = aResultOut.Size();
 
   try {
-    mReadFiltered->bind(Parameters::MinLon, aFilter.GetBbox().swc.lon);
-    mReadFiltered->bind(Parameters::MaxLon, aFilter.GetBbox().nec.lon);
-    mReadFiltered->bind(Parameters::MinLat, aFilter.GetBbox().swc.lat);
-    mReadFiltered->bind(Parameters::MaxLat, aFilter.GetBbox().nec.lat);
-    mReadFiltered->bind(Parameters::PoiTypeMask, aFilter.GetAllowedTypes());
-
-    while (mReadFiltered->executeStep()) {
-      MarkerTableDataType result;
-      result.mId = mReadFiltered->getColumn(Columns::ColId).getInt64();
-      result.mType = mReadFiltered->getColumn(Columns::PoiType).getInt();
-      result.mLastUpdated = mReadFiltered->getColumn(Columns::LastUpdate).getInt64();
-      result.mName = mReadFiltered->getColumn(Columns::Name).getText();
-      result.mSearchFilter = mReadFiltered->getColumn(Columns::SearchFilter).getInt64();
-      result.mGeohash = mReadFiltered->getColumn(Columns::Geohash).getInt64();
-      result.mPosn.lat = mReadFiltered->getColumn(Columns::Lat).getUInt();
-      result.mPosn.lon = mReadFiltered->getColumn(Columns::Lon).getUInt();
-      result.mBusinessProgramTier = mReadFiltered->getColumn(Columns::ProgramTier).getInt();
-
-      aResultOut.push_back(std::move(result));
-    }
+    const int offset = BboxClause::Bind(*readFiltered, Parameters::FirstBbox, bboxes);
+    readFiltered->bind(offset + FilterParameters::PoiTypeMask, aFilter.GetAllowedTypes());
 
-    success = !aResultOut.empty();
+    ReadColumns(*readFiltered, aResultOut);
 
-    mReadFiltered->reset();
+    success = aResultOut.Size() > initialSize;
+
+    readFiltered->reset();
   } catch (const SQLite::Exception& e) {
     DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    SqliteCppUtil::ResetStatement(*readFiltered);
     success = false;
   }
 
   return success;
 }  // End of GetFiltered
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get every marker as columns, e.g. to write a marker
+//!   snapshot.
+//!
+//----------------------------------------------------------------
+bool MarkerQuery::GetAll(MapMarkerColumns& aResultOut) {
+  if (!mReadAll) {
+    return false;
+  }
+
+  bool success = false;
+
+  try {
+    ReadColumns(*mReadAll, aResultOut);
+    success = true;
+
+    mReadAll->reset();
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    SqliteCppUtil::ResetStatement(*mReadAll);
+    success = false;
+  }
+
+  return success;
+}  // End of GetAll
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -325,7 +342,8 @@ bool MarkerQuery::GetIds(const uint32_t aPageNumber, const uint32_t aPageSize,
 //!   @brief Write marker to database
 //!
 //----------------------------------------------------------------
-bool MarkerQuery::Write(const ACDB_marker_idx_type aId, MarkerTableDataType&& aMarkerTableData) {
+bool MarkerQuery::Write(const ACDB_marker_idx_type aId,
+                        const MarkerTableDataType& aMarkerTableData) {
   enum Parameters { Id = 1, PoiType, LastUpdate, Name, SearchFilter, Geohash };
 
   if (!mWrite) {
@@ -338,7 +356,7 @@ bool MarkerQuery::Write(const ACDB_marker_idx_type aId, MarkerTableDataType&& aM
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::PoiType, aMarkerTableData.mType);
     mWrite->bind(Parameters::LastUpdate, static_cast<int64_t>(aMarkerTableData.mLastUpdated));
-    mWrite->bind(Parameters::Name, aMarkerTableData.mName);
+    mWrite->bindNoCopy(Parameters::Name, aMarkerTableData.mName);
     mWrite->bind(Parameters::SearchFilter, static_cast<int64_t>(aMarkerTableData.mSearchFilter));
     mWrite->bind(Parameters::Geohash, static_cast<int64_t>(aMarkerTableData.mGeohash));
 
@@ -353,4 +371,40 @@ bool MarkerQuery::Write(const ACDB_marker_idx_type aId, MarkerTableDataType&& aM
   return success;
 }  // end of Write
 
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Add the markers read by aStatement, a statement
+//!   starting with ReadAllSql, to the columns.  Names are copied
+//!   from the statement into the columns' name buffer, without a
+//!   string per marker.
+//!
+//----------------------------------------------------------------
+static void ReadColumns(SQLite::Statement& aStatement, MapMarkerColumns& aResultOut) {
+  enum Columns {
+    ColId = 0,
+    PoiType,
+    LastUpdate,
+    Name,
+    SearchFilter,
+    Geohash,
+    Lon,
+    Lat,
+    ProgramTier
+  };
+
+  while (aStatement.executeStep()) {
+    const SqliteCppUtil::ColumnText name = SqliteCppUtil::GetColumnText(aStatement, Columns::Name);
+
+    scposn_type posn;
+    posn.lat = aStatement.getColumn(Columns::Lat).getUInt();
+    posn.lon = aStatement.getColumn(Columns::Lon).getUInt();
+
+    aResultOut.Add(aStatement.getColumn(Columns::ColId).getInt64(),
+                   aStatement.getColumn(Columns::PoiType).getInt(),
+                   aStatement.getColumn(Columns::LastUpdate).getInt64(), name.mData, name.mSize,
+                   posn, aStatement.getColumn(Columns::ProgramTier).getInt());
+  }
+}  // End of ReadColumns
+
 }  // end of namespace Acdb
@@ -165,7 +165,7 @@ bool MooringsQuery::Get(const ACDB_marker_idx_type aId, MooringsTableDataType& a
 //!
 //----------------------------------------------------------------
 bool MooringsQuery::Write(const ACDB_marker_idx_type aId,
-                          MooringsTableDataType&& aMooringsTableData) {
+                          const MooringsTableDataType& aMooringsTableData) {
   enum Parameters { Id = 1, SectionTitle, Price, Labeled, SectionNote, YesNo };
 
   if (!mWrite) {
@@ -177,10 +177,10 @@ bool MooringsQuery::Write(const ACDB_marker_idx_type aId,
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aMooringsTableData.mSectionTitle);
-    mWrite->bind(Parameters::Price, aMooringsTableData.mYesNoPriceJson);
-    mWrite->bind(Parameters::Labeled, aMooringsTableData.mAttributeFieldsJson);
-    mWrite->bind(Parameters::SectionNote, aMooringsTableData.mSectionNoteJson);
-    mWrite->bind(Parameters::YesNo, aMooringsTableData.mYesNoJson);
+    mWrite->bindNoCopy(Parameters::Price, aMooringsTableData.mYesNoPriceJson);
+    mWrite->bindNoCopy(Parameters::Labeled, aMooringsTableData.mAttributeFieldsJson);
+    mWrite->bindNoCopy(Parameters::SectionNote, aMooringsTableData.mSectionNoteJson);
+    mWrite->bindNoCopy(Parameters::YesNo, aMooringsTableData.mYesNoJson);
 
     success = mWrite->exec();
 
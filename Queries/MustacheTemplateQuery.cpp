@@ -129,7 +129,7 @@ bool MustacheTemplateQuery::GetAll(std::vector<MustacheTemplateTableDataType>& a
 //!   @brief Write Mustache template to database
 //!
 //----------------------------------------------------------------
-bool MustacheTemplateQuery::Write(MustacheTemplateTableDataType&& aMustacheTemplateTableData) {
+bool MustacheTemplateQuery::Write(const MustacheTemplateTableDataType& aMustacheTemplateTableData) {
   enum Parameters { Name = 1, Template };
 
   if (!mWrite) {
@@ -139,8 +139,8 @@ bool MustacheTemplateQuery::Write(MustacheTemplateTableDataType&& aMustacheTempl
   bool success = false;
 
   try {
-    mWrite->bind(Parameters::Name, aMustacheTemplateTableData.mName);
-    mWrite->bind(Parameters::Template, aMustacheTemplateTableData.mTemplate);
+    mWrite->bindNoCopy(Parameters::Name, aMustacheTemplateTableData.mName);
+    mWrite->bindNoCopy(Parameters::Template, aMustacheTemplateTableData.mTemplate);
 
     success = mWrite->exec();
 
@@ -0,0 +1,388 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Maintains the normalized marker names and their trigram index
+    used by fuzzy name search.
+
+    The markers table comes from the server, so the search data
+    lives in tables created and maintained on the client:
+    markerNameSearch holds the normalized name of every marker, and
+    markerNameTrigram maps each trigram to the markers containing
+    it.  Trigrams of a marker are deleted by recomputing them from
+    its stored normalized name, which avoids a second index on
+    markerNameTrigram.
+
+    The tables are created and filled in one transaction by
+    Rebuild, and every marker write after that keeps them current,
+    so their presence is the record that the search data is
+    complete.  Opening a database never issues DDL, which keeps
+    read-only and shared databases untouched.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "NameSearchQuery"
+
+#include <vector>
+
+#include "ACDB_pub_types.h"
+#include "Acdb/NameSearch.hpp"
+#include "Acdb/Queries/NameSearchQuery.hpp"
+#include "DBG_pub.h"
+#include "SQLiteCpp/Column.h"
+#include "SQLiteCpp/Database.h"
+
+namespace Acdb {
+
+static const std::string NameTable{"markerNameSearch"};
+static const std::string TrigramTable{"markerNameTrigram"};
+static const std::string CreateNameTableSql{
+    "CREATE TABLE IF NOT EXISTS markerNameSearch( id INTEGER PRIMARY KEY NOT NULL, "
+    "normalizedName TEXT NOT NULL );"};
+static const std::string CreateTrigramTableSql{
+    "CREATE TABLE IF NOT EXISTS markerNameTrigram( trigram INTEGER NOT NULL, id INTEGER NOT NULL, "
+    "PRIMARY KEY (trigram, id) ) WITHOUT ROWID;"};
+static const std::string ClearSql{"DELETE FROM markerNameTrigram; DELETE FROM markerNameSearch;"};
+static const std::string DeleteSql{"DELETE FROM markerNameSearch WHERE id = ?;"};
+static const std::string DeleteTrigramSql{
+    "DELETE FROM markerNameTrigram WHERE trigram = ? AND id = ?;"};
+static const std::string ReadSql{"SELECT normalizedName FROM markerNameSearch WHERE id = ?;"};
+static const std::string ReadGeohashSql{
+    "SELECT n.id, n.normalizedName FROM markerNameSearch n "
+    "    INNER JOIN markers m ON n.id = m.id "
+    "WHERE m.geohash BETWEEN ? AND ?;"};
+static const std::string ReadMarkerNamesSql{"SELECT id, name FROM markers;"};
+static const std::string WriteSql{
+    "INSERT OR REPLACE INTO markerNameSearch (id, normalizedName) VALUES (?, ?);"};
+static const std::string WriteTrigramSql{
+    "INSERT OR IGNORE INTO markerNameTrigram (trigram, id) VALUES (?, ?);"};
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create NameSearch query object.  Statements are only
+//!   prepared if the database already has the search tables;
+//!   otherwise they are prepared by Rebuild.
+//!
+//----------------------------------------------------------------
+NameSearchQuery::NameSearchQuery(SQLite::Database& aDatabase) : mDatabase{aDatabase} {
+  try {
+    if (aDatabase.tableExists(NameTable) && aDatabase.tableExists(TrigramTable)) {
+      PrepareStatements();
+    }
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+  }
+}  // End of NameSearchQuery
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Delete the search name of the specified marker.
+//!
+//----------------------------------------------------------------
+bool NameSearchQuery::Delete(const ACDB_marker_idx_type aId) {
+  if (!IsComplete()) {
+    // Nothing to maintain until Rebuild indexes every marker.
+    return true;
+  }
+
+  std::string normalizedName;
+  if (!Read(aId, normalizedName)) {
+    // Nothing indexed for this marker.
+    return true;
+  }
+
+  return DeleteName(aId, normalizedName);
+}  // End of Delete
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Delete search names from database by geohash.  Must be
+//!   called before the markers are deleted.
+//!
+//----------------------------------------------------------------
+bool NameSearchQuery::Delete(const uint64_t aGeohashStart, const uint64_t aGeohashEnd) {
+  enum Parameters { GeohashStart = 1, GeohashEnd };
+  enum Columns { Id = 0, NormalizedName };
+
+  if (!IsComplete()) {
+    // Nothing to maintain until Rebuild indexes every marker.
+    return true;
+  }
+
+  bool success = false;
+  std::vector<std::pair<ACDB_marker_idx_type, std::string>> names;
+
+  try {
+    mReadGeohash->bind(Parameters::GeohashStart, static_cast<int64_t>(aGeohashStart));
+    mReadGeohash->bind(Parameters::GeohashEnd, static_cast<int64_t>(aGeohashEnd));
+
+    while (mReadGeohash->executeStep()) {
+      names.emplace_back(mReadGeohash->getColumn(Columns::Id).getInt64(),
+                         mReadGeohash->getColumn(Columns::NormalizedName).getText());
+    }
+
+    success = mReadGeohash->isDone();
+
+    mReadGeohash->reset();
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  for (const auto& name : names) {
+    success = success && DeleteName(name.first, name.second);
+  }
+
+  return success;
+}  // End of Delete
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Check whether the search tables have been built.
+//!   This does not read the database.
+//!
+//!   @return false if the search tables need to be rebuilt
+//!
+//----------------------------------------------------------------
+bool NameSearchQuery::IsComplete() const {
+  return mWrite != nullptr;
+}  // End of IsComplete
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create the search tables if needed and recreate the
+//!   search names of all markers.  Callers should wrap this in a
+//!   transaction, so that the tables only exist once filled.
+//!
+//----------------------------------------------------------------
+bool NameSearchQuery::Rebuild() {
+  enum Columns { Id = 0, Name };
+
+  bool success = false;
+
+  try {
+    mDatabase.exec(CreateNameTableSql);
+    mDatabase.exec(CreateTrigramTableSql);
+
+    if (!IsComplete()) {
+      PrepareStatements();
+    }
+
+    mDatabase.exec(ClearSql);
+
+    SQLite::Statement readMarkerNames{mDatabase, ReadMarkerNamesSql};
+
+    success = true;
+    while (success && readMarkerNames.executeStep()) {
+      success = Write(readMarkerNames.getColumn(Columns::Id).getInt64(),
+                      readMarkerNames.getColumn(Columns::Name).getText());
+    }
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  if (!success) {
+    // The caller rolls back, possibly dropping the new tables.
+    ResetStatements();
+  }
+
+  return success;
+}  // End of Rebuild
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Insert the search name of the specified marker.  If
+//!   the marker already has one, it will be updated.
+//!
+//----------------------------------------------------------------
+bool NameSearchQuery::Write(const ACDB_marker_idx_type aId, const std::string& aName) {
+  enum Parameters { Id = 1, NormalizedName };
+  enum TrigramParameters { Trigram = 1, TrigramId };
+
+  if (!IsComplete()) {
+    // Nothing to maintain until Rebuild indexes every marker.
+    return true;
+  }
+
+  const std::string normalizedName = NameSearch::Normalize(aName);
+
+  std::string oldNormalizedName;
+  if (Read(aId, oldNormalizedName)) {
+    if (oldNormalizedName == normalizedName) {
+      return true;
+    }
+
+    if (!DeleteName(aId, oldNormalizedName)) {
+      return false;
+    }
+  }
+
+  bool success = false;
+
+  try {
+    mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
+    mWrite->bind(Parameters::NormalizedName, normalizedName);
+
+    success = mWrite->exec();
+
+    mWrite->reset();
+
+    for (const int64_t trigram : NameSearch::GetTrigrams(normalizedName)) {
+      if (!success) {
+        break;
+      }
+
+      mWriteTrigram->bind(TrigramParameters::Trigram, trigram);
+      mWriteTrigram->bind(TrigramParameters::TrigramId, static_cast<int64_t>(aId));
+
+      mWriteTrigram->exec();
+      success = mWriteTrigram->isDone();
+
+      mWriteTrigram->reset();
+    }
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  return success;
+}  // End of Write
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Delete a search name and the trigrams of its
+//!   normalized name.
+//!
+//----------------------------------------------------------------
+bool NameSearchQuery::DeleteName(const ACDB_marker_idx_type aId,
+                                 const std::string& aNormalizedName) {
+  enum Parameters { Id = 1 };
+  enum TrigramParameters { Trigram = 1, TrigramId };
+
+  if (!mDelete || !mDeleteTrigram) {
+    return false;
+  }
+
+  bool success = false;
+
+  try {
+    for (const int64_t trigram : NameSearch::GetTrigrams(aNormalizedName)) {
+      mDeleteTrigram->bind(TrigramParameters::Trigram, trigram);
+      mDeleteTrigram->bind(TrigramParameters::TrigramId, static_cast<int64_t>(aId));
+
+      mDeleteTrigram->exec();
+
+      mDeleteTrigram->reset();
+    }
+
+    mDelete->bind(Parameters::Id, static_cast<int64_t>(aId));
+
+    mDelete->exec();
+    success = mDelete->isDone();
+
+    mDelete->reset();
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  return success;
+}  // End of DeleteName
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Prepare the statements on the search tables, which
+//!   must exist.  On failure no statement is kept.
+//!
+//----------------------------------------------------------------
+void NameSearchQuery::PrepareStatements() {
+  try {
+    mDelete.reset(new SQLite::Statement{mDatabase, DeleteSql});
+    mDeleteTrigram.reset(new SQLite::Statement{mDatabase, DeleteTrigramSql});
+    mRead.reset(new SQLite::Statement{mDatabase, ReadSql});
+    mReadGeohash.reset(new SQLite::Statement{mDatabase, ReadGeohashSql});
+    mWriteTrigram.reset(new SQLite::Statement{mDatabase, WriteTrigramSql});
+    mWrite.reset(new SQLite::Statement{mDatabase, WriteSql});
+  } catch (const SQLite::Exception&) {
+    ResetStatements();
+    throw;
+  }
+}  // End of PrepareStatements
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Drop the prepared statements, e.g. when a failed
+//!   rebuild is about to be rolled back with its tables.
+//!
+//----------------------------------------------------------------
+void NameSearchQuery::ResetStatements() {
+  mDelete.reset();
+  mDeleteTrigram.reset();
+  mRead.reset();
+  mReadGeohash.reset();
+  mWriteTrigram.reset();
+  mWrite.reset();
+}  // End of ResetStatements
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Read the normalized name of the specified marker.
+//!
+//!   @return true if the marker has a search name
+//!
+//----------------------------------------------------------------
+bool NameSearchQuery::Read(const ACDB_marker_idx_type aId, std::string& aNormalizedNameOut) {
+  enum Parameters { Id = 1 };
+  enum Columns { NormalizedName = 0 };
+
+  if (!mRead) {
+    return false;
+  }
+
+  bool success = false;
+
+  try {
+    mRead->bind(Parameters::Id, static_cast<int64_t>(aId));
+
+    success = mRead->executeStep();
+    if (success) {
+      aNormalizedNameOut = mRead->getColumn(Columns::NormalizedName).getText();
+    }
+
+    mRead->reset();
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  return success;
+}  // End of Read
+
+}  // end of namespace Acdb
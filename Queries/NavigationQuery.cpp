@@ -164,7 +164,7 @@ bool NavigationQuery::Get(const ACDB_marker_idx_type aId, NavigationTableDataTyp
 //!
 //----------------------------------------------------------------
 bool NavigationQuery::Write(const ACDB_marker_idx_type aId,
-                            NavigationTableDataType&& aNavigationTableData) {
+                            const NavigationTableDataType& aNavigationTableData) {
   enum Parameters { Id = 1, SectionTitle, Labeled, SectionNote, DistanceUnit };
 
   if (!mWrite) {
@@ -176,8 +176,8 @@ bool NavigationQuery::Write(const ACDB_marker_idx_type aId,
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aNavigationTableData.mSectionTitle);
-    mWrite->bind(Parameters::Labeled, aNavigationTableData.mAttributeFieldsJson);
-    mWrite->bind(Parameters::SectionNote, aNavigationTableData.mSectionNoteJson);
+    mWrite->bindNoCopy(Parameters::Labeled, aNavigationTableData.mAttributeFieldsJson);
+    mWrite->bindNoCopy(Parameters::SectionNote, aNavigationTableData.mSectionNoteJson);
     mWrite->bind(Parameters::DistanceUnit, aNavigationTableData.mDistanceUnit);
 
     success = mWrite->exec();
@@ -162,7 +162,8 @@ bool RetailQuery::Get(const ACDB_marker_idx_type aId, RetailTableDataType& aResu
 //!   @brief Write retail to database
 //!
 //----------------------------------------------------------------
-bool RetailQuery::Write(const ACDB_marker_idx_type aId, RetailTableDataType&& aRetailTableData) {
+bool RetailQuery::Write(const ACDB_marker_idx_type aId,
+                        const RetailTableDataType& aRetailTableData) {
   enum Parameters { Id = 1, SectionTitle, SectionNote, YesNo };
 
   if (!mWrite) {
@@ -174,8 +175,8 @@ bool RetailQuery::Write(const ACDB_marker_idx_type aId, RetailTableDataType&& aR
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aRetailTableData.mSectionTitle);
-    mWrite->bind(Parameters::SectionNote, aRetailTableData.mSectionNoteJson);
-    mWrite->bind(Parameters::YesNo, aRetailTableData.mYesNoJson);
+    mWrite->bindNoCopy(Parameters::SectionNote, aRetailTableData.mSectionNoteJson);
+    mWrite->bindNoCopy(Parameters::YesNo, aRetailTableData.mYesNoJson);
 
     success = mWrite->exec();
 
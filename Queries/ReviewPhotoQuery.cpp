@@ -258,7 +258,7 @@ bool ReviewPhotoQuery::GetListByMarkerId(
 //!
 //----------------------------------------------------------------
 bool ReviewPhotoQuery::Write(const ACDB_review_idx_type aId,
-                             ReviewPhotoTableDataType&& aReviewPhotoTableData) {
+                             const ReviewPhotoTableDataType& aReviewPhotoTableData) {
   enum Parameters { Id = 1, Ordinal, DownloadUrl };
   if (!mWrite) {
     return false;
@@ -269,7 +269,7 @@ bool ReviewPhotoQuery::Write(const ACDB_review_idx_type aId,
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::Ordinal, aReviewPhotoTableData.mOrdinal);
-    mWrite->bind(Parameters::DownloadUrl, aReviewPhotoTableData.mDownloadUrl);
+    mWrite->bindNoCopy(Parameters::DownloadUrl, aReviewPhotoTableData.mDownloadUrl);
 
     success = mWrite->exec();
 
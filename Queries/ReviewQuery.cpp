@@ -319,7 +319,8 @@ bool ReviewQuery::GetList(const ACDB_marker_idx_type aMarkerId, const std::strin
 //!   @brief Write review to database
 //!
 //----------------------------------------------------------------
-bool ReviewQuery::Write(const ACDB_review_idx_type aId, ReviewTableDataType&& aReviewTableData) {
+bool ReviewQuery::Write(const ACDB_review_idx_type aId,
+                        const ReviewTableDataType& aReviewTableData) {
   enum Parameters {
     ReviewId = 1,
     MarkerId,
@@ -343,13 +344,13 @@ bool ReviewQuery::Write(const ACDB_review_idx_type aId, ReviewTableDataType&& aR
     mWrite->bind(Parameters::ReviewId, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::MarkerId, static_cast<int64_t>(aReviewTableData.mMarkerId));
     mWrite->bind(Parameters::Rating, aReviewTableData.mRating);
-    mWrite->bind(Parameters::Title, aReviewTableData.mTitle);
-    mWrite->bind(Parameters::Date, aReviewTableData.mDate);
-    mWrite->bind(Parameters::Captain, aReviewTableData.mCaptain);
-    mWrite->bind(Parameters::Review, aReviewTableData.mReview);
+    mWrite->bindNoCopy(Parameters::Title, aReviewTableData.mTitle);
+    mWrite->bindNoCopy(Parameters::Date, aReviewTableData.mDate);
+    mWrite->bindNoCopy(Parameters::Captain, aReviewTableData.mCaptain);
+    mWrite->bindNoCopy(Parameters::Review, aReviewTableData.mReview);
     mWrite->bind(Parameters::LastUpdate, static_cast<int64_t>(aReviewTableData.mLastUpdated));
     mWrite->bind(Parameters::Votes, aReviewTableData.mVotes);
-    mWrite->bind(Parameters::Response, aReviewTableData.mResponse);
+    mWrite->bindNoCopy(Parameters::Response, aReviewTableData.mResponse);
 
     success = mWrite->exec();
 
@@ -24,13 +24,28 @@ limitations under the License.
 #define DBG_MODULE "ACDB"
 #define DBG_TAG "SearchMarkerQuery"
 
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
 #include "ACDB_pub_types.h"
+#include "Acdb/GeoUtil.hpp"
+#include "Acdb/NameSearch.hpp"
+#include "Acdb/Queries/BboxClause.hpp"
+#include "Acdb/Queries/MarkerAttributeQuery.hpp"
 #include "Acdb/Queries/SearchMarkerQuery.hpp"
 #include "DBG_pub.h"
 #include "SQLiteCpp/Column.h"
+#include "SQLiteCpp/Database.h"
 
 namespace Acdb {
 
+static const std::string AttributesTable{"markerAttributes"};
+static const std::string NameSearchTable{"markerNameSearch"};
+static const std::string NameTrigramTable{"markerNameTrigram"};
 static const std::string ReadSql{
     "SELECT m.id, m.poi_type, m.lastUpdate, m.name, ri.minLon, ri.minLat, COALESCE(bp.programTier, -1) programTier, "
     "       AVG(rv.rating), COUNT(rv.markerId), "
@@ -44,34 +59,133 @@ static const std::string ReadSql{
     "    LEFT OUTER JOIN reviews rv ON m.id = rv.markerId "
     "WHERE m.id = ? "
     "GROUP BY m.id;"};
-static const std::string ReadBasicFilteredSql{
+// The bounding box clause of the filtered reads is filled in between their start and end.
+static const std::string ReadFilteredSqlStart{
     "SELECT m.id, m.poi_type, m.lastUpdate, m.name, m.searchFilter, ri.minLon, ri.minLat, COALESCE(bp.programTier, -1) programTier "
     "FROM markers m "
     "    INNER JOIN rIndex ri ON m.Id = ri.Id LEFT JOIN businessProgram bp ON m.Id = bp.Id "
-    "WHERE minLon > ? AND maxLon < ? "
-    "    AND minLat > ? AND maxLat < ? "
+    "WHERE "};
+static const std::string ReadBasicFilteredSqlEnd{
     "    AND m.poi_type & ? "
     "    AND m.searchFilter & ? "
     "    AND m.name LIKE ? "
     "LIMIT ?;"};
-static const std::string ReadExtendedFilteredSql{
-    "SELECT m.id, m.poi_type, m.lastUpdate, m.name, ri.minLon, ri.minLat, COALESCE(bp.programTier, -1) programTier, "
+// Phase one of the extended search: find the markers, in id order like before.
+static const std::string ReadExtendedFilteredSqlEnd{
+    "    AND m.poi_type & ? "
+    "    AND m.searchFilter & ? "
+    "    AND m.name LIKE ? "
+    "ORDER BY m.id "
+    "LIMIT ?;"};
+// Phase two: read contact, fuel and review stats of the markers found.  The id list is
+// filled in per batch.
+static const std::string ReadExtendedDataSqlStart{
+    "SELECT m.id, "
     "       AVG(rv.rating), COUNT(rv.markerId), "
     "       c.phone, c.vhfChannel, "
     "       f.gasPrice, f.dieselPrice, f.currency, f.volumeUnit "
     "FROM markers m "
-    "    INNER JOIN rIndex ri ON m.Id = ri.Id "
-    "    LEFT OUTER JOIN businessProgram bp ON m.id = bp.id "
     "    LEFT OUTER JOIN contact c ON m.id = c.id "
     "    LEFT OUTER JOIN fuel f ON m.id = f.id "
     "    LEFT OUTER JOIN reviews rv ON m.id = rv.markerId "
-    "WHERE minLon > ? AND maxLon < ? "
-    "    AND minLat > ? AND maxLat < ? "
+    "WHERE m.id IN ("};
+static const std::string ReadExtendedDataSqlEnd{
+    ") "
+    "GROUP BY m.id;"};
+// Ordered searches read every match; the sort order and max results are applied while reading.
+static const std::string ReadOrderedFilteredSqlStart{
+    "SELECT m.id, m.poi_type, m.lastUpdate, m.name, m.searchFilter, ri.minLon, ri.minLat, COALESCE(bp.programTier, -1) programTier, "
+    "       NULL "
+    "FROM markers m "
+    "    INNER JOIN rIndex ri ON m.Id = ri.Id LEFT JOIN businessProgram bp ON m.Id = bp.Id "
+    "WHERE "};
+// Averages the reviews of the matching markers only, not every review in the database.
+static const std::string ReadRatingOrderedFilteredSqlStart{
+    "SELECT m.id, m.poi_type, m.lastUpdate, m.name, m.searchFilter, ri.minLon, ri.minLat, COALESCE(bp.programTier, -1) programTier, "
+    "       (SELECT AVG(rating) FROM reviews WHERE markerId = m.id) "
+    "FROM markers m "
+    "    INNER JOIN rIndex ri ON m.Id = ri.Id LEFT JOIN businessProgram bp ON m.Id = bp.Id "
+    "WHERE "};
+static const std::string ReadOrderedFilteredSqlEnd{
     "    AND m.poi_type & ? "
     "    AND m.searchFilter & ? "
-    "    AND m.name LIKE ? "
-    "GROUP BY m.id "
+    "    AND m.name LIKE ?;"};
+static const std::string ReadSortKeySql{
+    "SELECT m.name, m.lastUpdate, ri.minLon, ri.minLat, COALESCE(bp.programTier, -1) programTier, "
+    "       (SELECT AVG(rating) FROM reviews WHERE markerId = m.id) "
+    "FROM markers m "
+    "    INNER JOIN rIndex ri ON m.Id = ri.Id LEFT JOIN businessProgram bp ON m.Id = bp.Id "
+    "WHERE m.id = ?;"};
+// The trigram list and the bounding box clause are filled in per query.
+static const std::string ReadFuzzyFilteredSqlStart{
+    "SELECT m.id, m.poi_type, m.lastUpdate, m.name, m.searchFilter, ri.minLon, ri.minLat, COALESCE(bp.programTier, -1) programTier, "
+    "       ns.normalizedName "
+    "FROM (SELECT id, COUNT(*) shared FROM markerNameTrigram "
+    "      WHERE trigram IN ("};
+static const std::string ReadFuzzyFilteredSqlMiddle{
+    ") "
+    "      GROUP BY id HAVING shared >= ?) t "
+    "    INNER JOIN markers m ON t.id = m.id "
+    "    INNER JOIN markerNameSearch ns ON t.id = ns.id "
+    "    INNER JOIN rIndex ri ON m.Id = ri.Id LEFT JOIN businessProgram bp ON m.Id = bp.Id "
+    "WHERE "};
+static const std::string ReadFuzzyFilteredSqlEnd{
+    "    AND m.poi_type & ? "
+    "    AND m.searchFilter & ? "
+    "ORDER BY t.shared DESC "
     "LIMIT ?;"};
+// Follows the bounding box clause when attributes are required.
+static const std::string AttributesFilterSql{
+    "    AND EXISTS (SELECT 1 FROM markerAttributes ma WHERE ma.id = m.id "
+    "                AND ma.attributes & ? = ?) "};
+// Used instead until the attribute index is built: computes the attributes from the same
+// sections as MarkerAttributeQuery.
+static const std::string AttributesFromSectionsFilterSql{
+    "    AND (SELECT acdbMarkerAttributes(a.yesNo, d.commaSeparatedList, d.yesNo, f.priceList, "
+    "                f.yesNo, mo.price, mo.yesNo, r.yesNo, s.yesNo) "
+    "         FROM markers ms "
+    "             LEFT JOIN amenities a ON ms.id = a.id "
+    "             LEFT JOIN dockage d ON ms.id = d.id "
+    "             LEFT JOIN fuel f ON ms.id = f.id "
+    "             LEFT JOIN mooring mo ON ms.id = mo.id "
+    "             LEFT JOIN retail r ON ms.id = r.id "
+    "             LEFT JOIN services s ON ms.id = s.id "
+    "         WHERE ms.id = m.id) & ? = ? "};
+
+//! Candidates read from the trigram index for each requested fuzzy search result.  Candidates
+//! are limited by shared trigram count before ranking by edit distance, see GetFuzzyFiltered.
+static const int32_t FuzzyCandidatesPerResult = 8;
+//! Fewest candidates read from the trigram index for a fuzzy search with max results
+static const int32_t MinFuzzyCandidates = 256;
+
+//! Most marker ids bound to one statement reading extended data
+static const size_t ExtendedDataBatchSize = 256;
+
+//! Average rating used to order markers without reviews after all others
+static const double NoAverageRating = -1.0;
+
+//! Position of a marker in an ordered search.  Descending orders negate mValue, and the
+//! name is only set when ordering by name, so that every order compares the same way.
+struct SortKey {
+  double mValue;
+  std::string mName;
+  ACDB_marker_idx_type mId;
+};
+
+static int BindAttributesFilter(SQLite::Statement& aStatement, const int aFirstParameter,
+                                const SearchMarkerFilter& aFilter);
+
+static std::string GetSearchExpression(const SearchMarkerFilter& aFilter);
+
+static bool IsBefore(const SortKey& aLhs, const SortKey& aRhs);
+
+static SortKey MakeSortKey(const SearchMarkerFilter& aFilter, const ACDB_marker_idx_type aId,
+                           const char* aName, const uint64_t aLastUpdated,
+                           const scposn_type& aPosn, const int aBusinessProgramTier,
+                           const double aAverageRating);
+
+static void ReadExtendedColumns(SQLite::Statement& aStatement, const int aFirstColumn,
+                                ExtendedMarkerDataType& aResultOut);
 
 //----------------------------------------------------------------
 //!
@@ -80,7 +194,9 @@ static const std::string ReadExtendedFilteredSql{
 //!
 //----------------------------------------------------------------
 SearchMarkerQuery::SearchMarkerQuery(SQLite::Database& aDatabase)
-    : mDatabase{aDatabase} {}  // End of SearchMarkerQuery
+    : mDatabase{aDatabase}, mHasAttributeIndex{false}, mHasNameIndex{false} {
+  MarkerAttributeQuery::CreateFunction(aDatabase);
+}  // End of SearchMarkerQuery
 
 //----------------------------------------------------------------
 //!
@@ -98,14 +214,7 @@ bool SearchMarkerQuery::Get(const ACDB_marker_idx_type aId, ExtendedMarkerDataTy
     MinLon,
     MinLat,
     ProgramTier,
-    AvgRating,
-    ReviewCount,
-    Phone,
-    VhfChannel,
-    GasPrice,
-    DieselPrice,
-    Currency,
-    VolumeUnit
+    AvgRating  // followed by the other columns read by ReadExtendedColumns
   };
 
   bool success = false;
@@ -124,37 +233,119 @@ bool SearchMarkerQuery::Get(const ACDB_marker_idx_type aId, ExtendedMarkerDataTy
       aResultOut.mPosn.lat = read.getColumn(Columns::MinLat).getUInt();
       aResultOut.mBusinessProgramTier = read.getColumn(Columns::ProgramTier).getInt();
 
-      if (!read.isColumnNull(Columns::AvgRating)) {
-        aResultOut.mReviewStatsData.mAverageRating =
-            static_cast<float>(read.getColumn(Columns::AvgRating).getDouble());
-      }
+      ReadExtendedColumns(read, Columns::AvgRating, aResultOut);
+    }
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
 
-      if (!read.isColumnNull(Columns::ReviewCount)) {
-        aResultOut.mReviewStatsData.mNumberOfReviews =
-            read.getColumn(Columns::ReviewCount).getInt();
-      }
+  return success;
+}  // End of Get
 
-      if (!read.isColumnNull(Columns::Phone)) {
-        aResultOut.mContactData.mPhoneNumber = read.getColumn(Columns::Phone).getText();
-      }
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get a list of item records based on the specified
+//!   filter.
+//!
+//----------------------------------------------------------------
+bool SearchMarkerQuery::GetBasicFiltered(const SearchMarkerFilter& aFilter,
+                                         std::vector<MarkerTableDataType>& aResultOut) {
+  if (aFilter.GetStringMatchMode() == SearchMarkerFilter::MatchFuzzy &&
+      !aFilter.GetSearchString().empty() && HasNameIndex()) {
+    return GetFuzzyFiltered(aFilter, aResultOut);
+  }
+
+  if (aFilter.GetSortOrder() != SearchMarkerFilter::SortNone) {
+    return ReadOrdered(aFilter, aResultOut);
+  }
+
+  return ReadFiltered(ReadBasicFilteredSqlEnd, aFilter, aResultOut);
+}  // End of GetBasicFiltered
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get a list of item records based on the specified
+//!   filter, with their contact, fuel and review stats.
+//!
+//!   The markers are found first, so that the reviews of markers
+//!   beyond the filter's max results are never aggregated.
+//!
+//----------------------------------------------------------------
+bool SearchMarkerQuery::GetExtendedFiltered(const SearchMarkerFilter& aFilter,
+                                            std::vector<ExtendedMarkerDataType>& aResultOut) {
+  std::vector<MarkerTableDataType> markerList;
+
+  if (aFilter.GetStringMatchMode() == SearchMarkerFilter::MatchFuzzy &&
+      !aFilter.GetSearchString().empty() && HasNameIndex()) {
+    GetFuzzyFiltered(aFilter, markerList);
+  } else if (aFilter.GetSortOrder() != SearchMarkerFilter::SortNone) {
+    ReadOrdered(aFilter, markerList);
+  } else {
+    ReadFiltered(ReadExtendedFilteredSqlEnd, aFilter, markerList);
+  }
 
-      if (!read.isColumnNull(Columns::VhfChannel)) {
-        aResultOut.mContactData.mVhfChannel = read.getColumn(Columns::VhfChannel).getText();
+  return GetExtendedData(markerList, aResultOut);
+}  // End of GetExtendedFiltered
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Add the markers of aMarkerList to aResultOut, in the
+//!   same order, with their contact, fuel and review stats read
+//!   in batches.
+//!
+//----------------------------------------------------------------
+bool SearchMarkerQuery::GetExtendedData(std::vector<MarkerTableDataType>& aMarkerList,
+                                        std::vector<ExtendedMarkerDataType>& aResultOut) {
+  enum Columns { ColId = 0, FirstExtended };
+
+  const size_t resultStart = aResultOut.size();
+  std::unordered_map<ACDB_marker_idx_type, size_t> resultIndexById;
+
+  aResultOut.reserve(resultStart + aMarkerList.size());
+  resultIndexById.reserve(aMarkerList.size());
+
+  for (auto& marker : aMarkerList) {
+    resultIndexById.emplace(marker.mId, aResultOut.size());
+
+    ExtendedMarkerDataType result;
+    result.mId = marker.mId;
+    result.mType = marker.mType;
+    result.mLastUpdated = marker.mLastUpdated;
+    result.mName = std::move(marker.mName);
+    result.mPosn = marker.mPosn;
+    result.mBusinessProgramTier = marker.mBusinessProgramTier;
+
+    aResultOut.push_back(std::move(result));
+  }
+
+  bool success = true;
+
+  try {
+    for (size_t batchStart = resultStart; batchStart < aResultOut.size();
+         batchStart += ExtendedDataBatchSize) {
+      const size_t batchEnd = std::min(batchStart + ExtendedDataBatchSize, aResultOut.size());
+
+      std::string sql = ReadExtendedDataSqlStart;
+      for (size_t i = batchStart; i < batchEnd; i++) {
+        sql += (i == batchStart) ? "?" : ", ?";
       }
+      sql += ReadExtendedDataSqlEnd;
 
-      if (!read.isColumnNull(Columns::Currency) && !read.isColumnNull(Columns::VolumeUnit)) {
-        if (!read.isColumnNull(Columns::GasPrice)) {
-          aResultOut.mFuelData.mGasPrice =
-              static_cast<float>(read.getColumn(Columns::GasPrice).getDouble());
-        }
+      SQLite::Statement readExtendedData{mDatabase, sql};
+      for (size_t i = batchStart; i < batchEnd; i++) {
+        readExtendedData.bind(static_cast<int>(i - batchStart) + 1,
+                              static_cast<int64_t>(aResultOut[i].mId));
+      }
 
-        if (!read.isColumnNull(Columns::DieselPrice)) {
-          aResultOut.mFuelData.mDieselPrice =
-              static_cast<float>(read.getColumn(Columns::DieselPrice).getDouble());
+      while (readExtendedData.executeStep()) {
+        auto it = resultIndexById.find(readExtendedData.getColumn(Columns::ColId).getInt64());
+        if (it != resultIndexById.end()) {
+          ReadExtendedColumns(readExtendedData, Columns::FirstExtended, aResultOut[it->second]);
         }
-
-        aResultOut.mFuelData.mFuelPriceCurrency = read.getColumn(Columns::Currency).getText();
-        aResultOut.mFuelData.mFuelPriceUnit = read.getColumn(Columns::VolumeUnit).getUInt();
       }
     }
   } catch (const SQLite::Exception& e) {
@@ -162,19 +353,32 @@ bool SearchMarkerQuery::Get(const ACDB_marker_idx_type aId, ExtendedMarkerDataTy
     success = false;
   }
 
-  return success;
-}  // End of Get
+  return success && aResultOut.size() > resultStart;
+}  // End of GetExtendedData
 
 //----------------------------------------------------------------
 //!
-//!   @public
-//!   @detail Get a list of item records based on the specified
-//!   filter.
+//!   @private
+//!   @detail Get a list of item records whose names fuzzy match the
+//!   filter's search string, best match first.
+//!
+//!   Candidates sharing enough trigrams with the search string are
+//!   read from the trigram index, then ranked by edit distance.
+//!   Ties are broken by the shorter name, then by id.
+//!
+//!   With max results set, only the candidates sharing the most
+//!   trigrams are read, max(maxResults * FuzzyCandidatesPerResult,
+//!   MinFuzzyCandidates) of them, and the rest are dropped before
+//!   ranking.  A name closer in edit distance but sharing fewer
+//!   trigrams than all the candidates read can thus be missed,
+//!   e.g. in a dense area where many names share common trigrams.
+//!   Without max results every candidate is ranked.
 //!
 //----------------------------------------------------------------
-bool SearchMarkerQuery::GetBasicFiltered(const SearchMarkerFilter& aFilter,
+bool SearchMarkerQuery::GetFuzzyFiltered(const SearchMarkerFilter& aFilter,
                                          std::vector<MarkerTableDataType>& aResultOut) {
-  enum Parameters { MinLon = 1, MaxLon, MinLat, MaxLat, PoiType, SearchFilter, Name, Limit };
+  enum Parameters { MinShared = 1, FirstBbox };
+  enum FilterParameters { PoiType = 0, SearchFilter, Limit };
   enum Columns {
     ColId = 0,
     ColPoiType,
@@ -183,169 +387,534 @@ bool SearchMarkerQuery::GetBasicFiltered(const SearchMarkerFilter& aFilter,
     ColSearchFilter,
     ColMinLon,
     ColMinLat,
-    ProgramTier
+    ProgramTier,
+    NormalizedName
   };
 
+  const std::string normalizedQuery = NameSearch::Normalize(aFilter.GetSearchString());
+  std::vector<int64_t> trigrams = NameSearch::GetTrigrams(normalizedQuery);
+  if (trigrams.empty()) {
+    return false;
+  }
+
+  if (trigrams.size() > NameSearch::MaxQueryTrigrams) {
+    trigrams.resize(NameSearch::MaxQueryTrigrams);
+  }
+
+  const int32_t maxResults = aFilter.GetMaxResults();
+  const int32_t candidateLimit =
+      maxResults < 0 ? -1 : std::max(maxResults * FuzzyCandidatesPerResult, MinFuzzyCandidates);
+  const uint32_t minShared = std::min(NameSearch::GetMinSharedTrigrams(normalizedQuery),
+                                      static_cast<uint32_t>(trigrams.size()));
+
+  const std::vector<bbox_type> bboxes = BboxClause::GetParts(aFilter.GetBbox());
+
+  std::string sql = ReadFuzzyFilteredSqlStart;
+  for (size_t i = 0; i < trigrams.size(); i++) {
+    sql += (i == 0) ? "?" : ", ?";
+  }
+  sql += ReadFuzzyFilteredSqlMiddle + BboxClause::GetSql(bboxes.size()) +
+         GetAttributesFilterSql(aFilter) + ReadFuzzyFilteredSqlEnd;
+
+  // (distance, normalized name length, result)
+  std::vector<std::tuple<uint32_t, size_t, MarkerTableDataType>> matches;
   bool success = false;
 
   try {
-    SQLite::Statement readBasicFiltered{mDatabase, ReadBasicFilteredSql};
-    readBasicFiltered.bind(Parameters::MinLon, aFilter.GetBbox().swc.lon);
-    readBasicFiltered.bind(Parameters::MaxLon, aFilter.GetBbox().nec.lon);
-    readBasicFiltered.bind(Parameters::MinLat, aFilter.GetBbox().swc.lat);
-    readBasicFiltered.bind(Parameters::MaxLat, aFilter.GetBbox().nec.lat);
-    readBasicFiltered.bind(Parameters::PoiType, aFilter.GetAllowedTypes());
-    readBasicFiltered.bind(Parameters::SearchFilter,
+    SQLite::Statement readFuzzyFiltered{mDatabase, sql};
+
+    // The trigram parameters come first, so offset the others by their count.
+    const int offset = static_cast<int>(trigrams.size());
+    for (size_t i = 0; i < trigrams.size(); i++) {
+      readFuzzyFiltered.bind(static_cast<int>(i) + 1, trigrams[i]);
+    }
+
+    readFuzzyFiltered.bind(offset + Parameters::MinShared, minShared);
+
+    const int filterOffset = BindAttributesFilter(
+        readFuzzyFiltered,
+        BboxClause::Bind(readFuzzyFiltered, offset + Parameters::FirstBbox, bboxes), aFilter);
+    readFuzzyFiltered.bind(filterOffset + FilterParameters::PoiType, aFilter.GetAllowedTypes());
+    readFuzzyFiltered.bind(filterOffset + FilterParameters::SearchFilter,
                            static_cast<int64_t>(aFilter.GetAllowedCategories()));
+    readFuzzyFiltered.bind(filterOffset + FilterParameters::Limit, candidateLimit);
+
+    while (readFuzzyFiltered.executeStep()) {
+      const std::string normalizedName =
+          readFuzzyFiltered.getColumn(Columns::NormalizedName).getText();
+      const uint32_t distance = NameSearch::GetMatchDistance(normalizedQuery, normalizedName);
+      if (distance == NameSearch::NoMatch) {
+        continue;
+      }
+
+      MarkerTableDataType result;
+      result.mId = readFuzzyFiltered.getColumn(Columns::ColId).getInt64();
+      result.mType = readFuzzyFiltered.getColumn(Columns::ColPoiType).getInt();
+      result.mLastUpdated = readFuzzyFiltered.getColumn(Columns::LastUpdate).getInt64();
+      result.mName = readFuzzyFiltered.getColumn(Columns::ColName).getText();
+      result.mSearchFilter = readFuzzyFiltered.getColumn(Columns::ColSearchFilter).getInt64();
+      result.mPosn.lon = readFuzzyFiltered.getColumn(Columns::ColMinLon).getUInt();
+      result.mPosn.lat = readFuzzyFiltered.getColumn(Columns::ColMinLat).getUInt();
+      result.mBusinessProgramTier = readFuzzyFiltered.getColumn(Columns::ProgramTier).getInt();
+
+      matches.emplace_back(distance, normalizedName.size(), std::move(result));
+    }
+
+    success = true;
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    success = false;
+  }
+
+  std::sort(matches.begin(), matches.end(),
+            [](const std::tuple<uint32_t, size_t, MarkerTableDataType>& aLhs,
+               const std::tuple<uint32_t, size_t, MarkerTableDataType>& aRhs) {
+              return std::make_tuple(std::get<0>(aLhs), std::get<1>(aLhs), std::get<2>(aLhs).mId) <
+                     std::make_tuple(std::get<0>(aRhs), std::get<1>(aRhs), std::get<2>(aRhs).mId);
+            });
+
+  if (maxResults >= 0 && matches.size() > static_cast<size_t>(maxResults)) {
+    matches.resize(maxResults);
+  }
+
+  for (auto& match : matches) {
+    aResultOut.push_back(std::move(std::get<2>(match)));
+  }
+
+  return success && !matches.empty();
+}  // End of GetFuzzyFiltered
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get the WHERE clause condition matching the filter's
+//!   required attributes, for a query of the markers table m, to
+//!   follow another condition.  Markers are looked up in the
+//!   attribute index only when attributes are required.  Until a
+//!   sync builds the index, see Repository::UpdateSearchData, the
+//!   attributes are computed from the sections of each marker.
+//!
+//----------------------------------------------------------------
+std::string SearchMarkerQuery::GetAttributesFilterSql(const SearchMarkerFilter& aFilter) {
+  if (aFilter.GetRequiredAttributes() == 0) {
+    return std::string{};
+  }
+
+  return HasAttributeIndex() ? AttributesFilterSql : AttributesFromSectionsFilterSql;
+}  // End of GetAttributesFilterSql
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Check whether the attribute index has been built.
+//!   Every marker write keeps it current once built, so only its
+//!   absence is re-checked.
+//!
+//----------------------------------------------------------------
+bool SearchMarkerQuery::HasAttributeIndex() {
+  if (!mHasAttributeIndex) {
+    try {
+      mHasAttributeIndex = mDatabase.tableExists(AttributesTable);
+    } catch (const SQLite::Exception& e) {
+      DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    }
+  }
 
-    const std::string WILDCARD{"%"};
-    std::string searchExpression;
+  return mHasAttributeIndex;
+}  // End of HasAttributeIndex
 
-    if (aFilter.GetSearchString().empty()) {
-      searchExpression = WILDCARD;
-    } else if (aFilter.GetStringMatchMode() == SearchMarkerFilter::MatchBeginningOfWord) {
-      searchExpression = aFilter.GetSearchString() + WILDCARD;
-    } else {
-      searchExpression = WILDCARD + aFilter.GetSearchString() + WILDCARD;
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Check whether the fuzzy name search data has been
+//!   built.  Until a sync builds it, fuzzy searches match names
+//!   with LIKE anywhere in the name, see
+//!   Repository::UpdateSearchData.  Every marker write keeps the
+//!   data current once built, so only its absence is re-checked.
+//!
+//----------------------------------------------------------------
+bool SearchMarkerQuery::HasNameIndex() {
+  if (!mHasNameIndex) {
+    try {
+      mHasNameIndex =
+          mDatabase.tableExists(NameSearchTable) && mDatabase.tableExists(NameTrigramTable);
+    } catch (const SQLite::Exception& e) {
+      DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
     }
+  }
 
-    readBasicFiltered.bind(Parameters::Name, searchExpression);
-    readBasicFiltered.bind(Parameters::Limit, aFilter.GetMaxResults());
+  return mHasNameIndex;
+}  // End of HasNameIndex
 
-    while (readBasicFiltered.executeStep()) {
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get a list of item records based on the specified
+//!   filter, using aSqlEnd to filter and limit them after the
+//!   bounding box clause.
+//!
+//----------------------------------------------------------------
+bool SearchMarkerQuery::ReadFiltered(const std::string& aSqlEnd, const SearchMarkerFilter& aFilter,
+                                     std::vector<MarkerTableDataType>& aResultOut) {
+  enum Parameters { FirstBbox = 1 };
+  enum FilterParameters { PoiType = 0, SearchFilter, Name, Limit };
+  enum Columns {
+    ColId = 0,
+    ColPoiType,
+    LastUpdate,
+    ColName,
+    ColSearchFilter,
+    ColMinLon,
+    ColMinLat,
+    ProgramTier
+  };
+
+  const std::vector<bbox_type> bboxes = BboxClause::GetParts(aFilter.GetBbox());
+  const std::string sql = ReadFilteredSqlStart + BboxClause::GetSql(bboxes.size()) +
+                          GetAttributesFilterSql(aFilter) + aSqlEnd;
+
+  bool success = false;
+
+  try {
+    SQLite::Statement readFiltered{mDatabase, sql};
+
+    const int offset = BindAttributesFilter(
+        readFiltered, BboxClause::Bind(readFiltered, Parameters::FirstBbox, bboxes), aFilter);
+    readFiltered.bind(offset + FilterParameters::PoiType, aFilter.GetAllowedTypes());
+    readFiltered.bind(offset + FilterParameters::SearchFilter,
+                      static_cast<int64_t>(aFilter.GetAllowedCategories()));
+
+    readFiltered.bind(offset + FilterParameters::Name, GetSearchExpression(aFilter));
+    readFiltered.bind(offset + FilterParameters::Limit, aFilter.GetMaxResults());
+
+    while (readFiltered.executeStep()) {
       MarkerTableDataType result;
-      result.mId = readBasicFiltered.getColumn(Columns::ColId).getInt64();
-      result.mType = readBasicFiltered.getColumn(Columns::ColPoiType).getInt();
-      result.mLastUpdated = readBasicFiltered.getColumn(Columns::LastUpdate).getInt64();
-      result.mName = readBasicFiltered.getColumn(Columns::ColName).getText();
-      result.mSearchFilter = readBasicFiltered.getColumn(Columns::ColSearchFilter).getInt64();
-      result.mPosn.lon = readBasicFiltered.getColumn(Columns::ColMinLon).getUInt();
-      result.mPosn.lat = readBasicFiltered.getColumn(Columns::ColMinLat).getUInt();
-      result.mBusinessProgramTier = readBasicFiltered.getColumn(Columns::ProgramTier).getInt();
+      result.mId = readFiltered.getColumn(Columns::ColId).getInt64();
+      result.mType = readFiltered.getColumn(Columns::ColPoiType).getInt();
+      result.mLastUpdated = readFiltered.getColumn(Columns::LastUpdate).getInt64();
+      result.mName = readFiltered.getColumn(Columns::ColName).getText();
+      result.mSearchFilter = readFiltered.getColumn(Columns::ColSearchFilter).getInt64();
+      result.mPosn.lon = readFiltered.getColumn(Columns::ColMinLon).getUInt();
+      result.mPosn.lat = readFiltered.getColumn(Columns::ColMinLat).getUInt();
+      result.mBusinessProgramTier = readFiltered.getColumn(Columns::ProgramTier).getInt();
 
       aResultOut.push_back(std::move(result));
     }
 
     success = !aResultOut.empty();
 
-    readBasicFiltered.reset();
+    readFiltered.reset();
   } catch (const SQLite::Exception& e) {
     DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
     success = false;
   }
 
   return success;
-}  // End of GetBasicFiltered
+}  // End of ReadFiltered
 
 //----------------------------------------------------------------
 //!
-//!   @public
-//!   @detail Get a list of item records based on the specified
-//!   filter.
+//!   @private
+//!   @detail Get the first item records in the filter's sort
+//!   order, after its start marker if it has one.
+//!
+//!   Matches are kept in a heap of the filter's max results, with
+//!   the last kept result on top, so the full match list is never
+//!   sorted.
 //!
 //----------------------------------------------------------------
-bool SearchMarkerQuery::GetExtendedFiltered(const SearchMarkerFilter& aFilter,
-                                            std::vector<ExtendedMarkerDataType>& aResultOut) {
-  enum Parameters { MinLon = 1, MaxLon, MinLat, MaxLat, PoiType, SearchFilter, Name, Limit };
+bool SearchMarkerQuery::ReadOrdered(const SearchMarkerFilter& aFilter,
+                                    std::vector<MarkerTableDataType>& aResultOut) {
+  enum Parameters { FirstBbox = 1 };
+  enum FilterParameters { PoiType = 0, SearchFilter, Name };
+  enum KeyParameters { KeyId = 1 };
   enum Columns {
     ColId = 0,
     ColPoiType,
     LastUpdate,
     ColName,
+    ColSearchFilter,
     ColMinLon,
     ColMinLat,
     ProgramTier,
-    AvgRating,
-    ReviewCount,
-    Phone,
-    VhfChannel,
-    GasPrice,
-    DieselPrice,
-    Currency,
-    VolumeUnit
+    AvgRating
+  };
+  enum KeyColumns {
+    KeyName = 0,
+    KeyLastUpdate,
+    KeyMinLon,
+    KeyMinLat,
+    KeyProgramTier,
+    KeyAvgRating
+  };
+
+  typedef std::pair<SortKey, MarkerTableDataType> OrderedResult;
+  const auto isBefore = [](const OrderedResult& aLhs, const OrderedResult& aRhs) {
+    return IsBefore(aLhs.first, aRhs.first);
   };
+
+  const int32_t maxResults = aFilter.GetMaxResults();
+  if (maxResults == 0) {
+    return false;
+  }
+
+  const std::vector<bbox_type> bboxes = BboxClause::GetParts(aFilter.GetBbox());
+
+  std::vector<OrderedResult> heap;
   bool success = false;
 
   try {
-    SQLite::Statement readExtendedFiltered{mDatabase, ReadExtendedFilteredSql};
-    readExtendedFiltered.bind(Parameters::MinLon, aFilter.GetBbox().swc.lon);
-    readExtendedFiltered.bind(Parameters::MaxLon, aFilter.GetBbox().nec.lon);
-    readExtendedFiltered.bind(Parameters::MinLat, aFilter.GetBbox().swc.lat);
-    readExtendedFiltered.bind(Parameters::MaxLat, aFilter.GetBbox().nec.lat);
-    readExtendedFiltered.bind(Parameters::PoiType, aFilter.GetAllowedTypes());
-    readExtendedFiltered.bind(Parameters::SearchFilter,
-                              static_cast<int64_t>(aFilter.GetAllowedCategories()));
-
-    const std::string WILDCARD{"%"};
-    std::string searchExpression;
-
-    if (aFilter.GetSearchString().empty()) {
-      searchExpression = WILDCARD;
-    } else if (aFilter.GetStringMatchMode() == SearchMarkerFilter::MatchBeginningOfWord) {
-      searchExpression = aFilter.GetSearchString() + WILDCARD;
-    } else {
-      searchExpression = WILDCARD + aFilter.GetSearchString() + WILDCARD;
-    }
-
-    readExtendedFiltered.bind(Parameters::Name, searchExpression);
-    readExtendedFiltered.bind(Parameters::Limit, aFilter.GetMaxResults());
-
-    while (readExtendedFiltered.executeStep()) {
-      ExtendedMarkerDataType result;
-      result.mId = readExtendedFiltered.getColumn(Columns::ColId).getInt64();
-      result.mType = readExtendedFiltered.getColumn(Columns::ColPoiType).getInt();
-      result.mLastUpdated = readExtendedFiltered.getColumn(Columns::LastUpdate).getInt64();
-      result.mName = readExtendedFiltered.getColumn(Columns::ColName).getText();
-      result.mPosn.lon = readExtendedFiltered.getColumn(Columns::ColMinLon).getUInt();
-      result.mPosn.lat = readExtendedFiltered.getColumn(Columns::ColMinLat).getUInt();
-      result.mBusinessProgramTier = readExtendedFiltered.getColumn(Columns::ProgramTier).getInt();
-
-      if (!readExtendedFiltered.isColumnNull(Columns::AvgRating)) {
-        result.mReviewStatsData.mAverageRating =
-            static_cast<float>(readExtendedFiltered.getColumn(Columns::AvgRating).getDouble());
+    ACDB_marker_idx_type startAfterId;
+    const bool hasStartAfter = aFilter.GetStartAfter(startAfterId);
+
+    SortKey startAfter{};
+    if (hasStartAfter) {
+      SQLite::Statement readSortKey{mDatabase, ReadSortKeySql};
+      readSortKey.bind(KeyParameters::KeyId, static_cast<int64_t>(startAfterId));
+
+      if (!readSortKey.executeStep()) {
+        // The previous page ended with a marker that is gone, so its place is unknown.
+        DBG_W("Start marker %llu not found", static_cast<unsigned long long>(startAfterId));
+        return false;
       }
 
-      if (!readExtendedFiltered.isColumnNull(Columns::ReviewCount)) {
-        result.mReviewStatsData.mNumberOfReviews =
-            readExtendedFiltered.getColumn(Columns::ReviewCount).getInt();
+      scposn_type posn;
+      posn.lon = readSortKey.getColumn(KeyColumns::KeyMinLon).getUInt();
+      posn.lat = readSortKey.getColumn(KeyColumns::KeyMinLat).getUInt();
+      double averageRating = NoAverageRating;
+      if (!readSortKey.isColumnNull(KeyColumns::KeyAvgRating)) {
+        averageRating = readSortKey.getColumn(KeyColumns::KeyAvgRating).getDouble();
       }
 
-      if (!readExtendedFiltered.isColumnNull(Columns::Phone)) {
-        result.mContactData.mPhoneNumber = readExtendedFiltered.getColumn(Columns::Phone).getText();
-      }
+      startAfter = MakeSortKey(aFilter, startAfterId,
+                               readSortKey.getColumn(KeyColumns::KeyName).getText(),
+                               readSortKey.getColumn(KeyColumns::KeyLastUpdate).getInt64(), posn,
+                               readSortKey.getColumn(KeyColumns::KeyProgramTier).getInt(),
+                               averageRating);
+    }
 
-      if (!readExtendedFiltered.isColumnNull(Columns::VhfChannel)) {
-        result.mContactData.mVhfChannel =
-            readExtendedFiltered.getColumn(Columns::VhfChannel).getText();
+    const std::string& sqlStart = (aFilter.GetSortOrder() == SearchMarkerFilter::SortByRating)
+                                      ? ReadRatingOrderedFilteredSqlStart
+                                      : ReadOrderedFilteredSqlStart;
+    const std::string sql = sqlStart + BboxClause::GetSql(bboxes.size()) +
+                            GetAttributesFilterSql(aFilter) + ReadOrderedFilteredSqlEnd;
+    SQLite::Statement readOrdered{mDatabase, sql};
+
+    const int offset = BindAttributesFilter(
+        readOrdered, BboxClause::Bind(readOrdered, Parameters::FirstBbox, bboxes), aFilter);
+    readOrdered.bind(offset + FilterParameters::PoiType, aFilter.GetAllowedTypes());
+    readOrdered.bind(offset + FilterParameters::SearchFilter,
+                     static_cast<int64_t>(aFilter.GetAllowedCategories()));
+    readOrdered.bind(offset + FilterParameters::Name, GetSearchExpression(aFilter));
+
+    while (readOrdered.executeStep()) {
+      const ACDB_marker_idx_type id = readOrdered.getColumn(Columns::ColId).getInt64();
+      const char* name = readOrdered.getColumn(Columns::ColName).getText();
+      const uint64_t lastUpdated = readOrdered.getColumn(Columns::LastUpdate).getInt64();
+      const int businessProgramTier = readOrdered.getColumn(Columns::ProgramTier).getInt();
+      const double averageRating = readOrdered.isColumnNull(Columns::AvgRating)
+                                       ? NoAverageRating
+                                       : readOrdered.getColumn(Columns::AvgRating).getDouble();
+
+      scposn_type posn;
+      posn.lon = readOrdered.getColumn(Columns::ColMinLon).getUInt();
+      posn.lat = readOrdered.getColumn(Columns::ColMinLat).getUInt();
+
+      SortKey key =
+          MakeSortKey(aFilter, id, name, lastUpdated, posn, businessProgramTier, averageRating);
+
+      if (hasStartAfter && !IsBefore(startAfter, key)) {
+        continue;
       }
 
-      if (!readExtendedFiltered.isColumnNull(Columns::Currency) &&
-          !readExtendedFiltered.isColumnNull(Columns::VolumeUnit)) {
-        if (!readExtendedFiltered.isColumnNull(Columns::GasPrice)) {
-          result.mFuelData.mGasPrice =
-              static_cast<float>(readExtendedFiltered.getColumn(Columns::GasPrice).getDouble());
-        }
-
-        if (!readExtendedFiltered.isColumnNull(Columns::DieselPrice)) {
-          result.mFuelData.mDieselPrice =
-              static_cast<float>(readExtendedFiltered.getColumn(Columns::DieselPrice).getDouble());
-        }
+      const bool isFull = maxResults >= 0 && heap.size() == static_cast<size_t>(maxResults);
+      if (isFull && !IsBefore(key, heap.front().first)) {
+        continue;
+      }
 
-        result.mFuelData.mFuelPriceCurrency =
-            readExtendedFiltered.getColumn(Columns::Currency).getText();
-        result.mFuelData.mFuelPriceUnit =
-            readExtendedFiltered.getColumn(Columns::VolumeUnit).getUInt();
+      MarkerTableDataType result;
+      result.mId = id;
+      result.mType = readOrdered.getColumn(Columns::ColPoiType).getInt();
+      result.mLastUpdated = lastUpdated;
+      result.mName = name;
+      result.mSearchFilter = readOrdered.getColumn(Columns::ColSearchFilter).getInt64();
+      result.mPosn = posn;
+      result.mBusinessProgramTier = businessProgramTier;
+
+      if (isFull) {
+        std::pop_heap(heap.begin(), heap.end(), isBefore);
+        heap.pop_back();
       }
 
-      aResultOut.push_back(std::move(result));
+      heap.emplace_back(std::move(key), std::move(result));
+      std::push_heap(heap.begin(), heap.end(), isBefore);
     }
 
-    success = !aResultOut.empty();
+    success = true;
   } catch (const SQLite::Exception& e) {
     DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
     success = false;
   }
 
-  return success;
-}  // End of GetExtendedFiltered
+  std::sort_heap(heap.begin(), heap.end(), isBefore);
+
+  for (auto& orderedResult : heap) {
+    aResultOut.push_back(std::move(orderedResult.second));
+  }
+
+  return success && !heap.empty();
+}  // End of ReadOrdered
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Bind the filter's required attributes to the
+//!   parameters of the clause from GetAttributesFilterSql,
+//!   starting at aFirstParameter.
+//!
+//!   @return the parameter following the clause
+//!
+//----------------------------------------------------------------
+static int BindAttributesFilter(SQLite::Statement& aStatement, const int aFirstParameter,
+                                const SearchMarkerFilter& aFilter) {
+  enum Parameters { Mask = 0, Value, Count };
+
+  const uint64_t requiredAttributes = aFilter.GetRequiredAttributes();
+  if (requiredAttributes == 0) {
+    return aFirstParameter;
+  }
+
+  aStatement.bind(aFirstParameter + Parameters::Mask, static_cast<int64_t>(requiredAttributes));
+  aStatement.bind(aFirstParameter + Parameters::Value, static_cast<int64_t>(requiredAttributes));
+
+  return aFirstParameter + Parameters::Count;
+}  // End of BindAttributesFilter
+
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get the LIKE expression matching the filter's search
+//!   string.
+//!
+//----------------------------------------------------------------
+static std::string GetSearchExpression(const SearchMarkerFilter& aFilter) {
+  const std::string WILDCARD{"%"};
+
+  if (aFilter.GetSearchString().empty()) {
+    return WILDCARD;
+  } else if (aFilter.GetStringMatchMode() == SearchMarkerFilter::MatchBeginningOfWord) {
+    return aFilter.GetSearchString() + WILDCARD;
+  }
+
+  return WILDCARD + aFilter.GetSearchString() + WILDCARD;
+}  // End of GetSearchExpression
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Check whether aLhs comes before aRhs in an ordered
+//!   search.
+//!
+//----------------------------------------------------------------
+static bool IsBefore(const SortKey& aLhs, const SortKey& aRhs) {
+  return std::tie(aLhs.mValue, aLhs.mName, aLhs.mId) < std::tie(aRhs.mValue, aRhs.mName, aRhs.mId);
+}  // End of IsBefore
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Make the sort key of a marker for the filter's sort
+//!   order.
+//!
+//----------------------------------------------------------------
+static SortKey MakeSortKey(const SearchMarkerFilter& aFilter, const ACDB_marker_idx_type aId,
+                           const char* aName, const uint64_t aLastUpdated,
+                           const scposn_type& aPosn, const int aBusinessProgramTier,
+                           const double aAverageRating) {
+  SortKey key{0.0, std::string{}, aId};
+
+  switch (aFilter.GetSortOrder()) {
+    case SearchMarkerFilter::SortByName:
+      for (const char* c = aName; *c != '\0'; c++) {
+        key.mName.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(*c))));
+      }
+      break;
+    case SearchMarkerFilter::SortByDistance:
+      key.mValue = Geo::GetDistanceMeters(aFilter.GetReferencePoint(), aPosn);
+      break;
+    case SearchMarkerFilter::SortByRating:
+      key.mValue = -aAverageRating;
+      break;
+    case SearchMarkerFilter::SortByBusinessProgramTier:
+      key.mValue = -static_cast<double>(aBusinessProgramTier);
+      break;
+    case SearchMarkerFilter::SortByLastUpdated:
+      key.mValue = -static_cast<double>(aLastUpdated);
+      break;
+    default:
+      break;
+  }
+
+  return key;
+}  // End of MakeSortKey
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Read the review stats, contact and fuel columns of
+//!   aStatement, starting at aFirstColumn.
+//!
+//----------------------------------------------------------------
+static void ReadExtendedColumns(SQLite::Statement& aStatement, const int aFirstColumn,
+                                ExtendedMarkerDataType& aResultOut) {
+  enum Columns {
+    AvgRating = 0,
+    ReviewCount,
+    Phone,
+    VhfChannel,
+    GasPrice,
+    DieselPrice,
+    Currency,
+    VolumeUnit
+  };
+
+  if (!aStatement.isColumnNull(aFirstColumn + Columns::AvgRating)) {
+    aResultOut.mReviewStatsData.mAverageRating =
+        static_cast<float>(aStatement.getColumn(aFirstColumn + Columns::AvgRating).getDouble());
+  }
+
+  if (!aStatement.isColumnNull(aFirstColumn + Columns::ReviewCount)) {
+    aResultOut.mReviewStatsData.mNumberOfReviews =
+        aStatement.getColumn(aFirstColumn + Columns::ReviewCount).getInt();
+  }
+
+  if (!aStatement.isColumnNull(aFirstColumn + Columns::Phone)) {
+    aResultOut.mContactData.mPhoneNumber =
+        aStatement.getColumn(aFirstColumn + Columns::Phone).getText();
+  }
+
+  if (!aStatement.isColumnNull(aFirstColumn + Columns::VhfChannel)) {
+    aResultOut.mContactData.mVhfChannel =
+        aStatement.getColumn(aFirstColumn + Columns::VhfChannel).getText();
+  }
+
+  if (!aStatement.isColumnNull(aFirstColumn + Columns::Currency) &&
+      !aStatement.isColumnNull(aFirstColumn + Columns::VolumeUnit)) {
+    if (!aStatement.isColumnNull(aFirstColumn + Columns::GasPrice)) {
+      aResultOut.mFuelData.mGasPrice =
+          static_cast<float>(aStatement.getColumn(aFirstColumn + Columns::GasPrice).getDouble());
+    }
+
+    if (!aStatement.isColumnNull(aFirstColumn + Columns::DieselPrice)) {
+      aResultOut.mFuelData.mDieselPrice = static_cast<float>(
+          aStatement.getColumn(aFirstColumn + Columns::DieselPrice).getDouble());
+    }
+
+    aResultOut.mFuelData.mFuelPriceCurrency =
+        aStatement.getColumn(aFirstColumn + Columns::Currency).getText();
+    aResultOut.mFuelData.mFuelPriceUnit =
+        aStatement.getColumn(aFirstColumn + Columns::VolumeUnit).getUInt();
+  }
+}  // End of ReadExtendedColumns
 }  // end of namespace Acdb
@@ -163,7 +163,7 @@ bool ServicesQuery::Get(const ACDB_marker_idx_type aId, ServicesTableDataType& a
 //!
 //----------------------------------------------------------------
 bool ServicesQuery::Write(const ACDB_marker_idx_type aId,
-                          ServicesTableDataType&& aServicesTableData) {
+                          const ServicesTableDataType& aServicesTableData) {
   enum Parameters { Id = 1, SectionTitle, SectionNote, YesNo };
 
   if (!mWrite) {
@@ -175,8 +175,8 @@ bool ServicesQuery::Write(const ACDB_marker_idx_type aId,
   try {
     mWrite->bind(Parameters::Id, static_cast<int64_t>(aId));
     mWrite->bind(Parameters::SectionTitle, aServicesTableData.mSectionTitle);
-    mWrite->bind(Parameters::SectionNote, aServicesTableData.mSectionNoteJson);
-    mWrite->bind(Parameters::YesNo, aServicesTableData.mYesNoJson);
+    mWrite->bindNoCopy(Parameters::SectionNote, aServicesTableData.mSectionNoteJson);
+    mWrite->bindNoCopy(Parameters::YesNo, aServicesTableData.mYesNoJson);
 
     success = mWrite->exec();
 
@@ -143,7 +143,7 @@ bool TranslatorQuery::GetAll(std::vector<TranslationTableDataType>& aResultOut)
 //!   @detail Write translation to database.
 //!
 //----------------------------------------------------------------
-bool TranslatorQuery::Write(TranslationTableDataType&& aTranslationTableData) {
+bool TranslatorQuery::Write(const TranslationTableDataType& aTranslationTableData) {
   enum Parameters { Id = 1, LangId, Translation };
 
   if (!mWrite) {
@@ -155,7 +155,7 @@ bool TranslatorQuery::Write(TranslationTableDataType&& aTranslationTableData) {
   try {
     mWrite->bind(Parameters::Id, aTranslationTableData.mId);
     mWrite->bind(Parameters::LangId, aTranslationTableData.mLangId);
-    mWrite->bind(Parameters::Translation, aTranslationTableData.mTranslation);
+    mWrite->bindNoCopy(Parameters::Translation, aTranslationTableData.mTranslation);
 
     success = mWrite->exec();
 
@@ -0,0 +1,153 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Cancellation and deadlines for database reads.
+
+    SQLite calls a progress handler every few virtual machine
+    instructions; when it returns non-zero, the running statement
+    fails with SQLITE_INTERRUPT.  Read locks let several threads
+    use the same connection, and the handler belongs to the
+    connection, so the handler looks up the QueryControl of the
+    calling thread instead of being installed per read.  The
+    handler also records the interruption in the scope of the
+    calling thread, so that a deadline passing after the read
+    finished does not make its complete results look partial.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#include "Acdb/QueryControlScope.hpp"
+#include "sqlite3.h"
+
+namespace Acdb {
+
+//! Virtual machine instructions between checks of the QueryControl
+static const int ProgressHandlerPeriod = 1000;
+
+//! QueryControl of the reads made by this thread, if any
+static thread_local const QueryControl* CurrentQueryControl = nullptr;
+
+//! Set when the progress handler interrupts a read of this thread
+static thread_local bool* CurrentInterrupted = nullptr;
+
+static int OnProgress(void* aUnused);
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create a QueryControl without a deadline.
+//!
+//----------------------------------------------------------------
+QueryControl::QueryControl() : mCancelled{false}, mHasDeadline{false} {}  // end of QueryControl
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create a QueryControl that stops reads still running
+//!   at aDeadline.
+//!
+//----------------------------------------------------------------
+QueryControl::QueryControl(const Clock::time_point aDeadline)
+    : mCancelled{false}, mHasDeadline{true}, mDeadline{aDeadline} {}  // end of QueryControl
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Stop the reads using this QueryControl.  May be
+//!   called from any thread.
+//!
+//----------------------------------------------------------------
+void QueryControl::Cancel() { mCancelled = true; }  // end of Cancel
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Check whether reads using this QueryControl must stop.
+//!
+//----------------------------------------------------------------
+bool QueryControl::IsStopped() const {
+  return mCancelled || (mHasDeadline && Clock::now() >= mDeadline);
+}  // end of IsStopped
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Apply aQueryControl, which may be nullptr, to the
+//!   reads of the current thread.
+//!
+//----------------------------------------------------------------
+QueryControlScope::QueryControlScope(const QueryControl* aQueryControl)
+    : mQueryControl{aQueryControl},
+      mPreviousQueryControl{CurrentQueryControl},
+      mPreviousInterrupted{CurrentInterrupted},
+      mInterrupted{false} {
+  if (mQueryControl) {
+    CurrentQueryControl = mQueryControl;
+    CurrentInterrupted = &mInterrupted;
+  }
+}  // end of QueryControlScope
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Restore the QueryControl of the enclosing scope.
+//!
+//----------------------------------------------------------------
+QueryControlScope::~QueryControlScope() {
+  CurrentQueryControl = mPreviousQueryControl;
+  CurrentInterrupted = mPreviousInterrupted;
+}  // end of ~QueryControlScope
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @return true if a read in this scope was interrupted, so
+//!   its results may be partial.  Always false for a scope
+//!   without a QueryControl.
+//!
+//----------------------------------------------------------------
+bool QueryControlScope::WasInterrupted() const { return mInterrupted; }  // end of WasInterrupted
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Install the progress handler that applies
+//!   QueryControls to the reads made on aDatabase.
+//!
+//----------------------------------------------------------------
+void SetQueryControlHandler(SQLite::Database& aDatabase) {
+  sqlite3_progress_handler(aDatabase.getHandle(), ProgressHandlerPeriod, OnProgress, nullptr);
+}  // end of SetQueryControlHandler
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @return non-zero to interrupt the running statement
+//!
+//----------------------------------------------------------------
+static int OnProgress(void* aUnused) {
+  (void)aUnused;
+  if (CurrentQueryControl == nullptr || !CurrentQueryControl->IsStopped()) {
+    return 0;
+  }
+
+  *CurrentInterrupted = true;
+  return 1;
+}  // end of OnProgress
+
+}  // end of namespace Acdb
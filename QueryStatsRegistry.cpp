@@ -0,0 +1,267 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Per-statement latency and row counts of database queries.
+
+    The stats are fed by SQLite's trace callbacks rather than by the
+    query classes: SQLITE_TRACE_STMT starts a run, SQLITE_TRACE_ROW
+    counts its rows and SQLITE_TRACE_PROFILE ends it, whether the
+    statement finished, failed or was reset early.  Runs are timed
+    with a steady clock, as the profile time of the default VFS only
+    has millisecond resolution.  A busy handler counts the times a
+    run found the database locked.
+
+    Runs find their entry by statement address, so the SQL text is
+    only copied and hashed when a statement is first run.  Tracing
+    costs every statement a few callbacks, so databases are only
+    attached while stats are wanted.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "Acdb/QueryStatsRegistry.hpp"
+#include "sqlite3.h"
+
+namespace Acdb {
+
+constexpr size_t QueryStatsRegistry::MaxStatements;
+constexpr size_t QueryStatsRegistry::MaxPreparedStatements;
+
+using Clock = std::chrono::steady_clock;
+
+//! Entry of the statements beyond MaxStatements
+static const std::string OtherStatementsSql{"(other statements)"};
+
+//! Statement run in progress
+struct Run {
+  Clock::time_point mStart;
+  uint64_t mRowCount;
+  uint64_t mBusyCount;
+};
+
+//! Runs in progress on this thread.  A statement may start while
+//! another one is still running, so runs are kept by statement.
+static thread_local std::unordered_map<sqlite3_stmt*, Run> CurrentRuns;
+
+//! Statement whose run started last on this thread
+static thread_local sqlite3_stmt* LastStartedStatement = nullptr;
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create an empty registry.
+//!
+//----------------------------------------------------------------
+QueryStatsRegistry::QueryStatsRegistry() {}  // end of QueryStatsRegistry
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Record the statements run on aDatabase from now on.
+//!
+//!   SQLite keeps one busy handler per connection, and a busy
+//!   timeout is one too, so this replaces any busy timeout of
+//!   aDatabase: a locked database fails at once, as with no
+//!   timeout.  Only attach databases opened without one.
+//!
+//----------------------------------------------------------------
+void QueryStatsRegistry::Attach(SQLite::Database& aDatabase) {
+  sqlite3_trace_v2(aDatabase.getHandle(),
+                   SQLITE_TRACE_STMT | SQLITE_TRACE_ROW | SQLITE_TRACE_PROFILE, OnTrace, this);
+  sqlite3_busy_handler(aDatabase.getHandle(), OnBusy, this);
+}  // end of Attach
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Stop recording the statements run on aDatabase,
+//!   leaving it without a busy handler.  The stats recorded so far
+//!   are kept.
+//!
+//----------------------------------------------------------------
+void QueryStatsRegistry::Detach(SQLite::Database& aDatabase) {
+  sqlite3_trace_v2(aDatabase.getHandle(), 0, nullptr, nullptr);
+  sqlite3_busy_handler(aDatabase.getHandle(), nullptr, nullptr);
+
+  // Statements of aDatabase may be finalized unseen from now on.
+  std::lock_guard<std::mutex> lock{mMutex};
+  mStatementEntries.clear();
+}  // end of Detach
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get a snapshot of the stats of every statement run
+//!   so far.
+//!
+//----------------------------------------------------------------
+PerformanceStats QueryStatsRegistry::GetStats() const {
+  PerformanceStats result;
+
+  {
+    std::lock_guard<std::mutex> lock{mMutex};
+    result.reserve(mEntries.size());
+
+    for (const auto& it : mEntries) {
+      const Entry& entry = it.second;
+
+      QueryStats stats;
+      stats.mSql = it.first;
+      stats.mCallCount = entry.mLatency.GetCount();
+      stats.mRowCount = entry.mRowCount;
+      stats.mBusyCount = entry.mBusyCount;
+      stats.mTotalMicroseconds = entry.mLatency.GetTotalMicroseconds();
+      stats.mMaxMicroseconds = entry.mLatency.GetMaxMicroseconds();
+      stats.mP50Microseconds = entry.mLatency.GetPercentile(0.50);
+      stats.mP95Microseconds = entry.mLatency.GetPercentile(0.95);
+      stats.mP99Microseconds = entry.mLatency.GetPercentile(0.99);
+
+      result.push_back(std::move(stats));
+    }
+  }
+
+  std::sort(result.begin(), result.end(), [](const QueryStats& aLhs, const QueryStats& aRhs) {
+    return aLhs.mTotalMicroseconds > aRhs.mTotalMicroseconds;
+  });
+
+  return result;
+}  // end of GetStats
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Add a finished run of aStatement.
+//!
+//----------------------------------------------------------------
+void QueryStatsRegistry::Record(sqlite3_stmt* aStatement, const uint64_t aMicroseconds,
+                                const uint64_t aRowCount, const uint64_t aBusyCount) {
+  const char* sql = sqlite3_sql(aStatement);
+  if (sql == nullptr) {
+    sql = "";
+  }
+
+  std::lock_guard<std::mutex> lock{mMutex};
+
+  auto statementIt = mStatementEntries.find(aStatement);
+  if (statementIt == mStatementEntries.end() || statementIt->second.mSql != sql) {
+    // First run of this statement, or of another one prepared at the address of a finalized one.
+    if (statementIt == mStatementEntries.end() &&
+        mStatementEntries.size() >= MaxPreparedStatements) {
+      mStatementEntries.clear();
+    }
+
+    auto it = mEntries.find(sql);
+    if (it == mEntries.end()) {
+      // Statements built per call, like IN lists, could otherwise grow the registry without bound.
+      it = mEntries.emplace(mEntries.size() < MaxStatements ? sql : OtherStatementsSql, Entry{})
+               .first;
+    }
+
+    statementIt = mStatementEntries.emplace(aStatement, StatementEntry{}).first;
+    statementIt->second.mSql = sql;
+    statementIt->second.mEntry = &it->second;
+  }
+
+  Entry& entry = *statementIt->second.mEntry;
+  entry.mRowCount += aRowCount;
+  entry.mBusyCount += aBusyCount;
+  entry.mLatency.Add(aMicroseconds);
+}  // end of Record
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Count a busy database against the run that started
+//!   last on this thread, which is the one taking its locks.
+//!
+//!   @return 0, so the run fails with SQLITE_BUSY as it would
+//!   without a busy handler
+//!
+//----------------------------------------------------------------
+int QueryStatsRegistry::OnBusy(void* aRegistry, int aPriorCalls) {
+  (void)aRegistry;
+  (void)aPriorCalls;
+
+  auto it = CurrentRuns.find(LastStartedStatement);
+  if (it != CurrentRuns.end()) {
+    it->second.mBusyCount++;
+  }
+
+  return 0;
+}  // end of OnBusy
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Track the runs of the statements of an attached
+//!   database.
+//!
+//----------------------------------------------------------------
+int QueryStatsRegistry::OnTrace(unsigned aType, void* aRegistry, void* aStatement, void* aData) {
+  sqlite3_stmt* statement = static_cast<sqlite3_stmt*>(aStatement);
+
+  switch (aType) {
+    case SQLITE_TRACE_STMT: {
+      // Triggers of a running statement start with a comment; they are part of its run.
+      const char* sql = static_cast<const char*>(aData);
+      if (sql == nullptr || std::strncmp(sql, "--", 2) != 0) {
+        CurrentRuns[statement] = Run{Clock::now(), 0, 0};
+        LastStartedStatement = statement;
+      }
+      break;
+    }
+
+    case SQLITE_TRACE_ROW: {
+      auto it = CurrentRuns.find(statement);
+      if (it != CurrentRuns.end()) {
+        it->second.mRowCount++;
+      }
+      break;
+    }
+
+    case SQLITE_TRACE_PROFILE: {
+      auto it = CurrentRuns.find(statement);
+      if (it != CurrentRuns.end()) {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - it->second.mStart);
+
+        static_cast<QueryStatsRegistry*>(aRegistry)->Record(
+            statement, static_cast<uint64_t>(elapsed.count()), it->second.mRowCount,
+            it->second.mBusyCount);
+
+        CurrentRuns.erase(it);
+      }
+
+      if (LastStartedStatement == statement) {
+        LastStartedStatement = nullptr;
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+
+  return 0;
+}  // end of OnTrace
+
+}  // end of namespace Acdb
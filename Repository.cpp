@@ -24,6 +24,7 @@ limitations under the License.
 #define DBG_MODULE "ACDB"
 #define DBG_TAG "Repository"
 
+#include <chrono>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -36,14 +37,18 @@ limitations under the License.
 #include "Acdb/DatabaseConfig.hpp"
 #include "Acdb/EventDispatcher.hpp"
 #include "Acdb/FileUtil.hpp"
+#include "Acdb/GeoUtil.hpp"
 #include "Acdb/MapMarker.hpp"
+#include "Acdb/MarkerSnapshot.hpp"
 #include "Acdb/Presentation/PresentationMarker.hpp"
 #include "Acdb/Repository.hpp"
 #include "Acdb/PrvTypes.hpp"
 #include "Acdb/PubTypes.hpp"
+#include "Acdb/QueryControlScope.hpp"
 #include "Acdb/RwlLocker.hpp"
 #include "Acdb/SqliteCppUtil.hpp"
 #include "Acdb/StringUtil.hpp"
+#include "Acdb/TraceSpan.hpp"
 #include "Acdb/Version.hpp"
 #include "Acdb/TextTranslator.hpp"
 
@@ -68,6 +73,7 @@ const char* ExternalDbPath = "/Garmin/acdb";
 const std::string DbName("active_captain");
 const std::string DbExt(".db");
 const std::string JournalExt("-wal");
+const std::string SnapshotExt(".snapshot");
 const std::string TmpExt(".tmp");
 const std::string ZipExt(".gz");
 const std::string SupportedSchemaVer("2.0.0.0");
@@ -81,11 +87,18 @@ const std::string SupportedSchemaVer("2.0.0.0");
 Repository::Repository(const std::string& aDbPath)
     : mDbPath(aDbPath),
       mRwl(),
+      mLockStats(),
+      mQueryStats(),
+      mMarkerSnapshot(),
       mInfoAdapter(),
       mMarkerAdapter(),
       mPresentationAdapter(),
       mTranslationAdapter(),
-      mUpdateAdapter() {}  // end of Repository
+      mUpdateAdapter(),
+      mSideloadLocker(),
+      mMarkerSnapshotStale(false),
+      mQueryStatsEnabled(false),
+      mOptimizeOnClose(false) {}  // end of Repository
 
 //----------------------------------------------------------------
 //!
@@ -152,26 +165,28 @@ void Repository::EndTransaction(const bool aSuccess) const {
 //!       @returns true on success, false otherwise.
 //!
 //----------------------------------------------------------------
-bool Repository::ApplyMarkerUpdateToDb(std::vector<MarkerTableDataCollection>& aMarkerList,
+bool Repository::ApplyMarkerUpdateToDb(std::vector<MarkerTableDataCollection>&& aMarkerList,
                                        const TileXY* aTileXY) {
   if (aMarkerList.empty()) {
     return false;
   }
 
-  RwlLocker locker{mRwl, true};
+  RwlLocker locker{mRwl, true, mLockStats, "ApplyMarkerUpdateToDb"};
 
   if (!IsOpen()) {
     DBG_ASSERT_ALWAYS("Database is not open. Update applied in bad state.");
     return false;
   }
 
+  DropMarkerSnapshot();
+
   bool success = BeginTransaction();
 
   // Process all marker entries
   if (success) {
     uint64_t lastUpdateMax = 0;
 
-    success = mUpdateAdapter->UpdateMarkers(aMarkerList, lastUpdateMax);
+    success = mUpdateAdapter->UpdateMarkers(std::move(aMarkerList), lastUpdateMax);
 
     // If this update came from syncing a tile, update tileLastUpdate table.
     if (aTileXY != nullptr) {
@@ -206,13 +221,13 @@ bool Repository::ApplyMarkerUpdateToDb(std::vector<MarkerTableDataCollection>& a
 //!       @returns true on success, false otherwise.
 //!
 //----------------------------------------------------------------
-bool Repository::ApplyReviewUpdateToDb(std::vector<ReviewTableDataCollection>& aReviewList,
+bool Repository::ApplyReviewUpdateToDb(std::vector<ReviewTableDataCollection>&& aReviewList,
                                        const TileXY* aTileXY) {
   if (aReviewList.empty()) {
     return false;
   }
 
-  RwlLocker locker{mRwl, true};
+  RwlLocker locker{mRwl, true, mLockStats, "ApplyReviewUpdateToDb"};
 
   if (!IsOpen()) {
     DBG_ASSERT_ALWAYS("Database is not open. Update applied in bad state.");
@@ -225,7 +240,7 @@ bool Repository::ApplyReviewUpdateToDb(std::vector<ReviewTableDataCollection>& a
   if (success) {
     uint64_t lastUpdateMax = 0;
 
-    success = mUpdateAdapter->UpdateReviews(aReviewList, lastUpdateMax);
+    success = mUpdateAdapter->UpdateReviews(std::move(aReviewList), lastUpdateMax);
 
     // If this update came from syncing a tile, update tileLastUpdate table.
     if (aTileXY != nullptr) {
@@ -260,23 +275,32 @@ bool Repository::ApplyReviewUpdateToDb(std::vector<ReviewTableDataCollection>& a
 //!
 //----------------------------------------------------------------
 bool Repository::ApplySupportTableUpdateToDb(
-    std::vector<LanguageTableDataType>& aLanguageList,
-    std::vector<MustacheTemplateTableDataType>& aMustacheTemplateList,
-    std::vector<TranslationTableDataType>& aTranslations) {
-  RwlLocker locker{mRwl, true};
+    std::vector<LanguageTableDataType>&& aLanguageList,
+    std::vector<MustacheTemplateTableDataType>&& aMustacheTemplateList,
+    std::vector<TranslationTableDataType>&& aTranslations) {
+  RwlLocker locker{mRwl, true, mLockStats, "ApplySupportTableUpdateToDb"};
 
   if (!IsOpen()) {
     DBG_ASSERT_ALWAYS("Database is not open. Update applied in bad state.");
     return false;
   }
 
+  // The snapshot holds translations, which may change.
+  DropMarkerSnapshot();
+
   bool success = BeginTransaction();
 
-  success = success && mUpdateAdapter->UpdateSupportTables(aLanguageList, aMustacheTemplateList,
-                                                           aTranslations);
+  success = success && mUpdateAdapter->UpdateSupportTables(std::move(aLanguageList),
+                                                           std::move(aMustacheTemplateList),
+                                                           std::move(aTranslations));
 
   EndTransaction(success);
 
+  if (success) {
+    // Preloaded tables no longer match the database.
+    TextTranslator::GetInstance().ClearPreloaded();
+  }
+
   return success;
 }  // end of ApplySupportTableUpdateToDb
 
@@ -305,8 +329,9 @@ void Repository::Delete() {
 //----------------------------------------------------------------
 Presentation::BusinessPhotoListPtr Repository::GetBusinessPhotoList(
     const ACDB_marker_idx_type aIdx) {
+  ACDB_TRACE_SPAN("Repository::GetBusinessPhotoList");
   Presentation::BusinessPhotoListPtr result = nullptr;
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetBusinessPhotoList"};
   if (mDatabase) {
     result = mPresentationAdapter->GetBusinessPhotoList(aIdx);
   }
@@ -385,7 +410,7 @@ bool Repository::GetDbFileVersionInfo(const std::string& aPath, Version& aVersio
 bool Repository::GetLastUpdateInfo(LastUpdateInfoType& aUpdateInfoOut) {
   bool result(false);
 
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetLastUpdateInfo"};
   if (mDatabase) {
     result = BeginTransaction();
     result = result && mInfoAdapter->GetLastUpdateInfo(aUpdateInfoOut);
@@ -406,7 +431,7 @@ bool Repository::GetLastUpdateInfo(LastUpdateInfoType& aUpdateInfoOut) {
 //----------------------------------------------------------------
 IMapMarkerPtr Repository::GetMapMarker(const ACDB_marker_idx_type aIdx) {
   IMapMarkerPtr result = nullptr;
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetMapMarker"};
   if (mDatabase) {
     result = mMarkerAdapter->GetMapMarker(aIdx);
   }
@@ -425,7 +450,7 @@ IMapMarkerPtr Repository::GetMapMarker(const ACDB_marker_idx_type aIdx) {
 //----------------------------------------------------------------
 ISearchMarkerPtr Repository::GetSearchMarker(const ACDB_marker_idx_type aIdx) {
   ISearchMarkerPtr result = nullptr;
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetSearchMarker"};
   if (mDatabase) {
     result = mMarkerAdapter->GetSearchMarker(aIdx);
   }
@@ -439,34 +464,108 @@ ISearchMarkerPtr Repository::GetSearchMarker(const ACDB_marker_idx_type aIdx) {
 //!    @detail
 //!    Find points in the provided bounding box.
 //!
+//!    @return false if aQueryControl stopped the read early, in
+//!    which case the results are partial
+//!
 //----------------------------------------------------------------
-void Repository::GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
-                                       std::vector<IMapMarkerPtr>& aResults) {
-  RwlLocker locker{mRwl, false};
+bool Repository::GetMapMarkersByFilter(const MapMarkerFilter& aFilter,
+                                       std::vector<IMapMarkerPtr>& aResults,
+                                       const QueryControl* aQueryControl) {
+  ACDB_TRACE_SPAN("Repository::GetMapMarkersByFilter");
+  RwlLocker locker{mRwl, false, mLockStats, "GetMapMarkersByFilter"};
   if (!mDatabase) {
-    return;
+    return true;
   }
 
-  bbox_type leftBbox;
-  bbox_type rightBbox;
-  if (MakeSplitBoundingBoxForCrossMeridianSearch(aFilter.GetBbox(), leftBbox, rightBbox)) {
-    MapMarkerFilter adaptedFilter = aFilter;
+  QueryControlScope queryControlScope{aQueryControl};
 
-    std::vector<IMapMarkerPtr> leftResults;
-    adaptedFilter.SetBbox(leftBbox);
-    mMarkerAdapter->GetMapMarkersByFilter(adaptedFilter, leftResults);
+  mMarkerAdapter->GetMapMarkersByFilter(aFilter, aResults);
 
-    std::vector<IMapMarkerPtr> rightResults;
-    adaptedFilter.SetBbox(rightBbox);
-    mMarkerAdapter->GetMapMarkersByFilter(adaptedFilter, rightResults);
+  return !queryControlScope.WasInterrupted();
+}  // end of GetMapMarkersByFilter
 
-    std::move(leftResults.begin(), leftResults.end(), std::back_inserter(aResults));
-    std::move(rightResults.begin(), rightResults.end(), std::back_inserter(aResults));
-  } else {
-    mMarkerAdapter->GetMapMarkersByFilter(aFilter, aResults);
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find points in the provided bounding box as columns, for
+//!    callers iterating many points.
+//!
+//!    @return false if aQueryControl stopped the read early, in
+//!    which case the results are partial
+//!
+//----------------------------------------------------------------
+bool Repository::GetMapMarkersByFilter(const MapMarkerFilter& aFilter, MapMarkerColumns& aResults,
+                                       const QueryControl* aQueryControl) {
+  ACDB_TRACE_SPAN("Repository::GetMapMarkersByFilter");
+  RwlLocker locker{mRwl, false, mLockStats, "GetMapMarkersByFilter"};
+  if (!mDatabase) {
+    return true;
   }
+
+  QueryControlScope queryControlScope{aQueryControl};
+
+  mMarkerAdapter->GetMapMarkersByFilter(aFilter, aResults);
+
+  return !queryControlScope.WasInterrupted();
 }  // end of GetMapMarkersByFilter
 
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find points for several filters under one read lock, so
+//!    every filter sees the same database state.  Markers matched
+//!    by more than one filter are returned once.
+//!
+//!    @return false if aQueryControl stopped the read early, in
+//!    which case the results are partial
+//!
+//----------------------------------------------------------------
+bool Repository::GetMapMarkersByFilters(const std::vector<MapMarkerFilter>& aFilters,
+                                        std::vector<IMapMarkerPtr>& aResults,
+                                        std::vector<std::vector<size_t>>& aResultIndexes,
+                                        const QueryControl* aQueryControl) {
+  ACDB_TRACE_SPAN("Repository::GetMapMarkersByFilters");
+  RwlLocker locker{mRwl, false, mLockStats, "GetMapMarkersByFilters"};
+  if (!mDatabase) {
+    aResultIndexes.assign(aFilters.size(), std::vector<size_t>{});
+    return true;
+  }
+
+  QueryControlScope queryControlScope{aQueryControl};
+
+  mMarkerAdapter->GetMapMarkersByFilters(aFilters, aResults, aResultIndexes);
+
+  return !queryControlScope.WasInterrupted();
+}  // end of GetMapMarkersByFilters
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Get the wait and hold times of the repository lock so far,
+//!    by call site.
+//!
+//----------------------------------------------------------------
+LockPerformanceStats Repository::GetLockStats() const {
+  // The registry has its own lock; reading it must not wait on the repository lock it measures.
+  return mLockStats.GetStats();
+}  // end of GetLockStats
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Get the latency and row counts of the statements run on
+//!    the database while performance stats were enabled.
+//!
+//----------------------------------------------------------------
+PerformanceStats Repository::GetPerformanceStats() const {
+  // The registry has its own lock, so reads and updates are not held up.
+  return mQueryStats.GetStats();
+}  // end of GetPerformanceStats
+
 //----------------------------------------------------------------
 //!
 //!    @public
@@ -479,7 +578,7 @@ bool Repository::GetMergePageData(const int aPageNumber, const int aPageSize,
                                   std::vector<ReviewTableDataCollection>& aReviews_out) {
   bool success = false;
 
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetMergePageData"};
   if (mDatabase) {
     aMarkers_out.clear();
     aReviews_out.clear();
@@ -503,7 +602,8 @@ bool Repository::GetMergePageData(const int aPageNumber, const int aPageSize,
         std::vector<ReviewTableDataCollection> markerReviews;
         success = success && GetMergeReviews(markerId, markerReviews);
         if (!markerReviews.empty()) {
-          aReviews_out.insert(aReviews_out.end(), markerReviews.begin(), markerReviews.end());
+          aReviews_out.insert(aReviews_out.end(), std::make_move_iterator(markerReviews.begin()),
+                              std::make_move_iterator(markerReviews.end()));
         }
       }
     }
@@ -525,7 +625,7 @@ bool Repository::GetMergePageData(const int aPageNumber, const int aPageSize,
 bool Repository::GetMergeMarker(const ACDB_marker_idx_type aIdx,
                                 MarkerTableDataCollection& aMarker) {
   Presentation::PresentationMarkerPtr result = nullptr;
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetMergeMarker"};
   if (mDatabase) {
     aMarker = mMergeAdapter->GetMarker(aIdx);
     return true;
@@ -556,7 +656,7 @@ void Repository::GetMergeMarkerIds(const uint32_t aPageNumber, const uint32_t aP
 //----------------------------------------------------------------
 bool Repository::GetMergeReviews(const ACDB_marker_idx_type aIdx,
                                  std::vector<ReviewTableDataCollection>& aReviews) {
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetMergeReviews"};
   if (mDatabase) {
     aReviews = mMergeAdapter->GetReviews(aIdx);
     return true;
@@ -571,32 +671,24 @@ bool Repository::GetMergeReviews(const ACDB_marker_idx_type aIdx,
 //!    @detail
 //!    Find points matching the provided filter
 //!
+//!    @return false if aQueryControl stopped the read early, in
+//!    which case the results are partial
+//!
 //----------------------------------------------------------------
-void Repository::GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                               std::vector<ISearchMarkerPtr>& aResults) {
-  RwlLocker locker{mRwl, false};
+bool Repository::GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                               std::vector<ISearchMarkerPtr>& aResults,
+                                               const QueryControl* aQueryControl) {
+  ACDB_TRACE_SPAN("Repository::GetBasicSearchMarkersByFilter");
+  RwlLocker locker{mRwl, false, mLockStats, "GetBasicSearchMarkersByFilter"};
   if (!mDatabase) {
-    return;
+    return true;
   }
 
-  bbox_type leftBbox;
-  bbox_type rightBbox;
-  if (MakeSplitBoundingBoxForCrossMeridianSearch(aFilter.GetBbox(), leftBbox, rightBbox)) {
-    SearchMarkerFilter adaptedFilter = aFilter;
-
-    std::vector<ISearchMarkerPtr> leftResults;
-    adaptedFilter.SetBbox(leftBbox);
-    mMarkerAdapter->GetBasicSearchMarkersByFilter(adaptedFilter, leftResults);
+  QueryControlScope queryControlScope{aQueryControl};
 
-    std::vector<ISearchMarkerPtr> rightResults;
-    adaptedFilter.SetBbox(rightBbox);
-    mMarkerAdapter->GetBasicSearchMarkersByFilter(adaptedFilter, rightResults);
+  mMarkerAdapter->GetBasicSearchMarkersByFilter(aFilter, aResults);
 
-    std::move(leftResults.begin(), leftResults.end(), std::back_inserter(aResults));
-    std::move(rightResults.begin(), rightResults.end(), std::back_inserter(aResults));
-  } else {
-    mMarkerAdapter->GetBasicSearchMarkersByFilter(aFilter, aResults);
-  }
+  return !queryControlScope.WasInterrupted();
 }  // end of GetBasicSearchMarkersByFilter
 
 //----------------------------------------------------------------
@@ -605,33 +697,132 @@ void Repository::GetBasicSearchMarkersByFilter(const SearchMarkerFilter& aFilter
 //!    @detail
 //!    Find points matching the provided filter
 //!
+//!    @return false if aQueryControl stopped the read early, in
+//!    which case the results are partial
+//!
 //----------------------------------------------------------------
-void Repository::GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
-                                          std::vector<ISearchMarkerPtr>& aResults) {
-  RwlLocker locker{mRwl, false};
+bool Repository::GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
+                                          std::vector<ISearchMarkerPtr>& aResults,
+                                          const QueryControl* aQueryControl) {
+  ACDB_TRACE_SPAN("Repository::GetSearchMarkersByFilter");
+  RwlLocker locker{mRwl, false, mLockStats, "GetSearchMarkersByFilter"};
   if (!mDatabase) {
-    return;
+    return true;
   }
 
-  bbox_type leftBbox;
-  bbox_type rightBbox;
-  if (MakeSplitBoundingBoxForCrossMeridianSearch(aFilter.GetBbox(), leftBbox, rightBbox)) {
-    SearchMarkerFilter adaptedFilter = aFilter;
+  QueryControlScope queryControlScope{aQueryControl};
 
-    std::vector<ISearchMarkerPtr> leftResults;
-    adaptedFilter.SetBbox(leftBbox);
-    mMarkerAdapter->GetSearchMarkersByFilter(adaptedFilter, leftResults);
+  mMarkerAdapter->GetSearchMarkersByFilter(aFilter, aResults);
 
-    std::vector<ISearchMarkerPtr> rightResults;
-    adaptedFilter.SetBbox(rightBbox);
-    mMarkerAdapter->GetSearchMarkersByFilter(adaptedFilter, rightResults);
+  return !queryControlScope.WasInterrupted();
+}  // end of GetSearchMarkersByFilter
 
-    std::move(leftResults.begin(), leftResults.end(), std::back_inserter(aResults));
-    std::move(rightResults.begin(), rightResults.end(), std::back_inserter(aResults));
-  } else {
-    mMarkerAdapter->GetSearchMarkersByFilter(aFilter, aResults);
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find the markers matching the filter closest to aPosition
+//!
+//!    @return false if aQueryControl stopped the read early, in
+//!    which case the results are partial
+//!
+//----------------------------------------------------------------
+bool Repository::GetNearestSearchMarkers(const scposn_type& aPosition, const uint32_t aCount,
+                                         const SearchMarkerFilter& aFilter,
+                                         std::vector<SearchMarkerDistancePair>& aResults,
+                                         const QueryControl* aQueryControl) {
+  ACDB_TRACE_SPAN("Repository::GetNearestSearchMarkers");
+  RwlLocker locker{mRwl, false, mLockStats, "GetNearestSearchMarkers"};
+  if (!mDatabase) {
+    return true;
   }
-}  // end of GetSearchMarkersByFilter
+
+  QueryControlScope queryControlScope{aQueryControl};
+
+  mMarkerAdapter->GetNearestSearchMarkers(aPosition, aCount, aFilter, aResults);
+
+  return !queryControlScope.WasInterrupted();
+}  // end of GetNearestSearchMarkers
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find the markers matching the filter within aBufferMeters of
+//!    aRoute.  The read lock is taken for one leg at a time and
+//!    released before that leg's results are passed to aCallback,
+//!    so a slow callback does not hold off updates.
+//!
+//!    @return false if aQueryControl stopped the read early, in
+//!    which case the results of the leg it stopped are partial
+//!    and the later legs are not searched
+//!
+//----------------------------------------------------------------
+bool Repository::GetSearchMarkersAlongRoute(const std::vector<scposn_type>& aRoute,
+                                            const double aBufferMeters,
+                                            const SearchMarkerFilter& aFilter,
+                                            const RouteSearchCallback& aCallback,
+                                            const QueryControl* aQueryControl) {
+  ACDB_TRACE_SPAN("Repository::GetSearchMarkersAlongRoute");
+  MarkerAdapter::RouteSearchProgress progress;
+  bool more = true;
+  bool interrupted = false;
+
+  while (more && !interrupted) {
+    std::vector<RouteSearchMarker> legResults;
+
+    {
+      RwlLocker locker{mRwl, false, mLockStats, "GetSearchMarkersAlongRoute"};
+      if (!mDatabase) {
+        return true;
+      }
+
+      QueryControlScope queryControlScope{aQueryControl};
+
+      more = mMarkerAdapter->GetSearchMarkersAlongRouteLeg(aRoute, aBufferMeters, aFilter,
+                                                           progress, legResults);
+
+      // A stop between reads skips the remaining legs.
+      interrupted = queryControlScope.WasInterrupted() ||
+                    (more && aQueryControl != nullptr && aQueryControl->IsStopped());
+    }
+
+    for (auto& result : legResults) {
+      if (!aCallback(std::move(result))) {
+        return !interrupted;
+      }
+    }
+  }
+
+  return !interrupted;
+}  // end of GetSearchMarkersAlongRoute
+
+//----------------------------------------------------------------
+//!
+//!    @public
+//!    @detail
+//!    Find the marker records matching the provided filter, for
+//!    search sessions to filter again in memory.
+//!
+//!    @return false if aQueryControl stopped the read early, in
+//!    which case the results are partial
+//!
+//----------------------------------------------------------------
+bool Repository::GetSearchCandidates(const SearchMarkerFilter& aFilter,
+                                     std::vector<MarkerTableDataType>& aResults,
+                                     const QueryControl* aQueryControl) {
+  ACDB_TRACE_SPAN("Repository::GetSearchCandidates");
+  RwlLocker locker{mRwl, false, mLockStats, "GetSearchCandidates"};
+  if (!mDatabase) {
+    return true;
+  }
+
+  QueryControlScope queryControlScope{aQueryControl};
+
+  mMarkerAdapter->GetSearchCandidates(aFilter, aResults);
+
+  return !queryControlScope.WasInterrupted();
+}  // end of GetSearchCandidates
 
 //----------------------------------------------------------------
 //!
@@ -642,8 +833,9 @@ void Repository::GetSearchMarkersByFilter(const SearchMarkerFilter& aFilter,
 //!
 //----------------------------------------------------------------
 std::string Repository::GetMustacheTemplate(const std::string& aName) {
+  ACDB_TRACE_SPAN("Repository::GetMustacheTemplate");
   std::string result;
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetMustacheTemplate"};
   if (mDatabase) {
     result = mPresentationAdapter->GetTemplate(aName);
   }
@@ -663,8 +855,9 @@ std::string Repository::GetMustacheTemplate(const std::string& aName) {
 //----------------------------------------------------------------
 Presentation::PresentationMarkerPtr Repository::GetPresentationMarker(
     const ACDB_marker_idx_type aIdx, const std::string& aCaptainName) {
+  ACDB_TRACE_SPAN("Repository::GetPresentationMarker");
   Presentation::PresentationMarkerPtr result = nullptr;
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetPresentationMarker"};
   if (mDatabase) {
     result = mPresentationAdapter->GetMarker(aIdx, aCaptainName);
   }
@@ -672,6 +865,27 @@ Presentation::PresentationMarkerPtr Repository::GetPresentationMarker(
   return result;
 }  // end of GetPresentationMarker
 
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief accessor
+//!
+//!       @returns a specific Marker of the respository with only
+//!       the marker detail and the requested sections loaded.
+//!
+//----------------------------------------------------------------
+Presentation::PresentationMarkerPtr Repository::GetPresentationMarkerSections(
+    const ACDB_marker_idx_type aIdx, const SectionType aSections) {
+  ACDB_TRACE_SPAN("Repository::GetPresentationMarkerSections");
+  Presentation::PresentationMarkerPtr result = nullptr;
+  RwlLocker locker{mRwl, false, mLockStats, "GetPresentationMarkerSections"};
+  if (mDatabase) {
+    result = mPresentationAdapter->GetMarkerSections(aIdx, aSections);
+  }
+
+  return result;
+}  // end of GetPresentationMarkerSections
+
 //----------------------------------------------------------------
 //!
 //!       @public
@@ -684,8 +898,9 @@ Presentation::PresentationMarkerPtr Repository::GetPresentationMarker(
 Presentation::ReviewListPtr Repository::GetReviewList(const ACDB_marker_idx_type aIdx,
                                                       const int aPageNumber, const int aPageSize,
                                                       const std::string& aCaptainName) {
+  ACDB_TRACE_SPAN("Repository::GetReviewList");
   Presentation::ReviewListPtr result = nullptr;
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetReviewList"};
   if (mDatabase) {
     result = mPresentationAdapter->GetReviewList(aIdx, aPageNumber, aPageSize, aCaptainName);
   }
@@ -729,7 +944,7 @@ bool Repository::GetSupportTableData(std::vector<LanguageTableDataType>& aLangua
 bool Repository::GetTileLastUpdateInfo(const TileXY& aTileXY, LastUpdateInfoType& aUpdateInfoOut) {
   bool result(false);
 
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetTileLastUpdateInfo"};
   if (mDatabase) {
     result = mInfoAdapter->GetTileLastUpdateInfo(aTileXY, aUpdateInfoOut);
   }
@@ -747,7 +962,7 @@ bool Repository::GetTileLastUpdateInfo(const TileXY& aTileXY, LastUpdateInfoType
 //----------------------------------------------------------------
 void Repository::GetTilesLastUpdateInfoByBoundingBoxes(
     const std::vector<bbox_type>& aBboxes, std::map<TileXY, LastUpdateInfoType>& aTiles) {
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetTilesLastUpdateInfoByBoundingBoxes"};
   if (mDatabase) {
     for (auto bbox : aBboxes) {
       bbox_type leftBbox;
@@ -771,7 +986,7 @@ void Repository::GetTilesLastUpdateInfoByBoundingBoxes(
 //----------------------------------------------------------------
 float Repository::GetUserReviewAverageStars(const ACDB_marker_idx_type aIdx) {
   float result = 0;
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetUserReviewAverageStars"};
 
   if (mDatabase) {
     result = mMarkerAdapter->GetAverageStars(aIdx);
@@ -799,7 +1014,7 @@ bool Repository::IsOpen() { return (mDatabase != nullptr); }  // end of IsOpen
 //!       @returns if the open was successful
 //----------------------------------------------------------------
 bool Repository::Open() {
-  bool success = OpenDatabase(true /*updateStateOnFailure*/);
+  bool success = OpenDatabase(true /*updateStateOnFailure*/, false /*aMergeSource*/);
 
   if (success) {
     EventDispatcher::SendEvent(MessageId::StateInstalled);
@@ -816,11 +1031,12 @@ bool Repository::Open() {
 //!       @detail
 //!       Private implementation of Open(), allowing the caller to
 //!       determine if a status update should be send automatically at
-//!       the end.
+//!       the end.  A merge source is read once and deleted, so it
+//!       neither reads nor writes a marker snapshot.
 //!
 //!       @returns if the open was successful
 //----------------------------------------------------------------
-bool Repository::OpenDatabase(bool updateStateOnFailure) {
+bool Repository::OpenDatabase(bool updateStateOnFailure, const bool aMergeSource) {
   bool success{true};
   bool notCompatible{false};
 
@@ -846,7 +1062,7 @@ bool Repository::OpenDatabase(bool updateStateOnFailure) {
     }
   }
 
-  RwlLocker locker{mRwl, true};
+  RwlLocker locker{mRwl, true, mLockStats, "OpenDatabase"};
 
   if (mDatabase) {
     // the database is already open. Nothing to do.
@@ -870,6 +1086,10 @@ bool Repository::OpenDatabase(bool updateStateOnFailure) {
   }
 
   if (success) {
+    if (mQueryStatsEnabled) {
+      mQueryStats.Attach(*mDatabase);
+    }
+
     mInfoAdapter.reset(new InfoAdapter{*mDatabase});
     mMarkerAdapter.reset(new MarkerAdapter{*mDatabase});
     mMergeAdapter.reset(new MergeAdapter{*mDatabase});
@@ -887,6 +1107,14 @@ bool Repository::OpenDatabase(bool updateStateOnFailure) {
     }
   }
 
+  if (success && !aMergeSource) {
+    mOptimizeOnClose = true;
+    OpenMarkerSnapshot();
+
+    // Without a snapshot, write one on close so the next start has it.
+    mMarkerSnapshotStale = !mMarkerSnapshot;
+  }
+
   if (notCompatible || invalidFile) {
     if (updateStateOnFailure) {
       Delete();  // this updates the module state after deletion
@@ -908,10 +1136,28 @@ bool Repository::OpenDatabase(bool updateStateOnFailure) {
 //!
 //----------------------------------------------------------------
 void Repository::Close() {
-  RwlLocker locker{mRwl, true};
+  RwlLocker locker{mRwl, true, mLockStats, "Close"};
 
   DBG_D_IF(!mDatabase, "DB already closed");
 
+#if (acdb_MARKER_SNAPSHOT_SUPPORT)
+  if (mDatabase && mMarkerSnapshotStale) {
+    WriteMarkerSnapshot();
+  }
+#endif
+
+#if !(acdb_MFD_DB_SHARING_SUPPORT)
+  // Refresh the planner statistics once per session rather than on each open, so temporary
+  // connections and merged tile databases never pay for it.
+  if (mDatabase && mOptimizeOnClose) {
+    const int analysisLimit = DatabaseConfig::GetTuning().mAnalysisLimit;
+    const bool optimized =
+        (analysisLimit <= 0) || SqliteCppUtil::Optimize(*mDatabase, analysisLimit);
+    DBG_W_IF(!optimized, "Failed to optimize database.");
+  }
+#endif
+  mOptimizeOnClose = false;
+
   if (mDatabase) {
     mUpdateAdapter.reset();
     mInfoAdapter.reset();
@@ -919,6 +1165,7 @@ void Repository::Close() {
     mMergeAdapter.reset();
     mPresentationAdapter.reset();
     mTranslationAdapter.reset();
+    mMarkerSnapshot.reset();
     mDatabase.reset();
   }
 }  // end of Close
@@ -932,7 +1179,7 @@ void Repository::Close() {
 Version Repository::GetVersion() {
   Version retVersion;
 
-  RwlLocker locker{mRwl, false};
+  RwlLocker locker{mRwl, false, mLockStats, "GetVersion"};
   if (mDatabase) {
     mInfoAdapter->GetVersion(retVersion);
   }
@@ -993,6 +1240,25 @@ std::string Repository::GetDbJournalPath() {
   return dbPath + JournalExt;
 }  // end of GetDbJournalPath
 
+//----------------------------------------------------------------
+//!
+//!       @private
+//!       @details
+//!       Gets the local path to the marker snapshot of the
+//!       Active Captain database.
+//!
+//!       @returns the path or an empty string on failure.
+//!
+//----------------------------------------------------------------
+std::string Repository::GetMarkerSnapshotPath() {
+  std::string dbPath = GetDbPath();
+  if (dbPath.empty()) {
+    return dbPath;
+  }
+
+  return dbPath + SnapshotExt;
+}  // end of GetMarkerSnapshotPath
+
 //----------------------------------------------------------------
 //!
 //!       @public
@@ -1009,7 +1275,7 @@ bool Repository::BeginSideload() {
   // Flush WAL file to the database file after each update to
   // make sure the database is prepared for a sideload
   SqliteCppUtil::FlushWalFile(*mDatabase);
-  mRwl.LockShared();
+  mSideloadLocker.reset(new RwlLocker{mRwl, false, mLockStats, "Sideload"});
   return true;
 }  // end of BeginSideload
 
@@ -1019,7 +1285,7 @@ bool Repository::BeginSideload() {
 //!       @details End the sideload process by unlocking the repository.
 //!
 //----------------------------------------------------------------
-void Repository::EndSideload() { mRwl.Unlock(); }  // end of EndSideload
+void Repository::EndSideload() { mSideloadLocker.reset(); }  // end of EndSideload
 
 //----------------------------------------------------------------
 //!
@@ -1079,6 +1345,22 @@ bool Repository::PrepareSharedDb(const std::string& aPath) const {
   return success;
 }  // end of PrepareSharedDb
 
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @details Loads strings for several languages so that later
+//!                calls to SetLanguage() switch instantly.
+//!
+//----------------------------------------------------------------
+void Repository::PreloadLanguages(const std::vector<std::string>& aLanguages) {
+  RwlLocker locker{mRwl, true, mLockStats, "PreloadLanguages"};
+  if (mDatabase) {
+    for (auto& language : aLanguages) {
+      mTranslationAdapter->PreloadTextTranslator(language);
+    }
+  }
+}  // end of PreloadLanguages
+
 //----------------------------------------------------------------
 //!
 //!       @public
@@ -1086,12 +1368,75 @@ bool Repository::PrepareSharedDb(const std::string& aPath) const {
 //!
 //----------------------------------------------------------------
 void Repository::SetLanguage(const std::string& aLanguage) {
-  RwlLocker locker{mRwl, true};
+  {
+    std::lock_guard<std::mutex> lock{mLanguageMutex};
+    mLanguage = aLanguage;
+  }
+
+  // Preloaded languages are switched without touching the database.
+  if (TextTranslator::GetInstance().PublishPreloaded(aLanguage)) {
+    return;
+  }
+
+  RwlLocker locker{mRwl, true, mLockStats, "SetLanguage"};
+
+#if (acdb_MARKER_SNAPSHOT_SUPPORT)
+  std::vector<TranslationDataType> translations;
+  if (mMarkerSnapshot && mMarkerSnapshot->GetTranslations(aLanguage, translations)) {
+    TextTranslator::GetInstance().Publish(
+        TextTranslator::TablePtr(new TextTranslator::Table(std::move(translations))));
+    return;
+  }
+#endif
+
   if (mDatabase) {
     mTranslationAdapter->InitTextTranslator(aLanguage);
   }
 }  // end of SetLanguage
 
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @details Start or stop recording the stats of the
+//!       statements run on the database and of the repository
+//!       lock.  Off by default, as tracing slows every statement
+//!       down and lock stats serialize the release of readers.
+//!
+//----------------------------------------------------------------
+void Repository::SetPerformanceStatsEnabled(const bool aEnabled) {
+  mLockStats.SetEnabled(aEnabled);
+
+  RwlLocker locker{mRwl, true, mLockStats, "SetPerformanceStatsEnabled"};
+
+  if (aEnabled == mQueryStatsEnabled) {
+    return;
+  }
+
+  mQueryStatsEnabled = aEnabled;
+
+  if (mDatabase) {
+    if (aEnabled) {
+      mQueryStats.Attach(*mDatabase);
+    } else {
+      mQueryStats.Detach(*mDatabase);
+    }
+  }
+}  // end of SetPerformanceStatsEnabled
+
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @details Report the holders of the repository lock
+//!       keeping it for at least aThresholdMilliseconds to
+//!       aCallback; an empty callback stops the reports.
+//!
+//----------------------------------------------------------------
+void Repository::SetSlowLockHolderCallback(const uint32_t aThresholdMilliseconds,
+                                           SlowLockHolderCallback aCallback) {
+  mLockStats.SetSlowHolderCallback(static_cast<uint64_t>(aThresholdMilliseconds) * 1000,
+                                   std::move(aCallback));
+}  // end of SetSlowLockHolderCallback
+
 //----------------------------------------------------------------
 //!
 //!       @private
@@ -1101,8 +1446,11 @@ void Repository::SetLanguage(const std::string& aLanguage) {
 //----------------------------------------------------------------
 bool Repository::DeleteDatabaseFile() {
   bool success = false;
-  RwlLocker locker{mRwl, true};
+  RwlLocker locker{mRwl, true, mLockStats, "DeleteDatabaseFile"};
 
+  // The snapshot is deleted with the database, not rewritten, and the database not optimized.
+  mMarkerSnapshotStale = false;
+  mOptimizeOnClose = false;
   Close();
 
   std::string path = DatabaseConfig::GetExpandedPath(GetDbPath());
@@ -1136,10 +1484,36 @@ bool Repository::DeleteDatabaseFile() {
     FileUtil::Delete(journalPath);
   }
 
+  DropMarkerSnapshot();
+
   DBG_D_IF(!success, "Failed to delete database");
   return success;
 }  // end of DeleteDatabaseFile
 
+//----------------------------------------------------------------
+//!
+//!       @private
+//!       @details Stop serving markers from the snapshot and
+//!       delete it, as the database is about to change.  It is
+//!       rewritten on close.  Callers hold the write lock.
+//!
+//----------------------------------------------------------------
+void Repository::DropMarkerSnapshot() {
+#if (acdb_MARKER_SNAPSHOT_SUPPORT)
+  mMarkerSnapshotStale = true;
+
+  if (mMarkerAdapter) {
+    mMarkerAdapter->SetMarkerSnapshot(nullptr);
+  }
+  mMarkerSnapshot.reset();
+
+  std::string path = GetMarkerSnapshotPath();
+  if (!path.empty() && FileUtil::Exists(path)) {
+    FileUtil::Delete(path);
+  }
+#endif
+}  // end of DropMarkerSnapshot
+
 //----------------------------------------------------------------
 //!
 //!       @private
@@ -1267,6 +1641,38 @@ std::unique_ptr<SQLite::Database> Repository::OpenDatabaseFile(const std::string
   return SqliteCppUtil::OpenDatabaseFileExt(aPath, openMode);
 }  // end of OpenDatabaseFile
 
+//----------------------------------------------------------------
+//!
+//!       @private
+//!       @details Map the marker snapshot and serve map markers
+//!       from it, if it was written for the open database.  A
+//!       stale snapshot is deleted.  Callers hold the write lock.
+//!
+//----------------------------------------------------------------
+void Repository::OpenMarkerSnapshot() {
+#if (acdb_MARKER_SNAPSHOT_SUPPORT)
+  std::string path = GetMarkerSnapshotPath();
+  if (path.empty() || !FileUtil::Exists(path)) {
+    return;
+  }
+
+  Version version;
+  LastUpdateInfoType lastUpdateInfo;
+  mInfoAdapter->GetVersion(version);
+
+  if (mInfoAdapter->GetLastUpdateInfo(lastUpdateInfo)) {
+    mMarkerSnapshot = MarkerSnapshot::Open(path, version, lastUpdateInfo);
+  }
+
+  if (mMarkerSnapshot) {
+    mMarkerAdapter->SetMarkerSnapshot(mMarkerSnapshot.get());
+  } else {
+    DBG_I("Stale marker snapshot, removing.");
+    FileUtil::Delete(path);
+  }
+#endif
+}  // end of OpenMarkerSnapshot
+
 //----------------------------------------------------------------
 //!
 //!       @private
@@ -1298,19 +1704,96 @@ bool Repository::ReadyDbAccess(SQLite::Database& aDatabase) const {
   journalMode = SqliteCppUtil::JournalMode::Wal;
 #endif
 
+  // Let QueryControls stop reads
+  SetQueryControlHandler(aDatabase);
+
+  const DatabaseConfig::Tuning tuning = DatabaseConfig::GetTuning();
+
   // Set desired file locking
   success = SqliteCppUtil::SetLockingMode(aDatabase, lockingMode);
   DBG_E_IF(!success, "Failed to set locking mode.");
 
+  // The page size of an empty database can't change once in WAL mode.
+  if (success) {
+    SqliteCppUtil::SetPageSize(aDatabase, tuning.mPageSize);
+  }
+
   // Set desired journal mode
   if (success) {
     success = SqliteCppUtil::SetJournalMode(aDatabase, journalMode);
     DBG_E_IF(!success, "Failed to set journal mode.");
   }
 
+  if (success) {
+    TuneDbAccess(aDatabase, tuning, journalMode == SqliteCppUtil::JournalMode::Wal);
+  }
+
   return success;
 }  // end of ReadyDbAccess
 
+//----------------------------------------------------------------
+//!
+//!       @private
+//!       @details Apply the SQLite settings of the device.  A
+//!       setting that fails only costs speed, so it is logged
+//!       and the database used regardless.
+//!
+//----------------------------------------------------------------
+void Repository::TuneDbAccess(SQLite::Database& aDatabase, const DatabaseConfig::Tuning& aTuning,
+                              const bool aWalMode) const {
+  bool success = SqliteCppUtil::SetMmapSize(aDatabase, aTuning.mMmapSize);
+  success = SqliteCppUtil::SetCacheSize(aDatabase, aTuning.mCacheSizeKib) && success;
+  success = SqliteCppUtil::SetTempStore(aDatabase, aTuning.mTempStore) && success;
+
+  // Outside WAL mode, e.g. for a shared database, keep the default durability.  The planner
+  // statistics are refreshed on Close().
+  if (aWalMode) {
+    success = SqliteCppUtil::SetSynchronous(aDatabase, aTuning.mWalSynchronous) && success;
+    success = SqliteCppUtil::SetWalAutoCheckpoint(aDatabase, aTuning.mWalAutoCheckpoint) && success;
+  }
+
+  DBG_W_IF(!success, "Failed to apply database tuning.");
+}  // end of TuneDbAccess
+
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @details
+//!       Build the fuzzy name search data and the attribute
+//!       index of the open database if they are missing, e.g.
+//!       in a database installed from the server or by an
+//!       older version.  Called from the sync path, which takes
+//!       the write lock anyway, rather than on open, so that a
+//!       first open does not block all reads while indexing;
+//!       until then fuzzy searches match names with LIKE, and
+//!       attribute filters compute the attributes from the
+//!       marker sections.  Read-only (shared) databases are
+//!       left as they are.
+//!
+//----------------------------------------------------------------
+void Repository::UpdateSearchData() {
+  RwlLocker locker{mRwl, true, mLockStats, "UpdateSearchData"};
+
+  if (!mUpdateAdapter || mUpdateAdapter->IsSearchDataComplete() ||
+      SqliteCppUtil::IsReadOnly(*mDatabase)) {
+    return;
+  }
+
+  // Each index is built in its own transaction, so that rolling
+  // back one does not drop the tables of the other.
+  bool success = BeginTransaction();
+  success = success && mUpdateAdapter->UpdateNameSearch();
+  EndTransaction(success);
+
+  if (success) {
+    success = BeginTransaction();
+    success = success && mUpdateAdapter->UpdateMarkerAttributes();
+    EndTransaction(success);
+  }
+
+  DBG_W_IF(!success, "Failed to update search data.");
+}  // end of UpdateSearchData
+
 //----------------------------------------------------------------
 //!
 //!       @public
@@ -1320,10 +1803,12 @@ bool Repository::ReadyDbAccess(SQLite::Database& aDatabase) const {
 //!
 //----------------------------------------------------------------
 bool Repository::DeleteTile(const TileXY& aTileXY, const bool aCreateTransaction) {
-  RwlLocker locker{mRwl, true};
+  RwlLocker locker{mRwl, true, mLockStats, "DeleteTile"};
 
   bool success{mDatabase};
   if (success) {
+    DropMarkerSnapshot();
+
     if (aCreateTransaction) {
       success = success && BeginTransaction();
     }
@@ -1347,7 +1832,7 @@ bool Repository::DeleteTile(const TileXY& aTileXY, const bool aCreateTransaction
 bool Repository::DeleteTileReviews(const TileXY& aTileXY) {
   bool result{false};
 
-  RwlLocker locker{mRwl, true};
+  RwlLocker locker{mRwl, true, mLockStats, "DeleteTileReviews"};
   if (mDatabase) {
     result = BeginTransaction();
     result = result && mUpdateAdapter->DeleteTileReviews(aTileXY);
@@ -1366,22 +1851,7 @@ bool Repository::DeleteTileReviews(const TileXY& aTileXY) {
 bool Repository::MakeSplitBoundingBoxForCrossMeridianSearch(const bbox_type& aOriginalBbox,
                                                             bbox_type& aLeftBbox,
                                                             bbox_type& aRightBbox) const {
-  // Check if the search box crosses the antimeridian.
-  if (aOriginalBbox.swc.lon <= aOriginalBbox.nec.lon) {
-    // Box does not cross the antimeridian.
-    return false;
-  }
-
-  // Box crosses the antimeridian.  Do a split search with two boxes:
-  //     aLeftBbox covers everything West of the antimeridian.
-  //     aRightBbox covers everything East of the antimeridian.
-  aLeftBbox = aOriginalBbox;
-  aLeftBbox.nec.lon = ACDB_MAX_LON;
-
-  aRightBbox = aOriginalBbox;
-  aRightBbox.swc.lon = ACDB_MIN_LON;
-
-  return true;
+  return Geo::SplitCrossMeridianBbox(aOriginalBbox, aLeftBbox, aRightBbox);
 }  // end of MakeSplitBoundingBoxForCrossMeridianSearch
 
 //----------------------------------------------------------------
@@ -1399,22 +1869,20 @@ bool Repository::InstallSingleTileDatabase(const std::string& aTileDatabaseFile,
   bool success = GetDbFileVersionInfo(aTileDatabaseFile, downloadedVersion, updateInfo) &&
                  downloadedVersion.SchemaCompatible();
   if (success && downloadedVersion.IsNewerThan(currentlyInstalledVersion)) {
-    // Version update. We must delete the local DB completely.
-    if (mDatabase) {
-      Close();
-    }
+    // Version update. We must delete the local DB completely; this closes it without writing a
+    // snapshot that would be deleted with it.
     success = success && DeleteDatabaseFile();
   }
 
   if (!mDatabase) {
-    RwlLocker locker{mRwl, true};
+    RwlLocker locker{mRwl, true, mLockStats, "InstallSingleTileDatabase"};
 
     // this is the 1st database installation at all. Just move the file over.
     success = success && FileUtil::Rename(aTileDatabaseFile, GetDbPath());
     if (success) {
       // open the DB instantly, but do not send a status.
       // the caller of this function will do this anyway.
-      OpenDatabase(true /*updateStateOnFailure*/);
+      OpenDatabase(true /*updateStateOnFailure*/, false /*aMergeSource*/);
     }
   } else {
     // Start merging this DB into the existing one.
@@ -1438,7 +1906,7 @@ bool Repository::MergeSingleTileDatabase(const std::string& aTileDatabaseFile,
   bool success{true};
 
   Repository source{aTileDatabaseFile};
-  if (!source.OpenDatabase(false /*updateStateOnFailure*/)) {
+  if (!source.OpenDatabase(false /*updateStateOnFailure*/, true /*aMergeSource*/)) {
     return false;
   }
 
@@ -1449,7 +1917,9 @@ bool Repository::MergeSingleTileDatabase(const std::string& aTileDatabaseFile,
     std::vector<TranslationTableDataType> translations;
 
     success = success && source.GetSupportTableData(languages, mustacheTemplates, translations);
-    success = success && ApplySupportTableUpdateToDb(languages, mustacheTemplates, translations);
+    success = success && ApplySupportTableUpdateToDb(std::move(languages),
+                                                     std::move(mustacheTemplates),
+                                                     std::move(translations));
   }
 
   // Merge markers and reviews
@@ -1462,19 +1932,24 @@ bool Repository::MergeSingleTileDatabase(const std::string& aTileDatabaseFile,
     LastUpdateInfoType lastUpdateInfo;
     success = success && mInfoAdapter->WriteTileLastUpdateInfo(aTileXY, lastUpdateInfo);
 
+    bool morePages = false;
+
     do {
       source.GetMergePageData(pageNumber, MergePageSize, markers, reviews);
 
+      // The updates consume the pages.
+      morePages = !markers.empty();
+
       if (!markers.empty()) {
-        success = success && ApplyMarkerUpdateToDb(markers, &aTileXY);
+        success = success && ApplyMarkerUpdateToDb(std::move(markers), &aTileXY);
       }
 
       if (!reviews.empty()) {
-        success = success && ApplyReviewUpdateToDb(reviews, &aTileXY);
+        success = success && ApplyReviewUpdateToDb(std::move(reviews), &aTileXY);
       }
 
       pageNumber++;
-    } while (success && !markers.empty());
+    } while (success && morePages);
   }
 
   source.Close();
@@ -1482,4 +1957,75 @@ bool Repository::MergeSingleTileDatabase(const std::string& aTileDatabaseFile,
   return success;
 }  // end of MergeSingleTileDatabase
 
+//----------------------------------------------------------------
+//!
+//!       @private
+//!       @details Rewrite the marker snapshot from the database,
+//!       so the next start serves map markers without SQLite.
+//!       Done on close rather than after each page of a sync
+//!       or each installed tile.  The database is about to be
+//!       closed, so the new snapshot is left for the next open
+//!       to map.  Reading every marker holds the write lock, so
+//!       the time taken is logged.
+//!
+//!       @returns true if the snapshot was written
+//!
+//----------------------------------------------------------------
+bool Repository::WriteMarkerSnapshot() {
+  bool success = false;
+
+#if (acdb_MARKER_SNAPSHOT_SUPPORT)
+  std::string language;
+  {
+    std::lock_guard<std::mutex> lock{mLanguageMutex};
+    language = mLanguage;
+  }
+
+  RwlLocker locker{mRwl, true, mLockStats, "WriteMarkerSnapshot"};
+  if (!mDatabase) {
+    return false;
+  }
+
+  const auto startTime = std::chrono::steady_clock::now();
+
+  Version version;
+  LastUpdateInfoType lastUpdateInfo;
+  MapMarkerColumns markers;
+  std::vector<TranslationDataType> translations;
+
+  mInfoAdapter->GetVersion(version);
+
+  success = BeginTransaction();
+  success = success && mInfoAdapter->GetLastUpdateInfo(lastUpdateInfo);
+  success = success && mMarkerAdapter->GetAllMapMarkers(markers);
+  if (success && !language.empty()) {
+    // Without translations the snapshot still serves markers.
+    mTranslationAdapter->GetTranslations(language, translations);
+  }
+  EndTransaction(success);
+
+  DropMarkerSnapshot();
+
+  const std::string path = GetMarkerSnapshotPath();
+  const std::string tmpPath = path + TmpExt;
+  success = success && !path.empty();
+  success = success && MarkerSnapshot::Write(tmpPath, version, lastUpdateInfo, markers,
+                                             language, translations);
+  success = success && FileUtil::Rename(tmpPath, path);
+
+  if (success) {
+    mMarkerSnapshotStale = false;
+  } else {
+    DBG_W("Failed to write the marker snapshot.");
+    FileUtil::Delete(tmpPath);
+  }
+
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - startTime);
+  DBG_I("Marker snapshot write took %lld ms.", static_cast<long long>(elapsed.count()));
+#endif
+
+  return success;
+}  // end of WriteMarkerSnapshot
+
 }  // end of namespace Acdb
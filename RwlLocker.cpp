@@ -15,9 +15,13 @@ limitations under the License.
 ------------------------------------------------------------------------------*/
 
 #include "Acdb/RwlLocker.hpp"
+#include "Acdb/LockStatsRegistry.hpp"
+#include "Acdb/TraceSpan.hpp"
 
 namespace Acdb {
 
+using Clock = std::chrono::steady_clock;
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -25,12 +29,42 @@ namespace Acdb {
 //!
 //----------------------------------------------------------------
 RwlLocker::RwlLocker(ReadWriteLock& aReadWriteLock, const bool aExclusive)
-    : mReadWriteLock{aReadWriteLock} {
-  if (aExclusive) {
-    mReadWriteLock.LockExclusive();
-  } else {
-    mReadWriteLock.LockShared();
+    : mReadWriteLock{aReadWriteLock},
+      mExclusive{aExclusive},
+      mLockStats{nullptr},
+      mTag{nullptr},
+      mWaitMicroseconds{0},
+      mLockTime{} {
+  Lock();
+}  // end of RwlLocker
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Constructor, lock the RWL for the lifetime of the object
+//!   and report the wait and hold times to aLockStats under aTag, a
+//!   string literal naming the call site, if it is recording.
+//!
+//----------------------------------------------------------------
+RwlLocker::RwlLocker(ReadWriteLock& aReadWriteLock, const bool aExclusive,
+                     LockStatsRegistry& aLockStats, const char* aTag)
+    : mReadWriteLock{aReadWriteLock},
+      mExclusive{aExclusive},
+      mLockStats{aLockStats.IsRecording() ? &aLockStats : nullptr},
+      mTag{aTag},
+      mWaitMicroseconds{0},
+      mLockTime{} {
+  if (mLockStats == nullptr) {
+    Lock();
+    return;
   }
+
+  const Clock::time_point waitTime = Clock::now();
+  Lock();
+  mLockTime = Clock::now();
+
+  mWaitMicroseconds = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(mLockTime - waitTime).count());
 }  // end of RwlLocker
 
 //----------------------------------------------------------------
@@ -39,6 +73,34 @@ RwlLocker::RwlLocker(ReadWriteLock& aReadWriteLock, const bool aExclusive)
 //!   @brief Destructor, releases the lock
 //!
 //----------------------------------------------------------------
-RwlLocker::~RwlLocker() { mReadWriteLock.Unlock(); }  // end of ~RwlLocker
+RwlLocker::~RwlLocker() {
+  if (mLockStats == nullptr) {
+    mReadWriteLock.Unlock();
+    return;
+  }
+
+  const uint64_t holdMicroseconds = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - mLockTime).count());
+  mReadWriteLock.Unlock();
+
+  // Reported once released, so a slow holder callback doesn't extend the hold.
+  mLockStats->Record(mTag, mExclusive, mWaitMicroseconds, holdMicroseconds);
+}  // end of ~RwlLocker
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @brief Lock the RWL
+//!
+//----------------------------------------------------------------
+void RwlLocker::Lock() {
+  // Spans the wait for the lock, not the time it is held.
+  ACDB_TRACE_SPAN("RwlLocker::Wait");
+  if (mExclusive) {
+    mReadWriteLock.LockExclusive();
+  } else {
+    mReadWriteLock.LockShared();
+  }
+}  // end of Lock
 
 }  // end of namespace Acdb
@@ -0,0 +1,285 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Search-as-you-type session.  Each keystroke usually extends the
+    previous search string, which can only remove matches, so the
+    session keeps the previous matches and filters them in memory
+    instead of scanning the bounding box again.  The database is
+    read again only when the bounding box, types or categories
+    change, the search string is not an extension of the previous
+    one, or the previous matches were too many to keep.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "SearchSession"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+#include "Acdb/MarkerFactory.hpp"
+#include "Acdb/Repository.hpp"
+#include "Acdb/SearchSession.hpp"
+#include "DBG_pub.h"
+
+namespace Acdb {
+
+static bool ContainsIgnoringCase(const std::string& aStr, const std::string& aPattern);
+
+static bool IsKeepable(const SearchMarkerFilter& aFilter);
+
+static bool IsNameMatch(const SearchMarkerFilter& aFilter, const std::string& aName);
+
+static bool IsSameLetter(const char aLhs, const char aRhs);
+
+static bool StartsWithIgnoringCase(const std::string& aStr, const std::string& aPattern);
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Constructor
+//!
+//----------------------------------------------------------------
+SearchSession::SearchSession(RepositoryPtr aRepositoryPtr)
+    : mRepositoryPtr{std::move(aRepositoryPtr)},
+      mGeneration{0},
+      mHasCandidates{false} {}  // end of SearchSession
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Cancel the search in progress, stopping its
+//!   database read.
+//!
+//----------------------------------------------------------------
+void SearchSession::Cancel() {
+  ++mGeneration;
+
+  std::lock_guard<std::mutex> lock{mMutex};
+  if (mQueryControl) {
+    mQueryControl->Cancel();
+  }
+}  // end of Cancel
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Find the basic search markers matching aFilter,
+//!   filtering the previous matches in memory when aFilter only
+//!   extends the previous search string.
+//!
+//!   @return false if the search was cancelled or superseded
+//!
+//----------------------------------------------------------------
+bool SearchSession::Search(const SearchMarkerFilter& aFilter,
+                           std::vector<ISearchMarkerPtr>& aResults) {
+  const uint64_t generation = ++mGeneration;
+  const int32_t maxResults = aFilter.GetMaxResults();
+  const std::shared_ptr<QueryControl> queryControl = std::make_shared<QueryControl>();
+
+  std::vector<MarkerTableDataType> matches;
+  bool isRefined = false;
+
+  {
+    std::lock_guard<std::mutex> lock{mMutex};
+
+    // This search supersedes the one in progress.
+    if (mQueryControl) {
+      mQueryControl->Cancel();
+    }
+    mQueryControl = queryControl;
+
+    if (CanRefine(aFilter)) {
+      mCandidates.erase(std::remove_if(mCandidates.begin(), mCandidates.end(),
+                                       [&aFilter](const MarkerTableDataType& aCandidate) {
+                                         return !IsNameMatch(aFilter, aCandidate.mName);
+                                       }),
+                        mCandidates.end());
+      mCandidatesFilter = aFilter;
+
+      const size_t count = (maxResults < 0) ? mCandidates.size()
+                                            : std::min(mCandidates.size(),
+                                                       static_cast<size_t>(maxResults));
+      matches.assign(mCandidates.begin(), mCandidates.begin() + count);
+      isRefined = true;
+    }
+  }
+
+  if (!isRefined) {
+    // Read one more than can be kept, to tell whether they are all here.
+    const bool isKeepable = IsKeepable(aFilter);
+    SearchMarkerFilter candidatesFilter = aFilter;
+    if (isKeepable) {
+      candidatesFilter.SetMaxResults(MaxCandidates + 1);
+    }
+
+    bool isRead = mRepositoryPtr->GetSearchCandidates(candidatesFilter, matches,
+                                                      queryControl.get());
+
+    const bool isComplete = matches.size() <= static_cast<size_t>(MaxCandidates);
+    if (isRead && isKeepable && !isComplete && (maxResults < 0 || maxResults > MaxCandidates)) {
+      // Too many to keep, and more than were read are wanted.
+      matches.clear();
+      isRead = mRepositoryPtr->GetSearchCandidates(aFilter, matches, queryControl.get());
+    }
+
+    if (!isRead || generation != mGeneration) {
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock{mMutex};
+
+    mHasCandidates = isKeepable && isComplete;
+    if (mHasCandidates) {
+      mCandidatesFilter = aFilter;
+      mCandidates = matches;
+    } else {
+      mCandidates.clear();
+    }
+
+    if (maxResults >= 0 && matches.size() > static_cast<size_t>(maxResults)) {
+      matches.resize(maxResults);
+    }
+  }
+
+  if (generation != mGeneration) {
+    return false;
+  }
+
+  for (auto& match : matches) {
+    aResults.push_back(GetSearchMarker(match));
+  }
+
+  return true;
+}  // end of Search
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Check whether every match of aFilter is among the
+//!   kept candidates.  Must be called with mMutex locked.
+//!
+//----------------------------------------------------------------
+bool SearchSession::CanRefine(const SearchMarkerFilter& aFilter) const {
+  if (!mHasCandidates || !IsKeepable(aFilter)) {
+    return false;
+  }
+
+  const bbox_type& bbox = aFilter.GetBbox();
+  const bbox_type& candidatesBbox = mCandidatesFilter.GetBbox();
+  if (bbox.swc.lat != candidatesBbox.swc.lat || bbox.swc.lon != candidatesBbox.swc.lon ||
+      bbox.nec.lat != candidatesBbox.nec.lat || bbox.nec.lon != candidatesBbox.nec.lon) {
+    return false;
+  }
+
+  if (aFilter.GetAllowedTypes() != mCandidatesFilter.GetAllowedTypes() ||
+      aFilter.GetAllowedCategories() != mCandidatesFilter.GetAllowedCategories() ||
+      aFilter.GetRequiredAttributes() != mCandidatesFilter.GetRequiredAttributes() ||
+      aFilter.GetStringMatchMode() != mCandidatesFilter.GetStringMatchMode()) {
+    return false;
+  }
+
+  // Filtering keeps the order of the candidates, so it must be the same order.
+  const scposn_type& referencePoint = aFilter.GetReferencePoint();
+  const scposn_type& candidatesReferencePoint = mCandidatesFilter.GetReferencePoint();
+  if (aFilter.GetSortOrder() != mCandidatesFilter.GetSortOrder() ||
+      (aFilter.GetSortOrder() == SearchMarkerFilter::SortByDistance &&
+       (referencePoint.lat != candidatesReferencePoint.lat ||
+        referencePoint.lon != candidatesReferencePoint.lon))) {
+    return false;
+  }
+
+  // Matching the new string implies matching the kept one.
+  const std::string& searchString = aFilter.GetSearchString();
+  const std::string& candidatesSearchString = mCandidatesFilter.GetSearchString();
+  if (aFilter.GetStringMatchMode() == SearchMarkerFilter::MatchBeginningOfWord) {
+    return StartsWithIgnoringCase(searchString, candidatesSearchString);
+  }
+
+  return ContainsIgnoringCase(searchString, candidatesSearchString);
+}  // end of CanRefine
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Check whether aStr contains aPattern, ignoring ASCII
+//!   case like SQLite's LIKE.
+//!
+//----------------------------------------------------------------
+static bool ContainsIgnoringCase(const std::string& aStr, const std::string& aPattern) {
+  return aPattern.empty() || std::search(aStr.begin(), aStr.end(), aPattern.begin(),
+                                         aPattern.end(), IsSameLetter) != aStr.end();
+}  // end of ContainsIgnoringCase
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Check whether the matches of aFilter can be filtered
+//!   again in memory.  Fuzzy matches are ranked rather than
+//!   filtered, LIKE wildcards in the search string do not match
+//!   literally, and a later page is not all of the matches.
+//!
+//----------------------------------------------------------------
+static bool IsKeepable(const SearchMarkerFilter& aFilter) {
+  ACDB_marker_idx_type startAfterId;
+  return aFilter.GetStringMatchMode() != SearchMarkerFilter::MatchFuzzy &&
+         aFilter.GetSearchString().find_first_of("%_") == std::string::npos &&
+         !aFilter.GetStartAfter(startAfterId);
+}  // end of IsKeepable
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Check aName against the search string of aFilter the
+//!   way SearchMarkerQuery does.
+//!
+//----------------------------------------------------------------
+static bool IsNameMatch(const SearchMarkerFilter& aFilter, const std::string& aName) {
+  if (aFilter.GetStringMatchMode() == SearchMarkerFilter::MatchBeginningOfWord) {
+    return StartsWithIgnoringCase(aName, aFilter.GetSearchString());
+  }
+
+  return ContainsIgnoringCase(aName, aFilter.GetSearchString());
+}  // end of IsNameMatch
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Compare two characters ignoring ASCII case.
+//!
+//----------------------------------------------------------------
+static bool IsSameLetter(const char aLhs, const char aRhs) {
+  return std::tolower(static_cast<unsigned char>(aLhs)) ==
+         std::tolower(static_cast<unsigned char>(aRhs));
+}  // end of IsSameLetter
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Check whether aStr starts with aPattern, ignoring
+//!   ASCII case like SQLite's LIKE.
+//!
+//----------------------------------------------------------------
+static bool StartsWithIgnoringCase(const std::string& aStr, const std::string& aPattern) {
+  return aStr.size() >= aPattern.size() &&
+         std::equal(aPattern.begin(), aPattern.end(), aStr.begin(), IsSameLetter);
+}  // end of StartsWithIgnoringCase
+
+}  // end of namespace Acdb
@@ -53,7 +53,8 @@ SettingsManager::SettingsManager()
     : mCoordFormat{ACDB_COORD_DEG_MIN},
       mDateFormat{ACDB_DATE_MONTH_ABBR},
       mDistanceUnit{ACDB_METER},
-      mVolumeUnit{ACDB_LITER} {}  // end of SettingsManager
+      mVolumeUnit{ACDB_LITER},
+      mEpoch{0} {}  // end of SettingsManager
 
 //----------------------------------------------------------------
 //!
@@ -99,6 +100,18 @@ ACDB_unit_type SettingsManager::GetDistanceUnit() const {
   return mDistanceUnit;
 }  // end of GetDistanceUnit
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief accessor
+//!   @detail Incremented every time a setting changes, so callers
+//!           can cache values derived from the settings.
+//!
+//----------------------------------------------------------------
+uint32_t SettingsManager::GetEpoch() const {
+  return mEpoch.load(std::memory_order_acquire);
+}  // end of GetEpoch
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -117,6 +130,7 @@ ACDB_unit_type SettingsManager::GetVolumeUnit() const {
 //----------------------------------------------------------------
 void SettingsManager::SetCoordinateFormat(const ACDB_coord_format_type aCoordFormat) {
   mCoordFormat = aCoordFormat;
+  mEpoch.fetch_add(1, std::memory_order_release);
 }  // end of SetCoordinateFormat
 
 //----------------------------------------------------------------
@@ -127,6 +141,7 @@ void SettingsManager::SetCoordinateFormat(const ACDB_coord_format_type aCoordFor
 //----------------------------------------------------------------
 void SettingsManager::SetDateFormat(const ACDB_date_format_type aDateFormat) {
   mDateFormat = aDateFormat;
+  mEpoch.fetch_add(1, std::memory_order_release);
 }  // end of SetDateFormat
 
 //----------------------------------------------------------------
@@ -137,6 +152,7 @@ void SettingsManager::SetDateFormat(const ACDB_date_format_type aDateFormat) {
 //----------------------------------------------------------------
 void SettingsManager::SetDistanceUnit(const ACDB_unit_type aDistanceUnit) {
   mDistanceUnit = aDistanceUnit;
+  mEpoch.fetch_add(1, std::memory_order_release);
 }  // end of SetDistanceUnit
 
 //----------------------------------------------------------------
@@ -147,6 +163,7 @@ void SettingsManager::SetDistanceUnit(const ACDB_unit_type aDistanceUnit) {
 //----------------------------------------------------------------
 void SettingsManager::SetVolumeUnit(const ACDB_unit_type aVolumeUnit) {
   mVolumeUnit = aVolumeUnit;
+  mEpoch.fetch_add(1, std::memory_order_release);
 }  // end of SetVolumeUnit
 
 #if (acdb_CLOUD_CLIENT_SUPPORT)
@@ -41,6 +41,14 @@ static const std::map<JournalMode, std::string> JournalModeStrs{{JournalMode::De
 static const std::map<LockingMode, std::string> LockingModeStrs{
     {LockingMode::Normal, "normal"}, {LockingMode::Exclusive, "exclusive"}};
 
+static const std::map<Synchronous, std::string> SynchronousStrs{
+    {Synchronous::Off, "off"}, {Synchronous::Normal, "normal"}, {Synchronous::Full, "full"}};
+
+static const std::map<TempStore, std::string> TempStoreStrs{
+    {TempStore::Default, "default"}, {TempStore::File, "file"}, {TempStore::Memory, "memory"}};
+
+static bool ExecPragma(SQLite::Database& aDatabase, const std::string& aSql);
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -143,6 +151,37 @@ bool FlushWalFile(SQLite::Database& aDatabase) {
   return success;
 }  // end of FlushWalFile
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the text of column aIndex of the current row of
+//!           aStatement without copying it, e.g. to parse it
+//!           before the next step.  NULL reads as empty text.
+//!
+//----------------------------------------------------------------
+ColumnText GetColumnText(SQLite::Statement& aStatement, const int aIndex) {
+  const SQLite::Column column = aStatement.getColumn(aIndex);
+
+  // Text before its size, as sqlite3_column_bytes() must follow any text conversion.
+  ColumnText text;
+  text.mData = column.getText();
+  text.mSize = static_cast<size_t>(column.getBytes());
+
+  return text;
+}  // end of GetColumnText
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Check whether the main database of the connection
+//!          is read-only, e.g. a database shared between
+//!          chartplotters.
+//!
+//----------------------------------------------------------------
+bool IsReadOnly(SQLite::Database& aDatabase) {
+  return sqlite3_db_readonly(aDatabase.getHandle(), "main") != 0;
+}  // end of IsReadOnly
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -184,6 +223,54 @@ std::unique_ptr<SQLite::Database> OpenDatabaseFileExt(const std::string& aPath,
   return result;
 }  // end of OpenDatabaseFileExt
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Refresh the query planner statistics that need it,
+//!           reading at most about aAnalysisLimit rows per index
+//!           (https://www.sqlite.org/pragma.html#pragma_optimize)
+//!
+//----------------------------------------------------------------
+bool Optimize(SQLite::Database& aDatabase, const int aAnalysisLimit) {
+  // 0x02 analyzes the tables that need it.  0x10000 checks every table, not only those this
+  // connection queried; it exists from SQLite 3.46, and older versions ignore it.
+  const std::string AnalysisLimitSql{"PRAGMA analysis_limit = " +
+                                     std::to_string(aAnalysisLimit) + ";"};
+
+  return ExecPragma(aDatabase, AnalysisLimitSql) &&
+         ExecPragma(aDatabase, "PRAGMA optimize = 0x10002;");
+}  // end of Optimize
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Reset a statement whose step failed, for example
+//!           because the read was interrupted, so that it can be
+//!           bound and run again.
+//!
+//----------------------------------------------------------------
+void ResetStatement(SQLite::Statement& aStatement) {
+  try {
+    aStatement.reset();
+  } catch (const SQLite::Exception& e) {
+    // sqlite3_reset repeats the error of the failed step, but the
+    // statement is reset all the same.
+    DBG_D("Reset after SQLite error: %i %s", e.getErrorCode(), e.getErrorStr());
+  }
+}  // end of ResetStatement
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Set cache size PRAGMA, in KiB
+//!           (https://www.sqlite.org/pragma.html#pragma_cache_size)
+//!
+//----------------------------------------------------------------
+bool SetCacheSize(SQLite::Database& aDatabase, const int aCacheSizeKib) {
+  // A negative size is in KiB rather than in pages.
+  return ExecPragma(aDatabase, "PRAGMA cache_size = -" + std::to_string(aCacheSizeKib) + ";");
+}  // end of SetCacheSize
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -237,5 +324,90 @@ bool SetLockingMode(SQLite::Database& aDatabase, const LockingMode aLockingMode)
   }
 }  // end of SetLockingMode
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Set mmap size PRAGMA, in bytes; 0 disables mmap
+//!           (https://www.sqlite.org/pragma.html#pragma_mmap_size)
+//!
+//----------------------------------------------------------------
+bool SetMmapSize(SQLite::Database& aDatabase, const int64_t aMmapSize) {
+  return ExecPragma(aDatabase, "PRAGMA mmap_size = " + std::to_string(aMmapSize) + ";");
+}  // end of SetMmapSize
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Set page size PRAGMA.  Only takes effect on a
+//!           database without any content yet.
+//!           (https://www.sqlite.org/pragma.html#pragma_page_size)
+//!
+//----------------------------------------------------------------
+bool SetPageSize(SQLite::Database& aDatabase, const int aPageSize) {
+  return ExecPragma(aDatabase, "PRAGMA page_size = " + std::to_string(aPageSize) + ";");
+}  // end of SetPageSize
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Set synchronous PRAGMA
+//!           (https://www.sqlite.org/pragma.html#pragma_synchronous)
+//!
+//----------------------------------------------------------------
+bool SetSynchronous(SQLite::Database& aDatabase, const Synchronous aSynchronous) {
+  auto it = SynchronousStrs.find(aSynchronous);
+  if (it == SynchronousStrs.end()) {
+    DBG_ASSERT_ALWAYS("Invalid synchronous mode");
+    return false;
+  }
+
+  return ExecPragma(aDatabase, "PRAGMA synchronous = " + it->second + ";");
+}  // end of SetSynchronous
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Set temp store PRAGMA
+//!           (https://www.sqlite.org/pragma.html#pragma_temp_store)
+//!
+//----------------------------------------------------------------
+bool SetTempStore(SQLite::Database& aDatabase, const TempStore aTempStore) {
+  auto it = TempStoreStrs.find(aTempStore);
+  if (it == TempStoreStrs.end()) {
+    DBG_ASSERT_ALWAYS("Invalid temp store");
+    return false;
+  }
+
+  return ExecPragma(aDatabase, "PRAGMA temp_store = " + it->second + ";");
+}  // end of SetTempStore
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Set WAL auto-checkpoint PRAGMA, in pages; 0
+//!           disables automatic checkpoints
+//!           (https://www.sqlite.org/pragma.html#pragma_wal_autocheckpoint)
+//!
+//----------------------------------------------------------------
+bool SetWalAutoCheckpoint(SQLite::Database& aDatabase, const int aPages) {
+  return ExecPragma(aDatabase, "PRAGMA wal_autocheckpoint = " + std::to_string(aPages) + ";");
+}  // end of SetWalAutoCheckpoint
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Run a PRAGMA setting.
+//!
+//----------------------------------------------------------------
+static bool ExecPragma(SQLite::Database& aDatabase, const std::string& aSql) {
+  try {
+    aDatabase.exec(aSql);
+    return true;
+  } catch (const SQLite::Exception& e) {
+    DBG_W("SQLite Exception: %i %s", e.getErrorCode(), e.getErrorStr());
+    return false;
+  }
+}  // end of ExecPragma
+
 }  // end of namespace SqliteCppUtil
 }  // end of namespace Acdb
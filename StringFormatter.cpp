@@ -25,19 +25,124 @@ limitations under the License.
 #define DBG_TAG "StringFormatter"
 
 #include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
 #include "DBG_pub.h"
 #include "Acdb/SettingsManager.hpp"
 #include "Acdb/StringFormatter.hpp"
-#include "Acdb/StringUtil.hpp"
 #include "Acdb/TextHandle.hpp"
 #include "Acdb/TextTranslator.hpp"
 #include "NavDateTimeExtensions.hpp"
 #include "UTL_pub_lib_cnvt.h"
 
-#define DATE_TIME_STR_MAX_LEN 64
 static const char* DEGREE_SYMBOL = "\xC2\xB0";
 
 namespace Acdb {
+//! Settings and translated strings used while formatting.  Cached per
+//! thread and rebuilt when the settings or the language change.  The
+//! strings point into the StringPool, not into a translator table.
+struct FormatSettings {
+  bool mValid;
+  uint32_t mSettingsEpoch;
+  uint32_t mTranslatorGeneration;
+  ACDB_coord_format_type mCoordFormat;
+  ACDB_date_format_type mDateFormat;
+  const std::string* mNorth;
+  const std::string* mSouth;
+  const std::string* mEast;
+  const std::string* mWest;
+  const std::string* mDepthUnit;
+  double mDepthScale;  //!< multiplier from meters to the depth unit
+  const std::string* mMonths[TIME_MONTHS_PER_YEAR];
+};  // end of struct FormatSettings
+
+//! Appends text to a caller-provided buffer, tracking overflow.
+class FormatBuffer {
+ public:
+  FormatBuffer(char* aBuffer, const size_t aBufferSize)
+      : mBuffer(aBuffer), mBufferSize(aBufferSize), mLength(0), mOverflow(aBufferSize == 0) {
+    if (!mOverflow) {
+      mBuffer[0] = '\0';
+    }
+  }
+
+  void Append(const char* aStr, const size_t aLength) {
+    if (mOverflow || mLength + aLength >= mBufferSize) {
+      mOverflow = true;
+      return;
+    }
+
+    memcpy(mBuffer + mLength, aStr, aLength);
+    mLength += aLength;
+    mBuffer[mLength] = '\0';
+  }
+
+  void Append(const std::string& aStr) { Append(aStr.data(), aStr.size()); }
+
+  void Append(const char* aStr) { Append(aStr, strlen(aStr)); }
+
+  void AppendFormat(const char* aFormat, ...) {
+    if (mOverflow) {
+      return;
+    }
+
+    va_list args;
+    va_start(args, aFormat);
+    int written = vsnprintf(mBuffer + mLength, mBufferSize - mLength, aFormat, args);
+    va_end(args);
+
+    if (written < 0 || mLength + static_cast<size_t>(written) >= mBufferSize) {
+      mOverflow = true;
+      mBuffer[mLength] = '\0';
+    } else {
+      mLength += static_cast<size_t>(written);
+    }
+  }
+
+  void AppendNumber(unsigned int aValue, const int aMinDigits) {
+    char digits[16];
+    int count = 0;
+    do {
+      digits[count++] = static_cast<char>('0' + aValue % 10);
+      aValue /= 10;
+    } while (aValue != 0 || count < aMinDigits);
+
+    char reversed[16];
+    for (int i = 0; i < count; i++) {
+      reversed[i] = digits[count - 1 - i];
+    }
+
+    Append(reversed, static_cast<size_t>(count));
+  }
+
+  //! @return length written, or 0 (with an empty buffer) on overflow
+  size_t Finish() {
+    if (mOverflow) {
+      if (mBufferSize > 0) {
+        mBuffer[0] = '\0';
+      }
+      return 0;
+    }
+
+    return mLength;
+  }
+
+ private:
+  char* mBuffer;
+  size_t mBufferSize;
+  size_t mLength;
+  bool mOverflow;
+};  // end of class FormatBuffer
+
+static void AppendDate(FormatBuffer& aBuffer, const CivilDateTime& aDateTime);
+
+static void AppendDegreesMinutes(FormatBuffer& aBuffer, const double aDegrees);
+
+static void AppendDegreesMinutesSeconds(FormatBuffer& aBuffer, const double aDegrees);
+
+static const FormatSettings& GetFormatSettings();
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -54,35 +159,56 @@ StringFormatter::StringFormatter() {}  // end of StringFormatter
 //!
 //----------------------------------------------------------------
 std::string StringFormatter::FormatPosition(const scposn_type& aPosition) const {
-  std::string result;
+  char buffer[MaxFormattedLength];
+  size_t length = FormatPosition(aPosition, buffer, sizeof(buffer));
+
+  return std::string(buffer, length);
+}  // end of FormatPosition
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief print a position into a caller-provided buffer
+//!   @return length written, 0 if the buffer is too small
+//!
+//----------------------------------------------------------------
+size_t StringFormatter::FormatPosition(const scposn_type& aPosition, char* aBuffer,
+                                       const size_t aBufferSize) const {
+  const FormatSettings& settings = GetFormatSettings();
+  FormatBuffer result(aBuffer, aBufferSize);
 
   double latitude = aPosition.lat * UTL_SEMI_TO_DEG;
   double longitude = aPosition.lon * UTL_SEMI_TO_DEG;
 
-  std::string latDir = TextTranslator::GetInstance().Find(
-      static_cast<int>(latitude >= 0.0f ? TextHandle::NorthAbbr : TextHandle::SouthAbbr));
-  std::string lonDir = TextTranslator::GetInstance().Find(
-      static_cast<int>(longitude >= 0.0f ? TextHandle::EastAbbr : TextHandle::WestAbbr));
+  const std::string& latDir = *(latitude >= 0.0f ? settings.mNorth : settings.mSouth);
+  const std::string& lonDir = *(longitude >= 0.0f ? settings.mEast : settings.mWest);
 
-  switch (SettingsManager::GetInstance().GetCoordinateFormat()) {
+  switch (settings.mCoordFormat) {
     case ACDB_COORD_DEG_MIN:
-      result =
-          String::Format("%s%s, %s%s", GetDegreesMinutesString(latitude).c_str(), latDir.c_str(),
-                         GetDegreesMinutesString(longitude).c_str(), lonDir.c_str());
+      AppendDegreesMinutes(result, latitude);
+      result.Append(latDir);
+      result.Append(", ", 2);
+      AppendDegreesMinutes(result, longitude);
+      result.Append(lonDir);
       break;
     case ACDB_COORD_DEG_MIN_SEC:
-      result = String::Format("%s%s, %s%s", GetDegreesMinutesSecondsString(latitude).c_str(),
-                              latDir.c_str(), GetDegreesMinutesSecondsString(longitude).c_str(),
-                              lonDir.c_str());
+      AppendDegreesMinutesSeconds(result, latitude);
+      result.Append(latDir);
+      result.Append(", ", 2);
+      AppendDegreesMinutesSeconds(result, longitude);
+      result.Append(lonDir);
       break;
     case ACDB_COORD_DEC_DEG:
     default:
-      result = String::Format("%0.4f%s%s, %0.4f%s%s", std::abs(latitude), DEGREE_SYMBOL,
-                              latDir.c_str(), std::abs(longitude), DEGREE_SYMBOL, lonDir.c_str());
+      result.AppendFormat("%0.4f%s", std::abs(latitude), DEGREE_SYMBOL);
+      result.Append(latDir);
+      result.Append(", ", 2);
+      result.AppendFormat("%0.4f%s", std::abs(longitude), DEGREE_SYMBOL);
+      result.Append(lonDir);
       break;
   }
 
-  return result;
+  return result.Finish();
 }  // end of FormatPosition
 
 //----------------------------------------------------------------
@@ -93,25 +219,34 @@ std::string StringFormatter::FormatPosition(const scposn_type& aPosition) const
 //!
 //----------------------------------------------------------------
 std::string StringFormatter::FormatDepthValue(const double aMeters) const {
+  char buffer[MaxFormattedLength];
+  size_t length = FormatDepthValue(aMeters, buffer, sizeof(buffer));
+
+  return std::string(buffer, length);
+}  // end of FormatDepthValue
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief print a depth into a caller-provided buffer
+//!   @return length written, 0 if the depth is negative or the
+//!           buffer is too small
+//!
+//----------------------------------------------------------------
+size_t StringFormatter::FormatDepthValue(const double aMeters, char* aBuffer,
+                                         const size_t aBufferSize) const {
+  FormatBuffer result(aBuffer, aBufferSize);
+
   if (aMeters < 0) {
-    return std::string{};
+    return result.Finish();
   }
 
-  double value;
-  std::string unitString;
+  const FormatSettings& settings = GetFormatSettings();
 
-  switch (SettingsManager::GetInstance().GetDistanceUnit()) {
-    case ACDB_FEET:
-      value = aMeters * UTL_MT_TO_FT;
-      unitString = TextTranslator::GetInstance().Find(static_cast<int>(TextHandle::FeetUnit));
-      break;
-    case ACDB_METER:
-    default:
-      value = aMeters;
-      unitString = TextTranslator::GetInstance().Find(static_cast<int>(TextHandle::MetersUnit));
-  }
+  result.AppendFormat("%.2f ", aMeters * settings.mDepthScale);
+  result.Append(*settings.mDepthUnit);
 
-  return String::Format("%.2f %s", value, unitString.c_str());
+  return result.Finish();
 }  // end of FormatDepthValue
 
 //----------------------------------------------------------------
@@ -122,8 +257,29 @@ std::string StringFormatter::FormatDepthValue(const double aMeters) const {
 //!
 //----------------------------------------------------------------
 std::string StringFormatter::FormatDate(const uint64_t aUnixTimestamp) const {
-  return GetDateString(
-      NavDateTimeExtensions::EpochToNavDateTime(Acdb::EpochType::UNIX_EPOCH, aUnixTimestamp));
+  char buffer[MaxFormattedLength];
+  size_t length = FormatDate(aUnixTimestamp, buffer, sizeof(buffer));
+
+  return std::string(buffer, length);
+}  // end of FormatDate
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief print a date into a caller-provided buffer
+//!   @return length written, 0 if the buffer is too small
+//!
+//----------------------------------------------------------------
+size_t StringFormatter::FormatDate(const uint64_t aUnixTimestamp, char* aBuffer,
+                                   const size_t aBufferSize) const {
+  CivilDateTime dateTime;
+  NavDateTimeExtensions::EpochToCivilDateTime(Acdb::EpochType::UNIX_EPOCH, aUnixTimestamp,
+                                              dateTime);
+
+  FormatBuffer result(aBuffer, aBufferSize);
+  AppendDate(result, dateTime);
+
+  return result.Finish();
 }  // end of FormatDate
 
 //----------------------------------------------------------------
@@ -135,26 +291,58 @@ std::string StringFormatter::FormatDate(const uint64_t aUnixTimestamp) const {
 //!
 //----------------------------------------------------------------
 std::string StringFormatter::FormatDate(const std::string& aIso8601DateTimeStr) const {
-  std::string result;
+  char buffer[MaxFormattedLength];
+  size_t length = FormatDate(aIso8601DateTimeStr.c_str(), aIso8601DateTimeStr.size(), buffer,
+                             sizeof(buffer));
+
+  return std::string(buffer, length);
+}  // end of FormatDate
 
-  NavDateTime navDateTime;
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief print a date and time into a caller-provided buffer
+//!   @detail The API's fixed ISO 8601 layouts are parsed directly;
+//!           anything else goes through NavDateTime as before.
+//!   @return length written, 0 if the string could not be parsed
+//!           or the buffer is too small
+//!
+//----------------------------------------------------------------
+size_t StringFormatter::FormatDate(const char* aIso8601DateTimeStr, const size_t aLength,
+                                   char* aBuffer, const size_t aBufferSize) const {
+  FormatBuffer result(aBuffer, aBufferSize);
 
-  bool success = navDateTime.FromString(aIso8601DateTimeStr, YYYYMMDDTHHMMSSZ_FORMAT);
+  CivilDateTime dateTime;
+  bool success = NavDateTimeExtensions::ParseIso8601(aIso8601DateTimeStr, aLength, dateTime);
 
   if (!success) {
-    // Fallback -- try to convert with milliseconds.
-    success = navDateTime.FromString(aIso8601DateTimeStr, YYYYMMDDTHHMMSSMMMZ_FORMAT);
+    std::string dateTimeStr(aIso8601DateTimeStr, aLength);
+    NavDateTime navDateTime;
+
+    success = navDateTime.FromString(dateTimeStr, YYYYMMDDTHHMMSSZ_FORMAT);
+
+    if (!success) {
+      // Fallback -- try to convert with milliseconds.
+      success = navDateTime.FromString(dateTimeStr, YYYYMMDDTHHMMSSMMMZ_FORMAT);
+    }
+
+    if (success) {
+      navDateTime.GetDate(dateTime.mDay, dateTime.mMonth, dateTime.mYear);
+    }
   }
 
   if (success) {
-    result = GetDateString(navDateTime);
+    AppendDate(result, dateTime);
   }
 
-  if (result.empty()) {
-    DBG_E("Failed to convert date/time from ISO8601 string -- %s", aIso8601DateTimeStr.c_str());
+  size_t length = result.Finish();
+
+  if (length == 0) {
+    DBG_E("Failed to convert date/time from ISO8601 string -- %.*s", static_cast<int>(aLength),
+          aIso8601DateTimeStr);
   }
 
-  return result;
+  return length;
 }  // end of FormatDate
 
 //----------------------------------------------------------------
@@ -174,62 +362,58 @@ std::string StringFormatter::FormatDate(const std::string& aIso8601DateTimeStr)
 //----------------------------------------------------------------
 //!
 //!   @private
-//!   @detail Convert NavDateTime to date string
+//!   @detail Append date in the user's chosen date format
 //!
 //----------------------------------------------------------------
-std::string StringFormatter::GetDateString(const Navionics::NavDateTime& aNavDateTime) const {
-  DateStringType dateStringType;
-  DateDelimiterToken delimiter;
-
-  std::string result;
-
-  switch (SettingsManager::GetInstance().GetDateFormat()) {
-    case ACDB_DATE_MONTH_ABBR: {
-      unsigned int month;
-      unsigned int day;
-      unsigned int year;
-      aNavDateTime.GetDate(day, month, year);
-
-      std::string monthStr =
-          TextTranslator::GetInstance().Find(static_cast<int>(TextHandle::MonthJan) + month - 1);
-
-      result = String::Format("%u-%s-%u", day, monthStr.c_str(), year);
-      break;
-    }
+static void AppendDate(FormatBuffer& aBuffer, const CivilDateTime& aDateTime) {
+  const FormatSettings& settings = GetFormatSettings();
+
+  char delimiter;
+  bool monthFirst;
+
+  switch (settings.mDateFormat) {
+    case ACDB_DATE_MONTH_ABBR:
+      aBuffer.AppendNumber(aDateTime.mDay, 1);
+      aBuffer.Append("-", 1);
+      aBuffer.Append(*settings.mMonths[aDateTime.mMonth - 1]);
+      aBuffer.Append("-", 1);
+      aBuffer.AppendNumber(aDateTime.mYear, 1);
+      return;
     case ACDB_DATE_MDY_SLASH:
-      dateStringType = DateStringType::MMDDYYYY_FORMAT;
+      monthFirst = true;
       delimiter = DateDelimiterToken::DATE_DELIMITER_SLASH;
       break;
     case ACDB_DATE_DMY_SLASH:
-      dateStringType = DateStringType::DDMMYYYY_FORMAT;
+      monthFirst = false;
       delimiter = DateDelimiterToken::DATE_DELIMITER_SLASH;
       break;
     case ACDB_DATE_MDY_DASH:
-      dateStringType = DateStringType::MMDDYYYY_FORMAT;
+      monthFirst = true;
       delimiter = DateDelimiterToken::DATE_DELIMITER_DASH;
       break;
     case ACDB_DATE_DMY_DASH:
     default:
-      dateStringType = DateStringType::DDMMYYYY_FORMAT;
+      monthFirst = false;
       delimiter = DateDelimiterToken::DATE_DELIMITER_DASH;
       break;
   }
 
-  if (result.empty()) {
-    aNavDateTime.ToString(result, dateStringType, delimiter);
-  }
-
-  return result;
-}  // end of GetDateString
+  // Same layout as NavDateTime::ToString with MMDDYYYY_FORMAT / DDMMYYYY_FORMAT.
+  aBuffer.AppendNumber(monthFirst ? aDateTime.mMonth : aDateTime.mDay, 2);
+  aBuffer.Append(&delimiter, 1);
+  aBuffer.AppendNumber(monthFirst ? aDateTime.mDay : aDateTime.mMonth, 2);
+  aBuffer.Append(&delimiter, 1);
+  aBuffer.AppendNumber(aDateTime.mYear, 4);
+}  // end of AppendDate
 
 //----------------------------------------------------------------
 //!
 //!   @private
-//!   @detail Convert decimal degrees to degrees/minutes string
+//!   @detail Append decimal degrees as degrees/minutes
 //!
 //----------------------------------------------------------------
-std::string StringFormatter::GetDegreesMinutesString(const double aDegrees) const {
-  double absDegrees = abs(aDegrees);
+static void AppendDegreesMinutes(FormatBuffer& aBuffer, const double aDegrees) {
+  double absDegrees = std::abs(aDegrees);
 
   uint32_t degrees = static_cast<uint32_t>(absDegrees);
   double minutes = (absDegrees - degrees) * 60;
@@ -241,17 +425,17 @@ std::string StringFormatter::GetDegreesMinutesString(const double aDegrees) cons
   }
 
   // If updating minutes precision, must make a corresponding change in the rounding check above.
-  return String::Format("%02i%s%06.3f'", degrees, DEGREE_SYMBOL, minutes);
-}  // end of GetDegreesMinutesString
+  aBuffer.AppendFormat("%02i%s%06.3f'", degrees, DEGREE_SYMBOL, minutes);
+}  // end of AppendDegreesMinutes
 
 //----------------------------------------------------------------
 //!
 //!   @private
-//!   @detail Convert decimal degrees to degrees/minutes/seconds string
+//!   @detail Append decimal degrees as degrees/minutes/seconds
 //!
 //----------------------------------------------------------------
-std::string StringFormatter::GetDegreesMinutesSecondsString(const double aDegrees) const {
-  double absDegrees = abs(aDegrees);
+static void AppendDegreesMinutesSeconds(FormatBuffer& aBuffer, const double aDegrees) {
+  double absDegrees = std::abs(aDegrees);
 
   uint32_t degrees = static_cast<uint32_t>(absDegrees);
   uint32_t minutes = static_cast<uint32_t>((absDegrees - degrees) * 60);
@@ -270,7 +454,64 @@ std::string StringFormatter::GetDegreesMinutesSecondsString(const double aDegree
 
   // If updating the seconds precision, must make a corresponding change to the rounding check
   // above.
-  return String::Format("%02i%s%02i'%04.1f\"", degrees, DEGREE_SYMBOL, minutes, seconds);
-}  // end of GetDegreesMinutesSecondsString
+  aBuffer.AppendFormat("%02i%s%02i'%04.1f\"", degrees, DEGREE_SYMBOL, minutes, seconds);
+}  // end of AppendDegreesMinutesSeconds
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get this thread's formatting settings, refreshing
+//!           them if the settings or language have changed since
+//!           they were last read.  Lookup returns strings interned
+//!           in the StringPool, which outlive the translator table
+//!           they came from, so the cached pointers never dangle;
+//!           the generation only tells when they are out of date.
+//!
+//----------------------------------------------------------------
+static const FormatSettings& GetFormatSettings() {
+  static thread_local FormatSettings sSettings = {};
+
+  const SettingsManager& settingsManager = SettingsManager::GetInstance();
+  const TextTranslator& translator = TextTranslator::GetInstance();
+
+  uint32_t settingsEpoch = settingsManager.GetEpoch();
+  uint32_t translatorGeneration = translator.GetGeneration();
+
+  if (sSettings.mValid && sSettings.mSettingsEpoch == settingsEpoch &&
+      sSettings.mTranslatorGeneration == translatorGeneration) {
+    return sSettings;
+  }
+
+  sSettings.mSettingsEpoch = settingsEpoch;
+  sSettings.mTranslatorGeneration = translatorGeneration;
+  sSettings.mCoordFormat = settingsManager.GetCoordinateFormat();
+  sSettings.mDateFormat = settingsManager.GetDateFormat();
+
+  sSettings.mNorth = &translator.Lookup(static_cast<int>(TextHandle::NorthAbbr));
+  sSettings.mSouth = &translator.Lookup(static_cast<int>(TextHandle::SouthAbbr));
+  sSettings.mEast = &translator.Lookup(static_cast<int>(TextHandle::EastAbbr));
+  sSettings.mWest = &translator.Lookup(static_cast<int>(TextHandle::WestAbbr));
+
+  switch (settingsManager.GetDistanceUnit()) {
+    case ACDB_FEET:
+      sSettings.mDepthScale = UTL_MT_TO_FT;
+      sSettings.mDepthUnit = &translator.Lookup(static_cast<int>(TextHandle::FeetUnit));
+      break;
+    case ACDB_METER:
+    default:
+      sSettings.mDepthScale = 1.0;
+      sSettings.mDepthUnit = &translator.Lookup(static_cast<int>(TextHandle::MetersUnit));
+      break;
+  }
+
+  for (int month = 0; month < TIME_MONTHS_PER_YEAR; month++) {
+    sSettings.mMonths[month] =
+        &translator.Lookup(static_cast<int>(TextHandle::MonthJan) + month);
+  }
+
+  sSettings.mValid = true;
+
+  return sSettings;
+}  // end of GetFormatSettings
 
 }  // end of namespace Acdb
@@ -0,0 +1,90 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+
+/**
+    @file
+    Pool of interned strings shared by the objects built from the
+    database.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#include "Acdb/StringPool.hpp"
+
+namespace Acdb {
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create an empty pool.
+//!
+//----------------------------------------------------------------
+StringPool::StringPool() : mBytes{0} {}  // end of StringPool
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the total length of the strings interned so far.
+//!
+//----------------------------------------------------------------
+size_t StringPool::GetBytes() const {
+  std::lock_guard<std::mutex> lock{mMutex};
+  return mBytes;
+}  // end of GetBytes
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the number of distinct strings interned so far.
+//!
+//----------------------------------------------------------------
+size_t StringPool::GetCount() const {
+  std::lock_guard<std::mutex> lock{mMutex};
+  return mStrings.size();
+}  // end of GetCount
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the pool shared by the whole library.
+//!
+//----------------------------------------------------------------
+/*static*/ StringPool& StringPool::GetInstance() {
+  static StringPool instance;
+  return instance;
+}  // end of GetInstance
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Get the pooled copy of aValue, adding it on first use.
+//!   Elements of an unordered_set keep their address when it
+//!   rehashes, so the reference stays valid.
+//!
+//----------------------------------------------------------------
+const std::string& StringPool::Intern(const std::string& aValue) {
+  std::lock_guard<std::mutex> lock{mMutex};
+
+  auto result = mStrings.insert(aValue);
+  if (result.second) {
+    mBytes += aValue.size();
+  }
+
+  return *result.first;
+}  // end of Intern
+
+}  // end of namespace Acdb
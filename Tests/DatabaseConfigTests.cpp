@@ -0,0 +1,120 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for the DatabaseConfig tuning presets
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "DatabaseConfigTests"
+
+#include <cstdint>
+#include <string>
+
+#include "Acdb/DatabaseConfig.hpp"
+#include "Acdb/FileUtil.hpp"
+#include "Acdb/SqliteCppUtil.hpp"
+#include "DBG_pub.h"
+#include "SQLiteCpp/Database.h"
+#include "SQLiteCpp/Statement.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+static const std::string DatabasePath{"DatabaseConfigTests.db"};
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Read the value of a PRAGMA, or -1 if it has none.
+//!
+//----------------------------------------------------------------
+static int64_t GetPragma(SQLite::Database& aDatabase, const std::string& aPragma) {
+  SQLite::Statement statement{aDatabase, "PRAGMA " + aPragma + ";"};
+  return statement.executeStep() ? statement.getColumn(0).getInt64() : -1;
+}  // end of GetPragma
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Apply a preset to a new WAL database the way
+//!   Repository::ReadyDbAccess does, and check that every
+//!   setting reads back.
+//!
+//----------------------------------------------------------------
+static void CheckPreset(TF_state_type* aState, const DatabaseConfig::TuningPreset aPreset) {
+  const DatabaseConfig::Tuning tuning = DatabaseConfig::GetTuning(aPreset);
+
+  FileUtil::Delete(DatabasePath);
+  {
+    SQLite::Database database{DatabasePath, SQLite::OPEN_READWRITE | SQLite::OPEN_CREATE};
+
+    TF_assert(aState,
+              SqliteCppUtil::SetLockingMode(database, SqliteCppUtil::LockingMode::Exclusive));
+    TF_assert(aState, SqliteCppUtil::SetPageSize(database, tuning.mPageSize));
+    TF_assert(aState, SqliteCppUtil::SetJournalMode(database, SqliteCppUtil::JournalMode::Wal));
+    TF_assert(aState, SqliteCppUtil::SetMmapSize(database, tuning.mMmapSize));
+    TF_assert(aState, SqliteCppUtil::SetCacheSize(database, tuning.mCacheSizeKib));
+    TF_assert(aState, SqliteCppUtil::SetTempStore(database, tuning.mTempStore));
+    TF_assert(aState, SqliteCppUtil::SetSynchronous(database, tuning.mWalSynchronous));
+    TF_assert(aState, SqliteCppUtil::SetWalAutoCheckpoint(database, tuning.mWalAutoCheckpoint));
+
+    // Without mmap support the pragma has no value.
+    const int64_t mmapSize = GetPragma(database, "mmap_size");
+    if (mmapSize != -1) {
+      TF_assert_msg(aState, mmapSize == tuning.mMmapSize, "mmap_size");
+    }
+
+    // A negative cache size is in KiB.
+    TF_assert_msg(aState, GetPragma(database, "cache_size") == -tuning.mCacheSizeKib,
+                  "cache_size");
+
+    // The enumerators follow the numbering of SQLite.
+    TF_assert_msg(aState,
+                  GetPragma(database, "temp_store") == static_cast<int>(tuning.mTempStore),
+                  "temp_store");
+    TF_assert_msg(aState,
+                  GetPragma(database, "synchronous") == static_cast<int>(tuning.mWalSynchronous),
+                  "synchronous");
+    TF_assert_msg(aState, GetPragma(database, "wal_autocheckpoint") == tuning.mWalAutoCheckpoint,
+                  "wal_autocheckpoint");
+    TF_assert_msg(aState, GetPragma(database, "page_size") == tuning.mPageSize, "page_size");
+  }
+  FileUtil::Delete(DatabasePath);
+  FileUtil::Delete(DatabasePath + "-wal");
+  FileUtil::Delete(DatabasePath + "-shm");
+}  // end of CheckPreset
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that the settings of each tuning preset read back
+//!         through PRAGMA once applied.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.databaseconfig.tuning_presets") {
+  CheckPreset(state, DatabaseConfig::TuningPreset::LowMemory);
+  CheckPreset(state, DatabaseConfig::TuningPreset::Phone);
+  CheckPreset(state, DatabaseConfig::TuningPreset::Desktop);
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
@@ -49,6 +49,7 @@ limitations under the License.
 #include "Acdb/Queries/TilesQuery.hpp"
 #include "Acdb/Queries/TranslatorQuery.hpp"
 #include "Acdb/Queries/VersionQuery.hpp"
+#include "Acdb/MapMarkerColumns.hpp"
 #include "Acdb/MapMarkerFilter.hpp"
 #include "Acdb/PrvTypes.hpp"
 #include "Acdb/Tests/DatabaseUtil.hpp"
@@ -56,6 +57,7 @@ limitations under the License.
 #include "DBG_pub.h"
 #include "TF_pub.h"
 #include "UTL_pub_lib_cnvt.h"
+#include "sqlite3.h"
 
 namespace Acdb {
 namespace Test {
@@ -228,6 +230,49 @@ TF_TEST("acdb.database_business_photo") {
   TF_assert_msg(state, expected == actual, "BusinessPhoto");
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that writing a business photo binds its URL
+//!         without SQLite keeping a copy of it.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.database_business_photo_write_no_copy") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  ACDB_marker_idx_type markerId = 12345;
+  const size_t urlSize = 65536;
+
+  // Grow the page cache with a first write of the same size, so only the binding is measured.
+  BusinessPhotoQuery warmUpQuery{database};
+  TF_assert_msg(state,
+                warmUpQuery.Write(markerId, BusinessPhotoTableDataType(
+                                                markerId, 1, std::string(urlSize, 'a'))),
+                "BusinessPhoto Write");
+
+  BusinessPhotoQuery businessPhotoQuery{database};
+  BusinessPhotoTableDataType businessPhoto{markerId, 1, std::string(urlSize, 'b')};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  const sqlite3_int64 memoryBefore = sqlite3_memory_used();
+  bool success = businessPhotoQuery.Write(markerId, std::move(businessPhoto));
+  const sqlite3_int64 memoryAfter = sqlite3_memory_used();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, success, "BusinessPhoto Write");
+  TF_assert_msg(state, memoryAfter - memoryBefore < static_cast<sqlite3_int64>(urlSize),
+                "BusinessPhoto Write: URL copied, %d bytes kept",
+                static_cast<int>(memoryAfter - memoryBefore));
+}
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -573,7 +618,7 @@ TF_TEST_AUTO_SLOW("acdb.database_marker", 15) {
   expectedFiltered.push_back(markerTableDataList[1]);
   expectedFiltered.push_back(markerTableDataList[2]);
   // 0 and 4 are outside of bbox, 5 is inside bbox but wrong type.
-  std::vector<MarkerTableDataType> actualFiltered;
+  MapMarkerColumns actualFiltered;
 
   bbox_type bbox = {
       {static_cast<int32_t>(35.0 * UTL_DEG_TO_SEMI), static_cast<int32_t>(35.0 * UTL_DEG_TO_SEMI)},
@@ -623,7 +668,22 @@ TF_TEST_AUTO_SLOW("acdb.database_marker", 15) {
   // Assert
   // ----------------------------------------------------------
   TF_assert_msg(state, expected == actual, "Marker");
-  TF_assert_msg(state, expectedFiltered == actualFiltered, "Marker Filtered");
+  TF_assert_msg(state, actualFiltered.Size() == expectedFiltered.size(),
+                "Marker Filtered: expected %d, actual = %d", expectedFiltered.size(),
+                actualFiltered.Size());
+  for (size_t i = 0; i < actualFiltered.Size() && i < expectedFiltered.size(); i++) {
+    const MapMarkerColumns::Row row = actualFiltered[i];
+    TF_assert_msg(state, row.GetId() == expectedFiltered[i].mId, "Marker Filtered %d: ID", i);
+    TF_assert_msg(state, row.GetType() == expectedFiltered[i].mType, "Marker Filtered %d: type", i);
+    TF_assert_msg(state, row.GetLastUpdated() == expectedFiltered[i].mLastUpdated,
+                  "Marker Filtered %d: last updated", i);
+    TF_assert_msg(state, expectedFiltered[i].mName == row.GetName(), "Marker Filtered %d: name",
+                  i);
+    TF_assert_msg(state, row.GetPosition().lat == expectedFiltered[i].mPosn.lat,
+                  "Marker Filtered %d: lat", i);
+    TF_assert_msg(state, row.GetPosition().lon == expectedFiltered[i].mPosn.lon,
+                  "Marker Filtered %d: lon", i);
+  }
   TF_assert_msg(state, expectedLastUpdate == actualLastUpdate, "Marker last update");
   TF_assert_msg(state, expectedIds == actualIds, "Marker get IDs");
 }
@@ -37,6 +37,7 @@ limitations under the License.
 #include "Acdb/Queries/MarkerQuery.hpp"
 #include "Acdb/Queries/MarkerMetaQuery.hpp"
 #include "Acdb/Queries/MooringsQuery.hpp"
+#include "Acdb/Queries/MustacheTemplateQuery.hpp"
 #include "Acdb/Queries/NavigationQuery.hpp"
 #include "Acdb/Queries/PositionQuery.hpp"
 #include "Acdb/Queries/RetailQuery.hpp"
@@ -44,6 +45,8 @@ limitations under the License.
 #include "Acdb/Queries/ReviewPhotoQuery.hpp"
 #include "Acdb/Queries/ServicesQuery.hpp"
 #include "Acdb/Queries/TranslatorQuery.hpp"
+#include "Acdb/Queries/VersionQuery.hpp"
+#include "Acdb/FileUtil.hpp"
 #include "Acdb/SearchMarkerFilter.hpp"
 #include "Acdb/Tests/DatabaseUtil.hpp"
 #include "Acdb/TextHandle.hpp"
@@ -71,6 +74,28 @@ SQLite::Database CreateDatabase(TF_state_type* aState) {
   return result;
 }  // end of CreateDatabase
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Create an empty database file at aPath, replacing
+//!         any file already there.  The version is set to the
+//!         supported schema so a Repository can open it.
+//!
+//----------------------------------------------------------------
+SQLite::Database CreateDatabase(TF_state_type* aState, const std::string& aPath) {
+  FileUtil::Delete(aPath);
+
+  SQLite::Database result{aPath, SQLite::OPEN_READWRITE | SQLite::OPEN_CREATE |
+                                     SQLite::OPEN_FULLMUTEX};
+  CreateTables(aState, result);
+
+  VersionQuery versionQuery{result};
+  TF_assert(aState, versionQuery.Put(SupportedSchemaVer));
+
+  return result;
+}  // end of CreateDatabase
+
 //----------------------------------------------------------------
 //!
 //!   @private
@@ -715,5 +740,37 @@ void PopulateTranslationsTable(TF_state_type* aState, SQLite::Database& aDatabas
   }
 }  // end of PopulateTranslationsTable
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Add a template for each content view section.  Each
+//!         template names its section and renders a value from
+//!         it, so a test can tell which data reached which view.
+//!
+//----------------------------------------------------------------
+void PopulateMustacheTemplatesTable(TF_state_type* aState, SQLite::Database& aDatabase) {
+  MustacheTemplateQuery mustacheTemplateQuery{aDatabase};
+
+  const std::string sections[]{"Address", "Amenities", "Business",   "Contact",
+                               "Dockage", "Fuel",      "Moorings",   "Navigation",
+                               "Retail",  "Services"};
+
+  for (const std::string& section : sections) {
+    std::string name = "GML_" + section + "Section";
+    std::string sectionTemplate = "[" + section + "]{{#" + section + "Section}}" + section +
+                                  "{{/" + section + "Section}}";
+    TF_assert(aState, mustacheTemplateQuery.Write(MustacheTemplateTableDataType{
+                          std::move(name), std::move(sectionTemplate)}));
+  }
+
+  TF_assert(aState, mustacheTemplateQuery.Write(MustacheTemplateTableDataType{
+                        "GML_PointOfInterestSection",
+                        "[PointOfInterest]{{#PointOfInterestSection}}{{Name}}"
+                        "{{/PointOfInterestSection}}"}));
+  TF_assert(aState, mustacheTemplateQuery.Write(MustacheTemplateTableDataType{
+                        "GML_ReviewsSection", "[Reviews]{{#ReviewList}}Reviews{{/ReviewList}}"}));
+}  // end of PopulateMustacheTemplatesTable
+
 }  // end of namespace Test
 }  // end of namespace Acdb
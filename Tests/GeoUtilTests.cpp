@@ -0,0 +1,141 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for the GeoUtil functions
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "GeoUtilTests"
+
+#include <cstdlib>
+
+#include "Acdb/GeoUtil.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+//! 90 degrees, in semicircles
+static const int32_t QuarterTurn = 0x40000000;
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test Geo::GetIntermediatePoint() between two distinct
+//!         points on the equator.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.geoutil.intermediate_point") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  const scposn_type start{0, 0};
+  const scposn_type end{0, QuarterTurn};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  scposn_type middle = Geo::GetIntermediatePoint(start, end, 0.5);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, middle.lat == 0, "Intermediate point: latitude %d", middle.lat);
+  TF_assert_msg(state, std::abs(middle.lon - QuarterTurn / 2) <= 1,
+                "Intermediate point: longitude %d", middle.lon);
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test Geo::GetIntermediatePoint() when both end points
+//!         are the same position.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.geoutil.intermediate_point_identical") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  const scposn_type position{123456, -654321};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  scposn_type first = Geo::GetIntermediatePoint(position, position, 0.25);
+  scposn_type second = Geo::GetIntermediatePoint(position, position, 0.75);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, first.lat == position.lat, "Intermediate point identical: first lat");
+  TF_assert_msg(state, first.lon == position.lon, "Intermediate point identical: first lon");
+  TF_assert_msg(state, second.lat == position.lat, "Intermediate point identical: second lat");
+  TF_assert_msg(state, second.lon == position.lon, "Intermediate point identical: second lon");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test Geo::GetIntermediatePoint() between antipodal
+//!         points, which are joined through the North pole.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.geoutil.intermediate_point_antipodal") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  const scposn_type start{0, -QuarterTurn};
+  const scposn_type end{0, QuarterTurn};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  scposn_type quarter = Geo::GetIntermediatePoint(start, end, 0.25);
+  scposn_type middle = Geo::GetIntermediatePoint(start, end, 0.5);
+  scposn_type threeQuarters = Geo::GetIntermediatePoint(start, end, 0.75);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  const double quarterDistance = Geo::GetDistanceMeters(start, end) / 4;
+
+  TF_assert_msg(state, quarter.lat > 0, "Intermediate point antipodal: quarter latitude %d",
+                quarter.lat);
+  TF_assert_msg(state, quarter.lon == -QuarterTurn,
+                "Intermediate point antipodal: quarter longitude %d", quarter.lon);
+  TF_assert_msg(state, std::abs(middle.lat - QuarterTurn) <= 1,
+                "Intermediate point antipodal: middle latitude %d", middle.lat);
+  TF_assert_msg(state, threeQuarters.lat > 0,
+                "Intermediate point antipodal: three quarters latitude %d", threeQuarters.lat);
+  TF_assert_msg(state, threeQuarters.lon == QuarterTurn,
+                "Intermediate point antipodal: three quarters longitude %d", threeQuarters.lon);
+  TF_assert_msg(state, std::abs(Geo::GetDistanceMeters(start, quarter) - quarterDistance) < 1.0,
+                "Intermediate point antipodal: quarter distance");
+  TF_assert_msg(state,
+                std::abs(Geo::GetDistanceMeters(threeQuarters, end) - quarterDistance) < 1.0,
+                "Intermediate point antipodal: three quarters distance");
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
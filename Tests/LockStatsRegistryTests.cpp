@@ -0,0 +1,210 @@
+/*------------------------------------------------------------------------------
+Copyright 2022 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for LockStatsRegistry
+
+    Copyright 2022 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "LockStatsRegistryTests"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Acdb/LockStatsRegistry.hpp"
+#include "Acdb/ReadWriteLock.hpp"
+#include "Acdb/RwlLocker.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that tagged lockers are counted by call site, and
+//!         that only the holders over the threshold are reported.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.lockstatsregistry.get_stats") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  ReadWriteLock readWriteLock;
+  LockStatsRegistry lockStats;
+  lockStats.SetEnabled(true);
+
+  std::vector<std::string> slowHolders;
+  lockStats.SetSlowHolderCallback(
+      10000, [&slowHolders](const std::string& aTag, const bool aExclusive,
+                            const uint64_t aHoldMicroseconds) {
+        (void)aExclusive;
+        (void)aHoldMicroseconds;
+        slowHolders.push_back(aTag);
+      });
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  {
+    RwlLocker locker{readWriteLock, true, lockStats, "Slow"};
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+
+  for (int i = 0; i < 3; i++) {
+    RwlLocker locker{readWriteLock, false, lockStats, "Fast"};
+  }
+
+  {
+    RwlLocker locker{readWriteLock, false};  // untagged, not counted
+  }
+
+  LockPerformanceStats actual = lockStats.GetStats();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, actual.size() == 2, "LockStatsRegistry: expected 2 entries, actual = %d",
+                actual.size());
+  if (actual.size() == 2) {
+    // Most total hold time first
+    TF_assert_msg(state, actual[0].mTag == "Slow", "LockStatsRegistry: slow entry");
+    TF_assert_msg(state, actual[0].mExclusive, "LockStatsRegistry: slow entry shared");
+    TF_assert_msg(state, actual[0].mAcquireCount == 1, "LockStatsRegistry: slow count");
+    TF_assert_msg(state, actual[0].mMaxHoldMicroseconds >= 20000,
+                  "LockStatsRegistry: slow hold %d", actual[0].mMaxHoldMicroseconds);
+    TF_assert_msg(state, actual[0].mP50HoldMicroseconds == actual[0].mMaxHoldMicroseconds,
+                  "LockStatsRegistry: p50 of a single hold");
+    TF_assert_msg(state, actual[0].mP99HoldMicroseconds == actual[0].mMaxHoldMicroseconds,
+                  "LockStatsRegistry: p99 of a single hold");
+
+    TF_assert_msg(state, actual[1].mTag == "Fast", "LockStatsRegistry: fast entry");
+    TF_assert_msg(state, !actual[1].mExclusive, "LockStatsRegistry: fast entry exclusive");
+    TF_assert_msg(state, actual[1].mAcquireCount == 3, "LockStatsRegistry: fast count");
+  }
+
+  TF_assert_msg(state, slowHolders.size() == 1,
+                "LockStatsRegistry: expected 1 slow holder, actual = %d", slowHolders.size());
+  TF_assert_msg(state, slowHolders[0] == "Slow", "LockStatsRegistry: slow holder");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that copies of a tag at different addresses, as
+//!         pooled per translation unit, are counted as one site.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.lockstatsregistry.get_stats_tag_copies") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  LockStatsRegistry lockStats;
+  lockStats.SetEnabled(true);
+
+  const char tag[] = "Copied";
+  const std::string tagCopy{tag};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  lockStats.Record(tag, false, 1, 10);
+  lockStats.Record(tagCopy.c_str(), false, 2, 20);
+
+  LockPerformanceStats actual = lockStats.GetStats();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, actual.size() == 1, "LockStatsRegistry: expected 1 entry, actual = %d",
+                actual.size());
+  if (actual.size() == 1) {
+    TF_assert_msg(state, actual[0].mTag == tag, "LockStatsRegistry: tag");
+    TF_assert_msg(state, actual[0].mAcquireCount == 2, "LockStatsRegistry: count");
+    TF_assert_msg(state, actual[0].mTotalWaitMicroseconds == 3, "LockStatsRegistry: merged wait");
+    TF_assert_msg(state, actual[0].mTotalHoldMicroseconds == 30, "LockStatsRegistry: merged hold");
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that nothing is counted while the registry is
+//!         disabled, but that slow holders are still reported.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.lockstatsregistry.disabled") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  ReadWriteLock readWriteLock;
+  LockStatsRegistry lockStats;
+
+  const bool actualRecordingBefore = lockStats.IsRecording();
+
+  std::vector<std::string> slowHolders;
+  lockStats.SetSlowHolderCallback(
+      10000, [&slowHolders](const std::string& aTag, const bool aExclusive,
+                            const uint64_t aHoldMicroseconds) {
+        (void)aExclusive;
+        (void)aHoldMicroseconds;
+        slowHolders.push_back(aTag);
+      });
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  {
+    RwlLocker locker{readWriteLock, true, lockStats, "Slow"};
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+
+  {
+    RwlLocker locker{readWriteLock, false, lockStats, "Fast"};
+  }
+
+  lockStats.Record("Direct", false, 1, 10);
+
+  LockPerformanceStats actual = lockStats.GetStats();
+
+  lockStats.SetSlowHolderCallback(0, nullptr);
+  const bool actualRecordingAfter = lockStats.IsRecording();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, !actualRecordingBefore, "LockStatsRegistry: recording by default");
+  TF_assert_msg(state, actual.empty(), "LockStatsRegistry: expected no entries, actual = %d",
+                actual.size());
+  TF_assert_msg(state, slowHolders.size() == 1,
+                "LockStatsRegistry: expected 1 slow holder, actual = %d", slowHolders.size());
+  if (slowHolders.size() == 1) {
+    TF_assert_msg(state, slowHolders[0] == "Slow", "LockStatsRegistry: slow holder");
+  }
+  TF_assert_msg(state, !actualRecordingAfter, "LockStatsRegistry: recording without callback");
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
@@ -27,8 +27,11 @@ limitations under the License.
 #include <algorithm>
 
 #include "Acdb/MarkerAdapter.hpp"
+#include "Acdb/MapMarkerColumns.hpp"
 #include "Acdb/MapMarker.hpp"
 #include "Acdb/MapMarkerFilter.hpp"
+#include "Acdb/Queries/MarkerAttributeQuery.hpp"
+#include "Acdb/Queries/NameSearchQuery.hpp"
 #include "Acdb/SearchMarker.hpp"
 #include "Acdb/TableDataTypes.hpp"
 #include "Acdb/Tests/DatabaseUtil.hpp"
@@ -218,6 +221,57 @@ TF_TEST_AUTO_SLOW("acdb.markeradapter.get_marina_marker_nearest", 30) {
   }
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test retrieving map marker columns within the given bbox.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_map_marker_columns", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+
+  bbox_type bbox = {{350, 350}, {150, 150}};
+  uint32_t typesBitmask = ACDB_ALL_TYPES;
+
+  MapMarkerFilter markerFilter(bbox, typesBitmask);
+
+  std::vector<IMapMarkerPtr> expected;
+  markerAdapter.GetMapMarkersByFilter(markerFilter, expected);
+
+  MapMarkerColumns actual;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetMapMarkersByFilter(markerFilter, actual);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected.size() == actual.Size(),
+                "Map marker columns count: expected %d, actual = %d", expected.size(),
+                actual.Size());
+  for (size_t i = 0; i < expected.size() && i < actual.Size(); i++) {
+    const MapMarkerColumns::Row row = actual[i];
+    TF_assert_msg(state, expected[i]->GetId() == row.GetId(),
+                  "Map marker columns: expected id %d, actual = %d", expected[i]->GetId(),
+                  row.GetId());
+    TF_assert_msg(state, expected[i]->GetName() == row.GetName(),
+                  "Map marker columns: expected name %s, actual = %s",
+                  expected[i]->GetName().c_str(), row.GetName());
+    TF_assert_msg(state, expected[i]->GetMapIcon() == row.GetMapIcon(),
+                  "Map marker columns: unexpected icon for %d", row.GetId());
+  }
+}
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -896,9 +950,10 @@ TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker", 30) {
                     ACDB_LITER  // aFuelPriceUnit
   );
 
+  const std::string localizedType{"[10]"};
   ISearchMarkerPtr expected(new SearchMarker(
       1, ACDB_MARINA, 1527084000, "Test Marina 1", 100, 100, MapIconType::MarinaSponsor,
-      std::move(contactData), std::move(fuelData), std::move(reviewStatsData), "[10]"));
+      std::move(contactData), std::move(fuelData), std::move(reviewStatsData), &localizedType));
 
   // ----------------------------------------------------------
   // Act
@@ -981,9 +1036,10 @@ TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_noExtraInfo", 20) {
   ContactData contactData;
   FuelData fuelData;
 
+  const std::string localizedType{"[10]"};
   ISearchMarkerPtr expected(new SearchMarker(
       2, ACDB_MARINA, 1527084001, "Test Marina 2", 200, 200, MapIconType::Marina,
-      std::move(contactData), std::move(fuelData), std::move(reviewStatsData), "[10]"));
+      std::move(contactData), std::move(fuelData), std::move(reviewStatsData), &localizedType));
 
   // ----------------------------------------------------------
   // Act
@@ -1126,10 +1182,11 @@ TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_bbox_only", 20)
 //!
 //!   @public
 //!   @detail
-//!         Test retrieving nearest markers.
+//!         Test that a limited search returns the lowest IDs with
+//!         the same contact, fuel and review data as a lookup by ID.
 //!
 //----------------------------------------------------------------
-TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name", 30) {
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_max_results", 20) {
   // ----------------------------------------------------------
   // Arrange
   // ----------------------------------------------------------
@@ -1142,20 +1199,14 @@ TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name",
 
   bbox_type filterBbox;
   filterBbox.nec = {350, 350};
-  filterBbox.swc = {150, 150};
-  std::string searchString("Yet Another");
+  filterBbox.swc = {50, 50};
 
   SearchMarkerFilter markerFilter;
   markerFilter.AddType(ACDB_MARINA);
   markerFilter.SetBbox(filterBbox);
-  markerFilter.SetSearchString(searchString);
+  markerFilter.SetMaxResults(1);
 
-  // Expected:
-  // - 1 and 4 are outside bbox
-  // - 5 is inside bbox but wrong type
-  // - 2 and 3 are inside, but the name does not match
-  // - 21 and 22 should be good
-  const std::vector<ACDB_marker_idx_type> expected = {21, 22};
+  ISearchMarkerPtr expected = markerAdapter.GetSearchMarker(1);
   std::vector<ISearchMarkerPtr> actual;
 
   // ----------------------------------------------------------
@@ -1166,24 +1217,48 @@ TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name",
   // ----------------------------------------------------------
   // Assert
   // ----------------------------------------------------------
-  TF_assert_msg(state, expected.size() == actual.size(),
-                "Search markers by Bbox: expected %d, actual = %d", expected.size(), actual.size());
-  for (std::vector<ISearchMarkerPtr>::iterator it = actual.begin(); it != actual.end(); ++it) {
-    TF_assert_msg(state, find(expected.begin(), expected.end(), (*it)->GetId()) != expected.end(),
-                  "Search markers by Bbox: Unexpected result %d", (*it)->GetId());
-  }
+  TF_assert_msg(state, nullptr != expected, "SearchMarker: unexpected nullptr");
+  TF_assert_msg(state, 1 == actual.size(), "Search markers max results: expected 1, actual = %d",
+                actual.size());
+  TF_assert_msg(state, expected->GetId() == actual[0]->GetId(),
+                "Search markers max results: Unexpected result %d", actual[0]->GetId());
+  TF_assert_msg(state, expected->GetAverageRating() == actual[0]->GetAverageRating(),
+                "Search markers max results: Average Rating");
+  TF_assert_msg(state, expected->GetNumberOfReviews() == actual[0]->GetNumberOfReviews(),
+                "Search markers max results: Number of reviews");
+  TF_assert_msg(state, expected->GetPhoneNumber() == actual[0]->GetPhoneNumber(),
+                "Search markers max results: Phone Number");
+  TF_assert_msg(state, expected->GetVhfChannel() == actual[0]->GetVhfChannel(),
+                "Search markers max results: VHF Channel");
+
+  ISearchMarker::FuelPriceUnit expectedPriceUnit;
+  std::string expectedCurrency;
+  float expectedPrice;
+
+  ISearchMarker::FuelPriceUnit actualPriceUnit;
+  std::string actualCurrency;
+  float actualPrice;
+
+  expected->GetFuelPriceInfo(ISearchMarker::FuelType::Gas, expectedPrice, expectedCurrency,
+                             expectedPriceUnit);
+  actual[0]->GetFuelPriceInfo(ISearchMarker::FuelType::Gas, actualPrice, actualCurrency,
+                              actualPriceUnit);
+  TF_assert_msg(state, expectedPrice == actualPrice, "Search markers max results: Gas Price");
+  TF_assert_msg(state, expectedCurrency == actualCurrency,
+                "Search markers max results: Gas Currency");
+  TF_assert_msg(state, expectedPriceUnit == actualPriceUnit,
+                "Search markers max results: Gas Unit");
 }
 
 //----------------------------------------------------------------
 //!
 //!   @public
 //!   @detail
-//!         Test retrieving nearest markers by name using SearchMarkerFilter constructor.
+//!         Test max results across a bounding box crossing the
+//!         antimeridian.
 //!
 //----------------------------------------------------------------
-TF_TEST_AUTO_SLOW(
-    "acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name_search_marker_filter_constructor",
-    30) {
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_cross_meridian", 20) {
   // ----------------------------------------------------------
   // Arrange
   // ----------------------------------------------------------
@@ -1194,18 +1269,18 @@ TF_TEST_AUTO_SLOW(
   MarkerAdapter markerAdapter{database};
   TranslationUtil translationUtil{state};
 
-  bbox_type bbox = {{350, 350}, {150, 150}};
-  uint32_t typesBitmask = ACDB_MARINA;
-  const std::string searchString = "Another";
+  // West of the antimeridian: 8, 9 and 10.  East of it: 1, 2, 21 and 22.
+  bbox_type filterBbox;
+  filterBbox.nec = {1050, 250};
+  filterBbox.swc = {50, 750};
 
-  SearchMarkerFilter markerFilter(bbox, typesBitmask, searchString);
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+  markerFilter.SetBbox(filterBbox);
+  markerFilter.SetMaxResults(3);
 
-  // Expected:
-  // - 1 and 4 are outside bbox
-  // - 5 is inside bbox but wrong type
-  // - 2 and 3 are inside, but the name does not match
-  // - 21 and 22 should be good
-  const std::vector<ACDB_marker_idx_type> expected = {21, 22};
+  // The limit and the id order apply to both parts together.
+  const std::vector<ACDB_marker_idx_type> expected = {1, 2, 8};
   std::vector<ISearchMarkerPtr> actual;
 
   // ----------------------------------------------------------
@@ -1217,10 +1292,13 @@ TF_TEST_AUTO_SLOW(
   // Assert
   // ----------------------------------------------------------
   TF_assert_msg(state, expected.size() == actual.size(),
-                "Search markers by Bbox: expected %d, actual = %d", expected.size(), actual.size());
-  for (const auto& marker : actual) {
-    TF_assert_msg(state, find(expected.begin(), expected.end(), marker->GetId()) != expected.end(),
-                  "Search markers by Bbox: Unexpected result %d", marker->GetId());
+                "Search markers cross meridian: expected %d, actual = %d", expected.size(),
+                actual.size());
+
+  for (std::size_t i = 0; i < expected.size() && i < actual.size(); i++) {
+    TF_assert_msg(state, expected[i] == actual[i]->GetId(),
+                  "Search markers cross meridian: expected %d, actual = %d", expected[i],
+                  actual[i]->GetId());
   }
 }
 
@@ -1228,13 +1306,10 @@ TF_TEST_AUTO_SLOW(
 //!
 //!   @public
 //!   @detail
-//!         Test retrieving nearest markers by name and number of results using SearchMarkerFilter
-//!         constructor.
+//!         Test paging through search results sorted by name.
 //!
 //----------------------------------------------------------------
-TF_TEST_AUTO_SLOW(
-    "acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name_and_max_results_search_marker_filter_constructor",
-    20) {
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_sorted_by_name", 20) {
   // ----------------------------------------------------------
   // Arrange
   // ----------------------------------------------------------
@@ -1245,19 +1320,150 @@ TF_TEST_AUTO_SLOW(
   MarkerAdapter markerAdapter{database};
   TranslationUtil translationUtil{state};
 
-  bbox_type bbox = {{350, 350}, {150, 150}};
-  uint32_t typesBitmask = ACDB_MARINA;
-  const std::string searchString = "Test Marina";
-  const int32_t maxResults = 2;
+  bbox_type filterBbox;
+  filterBbox.nec = {350, 350};
+  filterBbox.swc = {150, 150};
 
-  SearchMarkerFilter markerFilter(bbox, typesBitmask, searchString, maxResults);
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+  markerFilter.SetBbox(filterBbox);
+  markerFilter.SetSortOrder(SearchMarkerFilter::SortByName);
+  markerFilter.SetMaxResults(3);
 
-  // Expected:
-  // - 1, 4, 5, 6, 7, 8, 9, 10 are outside bbox
-  // - 21 and 22 shouldn't get in the final result list hence maxResults
-  // - 2, 3 should be good
-  // - all others are of wrong types
-  const std::vector<ACDB_marker_idx_type> expected = {2, 3};
+  // Expected: "Test Marina 2", "Test Marina 3", "Yet Another Test Marina 1", then
+  // "Yet Another Test Marina 2" on the second page.
+  const std::vector<ACDB_marker_idx_type> expectedFirstPage = {2, 3, 21};
+  const std::vector<ACDB_marker_idx_type> expectedSecondPage = {22};
+  std::vector<ISearchMarkerPtr> actualFirstPage;
+  std::vector<ISearchMarkerPtr> actualSecondPage;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetBasicSearchMarkersByFilter(markerFilter, actualFirstPage);
+
+  markerFilter.SetStartAfter(actualFirstPage.back()->GetId());
+  markerAdapter.GetBasicSearchMarkersByFilter(markerFilter, actualSecondPage);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expectedFirstPage.size() == actualFirstPage.size(),
+                "Sorted search markers: expected %d, actual = %d", expectedFirstPage.size(),
+                actualFirstPage.size());
+  for (size_t i = 0; i < expectedFirstPage.size(); i++) {
+    TF_assert_msg(state, expectedFirstPage[i] == actualFirstPage[i]->GetId(),
+                  "Sorted search markers: expected %d, actual = %d", expectedFirstPage[i],
+                  actualFirstPage[i]->GetId());
+  }
+
+  TF_assert_msg(state, expectedSecondPage.size() == actualSecondPage.size(),
+                "Sorted search markers page 2: expected %d, actual = %d",
+                expectedSecondPage.size(), actualSecondPage.size());
+  for (size_t i = 0; i < expectedSecondPage.size(); i++) {
+    TF_assert_msg(state, expectedSecondPage[i] == actualSecondPage[i]->GetId(),
+                  "Sorted search markers page 2: expected %d, actual = %d",
+                  expectedSecondPage[i], actualSecondPage[i]->GetId());
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test paging through search results sorted by rating,
+//!         with unreviewed markers last.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_sorted_by_rating", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  bbox_type filterBbox;
+  filterBbox.nec = {350, 350};
+  filterBbox.swc = {0, 0};
+
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+  markerFilter.SetBbox(filterBbox);
+  markerFilter.SetSortOrder(SearchMarkerFilter::SortByRating);
+  markerFilter.SetMaxResults(3);
+
+  // Expected: marker 2 (average 3), marker 1 (average 2.25), then the unreviewed markers by id.
+  const std::vector<ACDB_marker_idx_type> expectedFirstPage = {2, 1, 3};
+  const std::vector<ACDB_marker_idx_type> expectedSecondPage = {21, 22};
+  std::vector<ISearchMarkerPtr> actualFirstPage;
+  std::vector<ISearchMarkerPtr> actualSecondPage;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetBasicSearchMarkersByFilter(markerFilter, actualFirstPage);
+
+  markerFilter.SetStartAfter(actualFirstPage.back()->GetId());
+  markerAdapter.GetBasicSearchMarkersByFilter(markerFilter, actualSecondPage);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expectedFirstPage.size() == actualFirstPage.size(),
+                "Rated search markers: expected %d, actual = %d", expectedFirstPage.size(),
+                actualFirstPage.size());
+  for (size_t i = 0; i < expectedFirstPage.size(); i++) {
+    TF_assert_msg(state, expectedFirstPage[i] == actualFirstPage[i]->GetId(),
+                  "Rated search markers: expected %d, actual = %d", expectedFirstPage[i],
+                  actualFirstPage[i]->GetId());
+  }
+
+  TF_assert_msg(state, expectedSecondPage.size() == actualSecondPage.size(),
+                "Rated search markers page 2: expected %d, actual = %d",
+                expectedSecondPage.size(), actualSecondPage.size());
+  for (size_t i = 0; i < expectedSecondPage.size(); i++) {
+    TF_assert_msg(state, expectedSecondPage[i] == actualSecondPage[i]->GetId(),
+                  "Rated search markers page 2: expected %d, actual = %d",
+                  expectedSecondPage[i], actualSecondPage[i]->GetId());
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test search results sorted by distance, with ties
+//!         ordered by ID.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_sorted_by_distance", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  bbox_type filterBbox;
+  filterBbox.nec = {350, 350};
+  filterBbox.swc = {150, 150};
+
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+  markerFilter.SetBbox(filterBbox);
+  markerFilter.SetSortOrder(SearchMarkerFilter::SortByDistance);
+  markerFilter.SetReferencePoint({300, 300});
+  markerFilter.SetMaxResults(2);
+
+  // Expected: 3 is at the reference point; 2, 21 and 22 are at the same distance.
+  const std::vector<ACDB_marker_idx_type> expected = {3, 2};
   std::vector<ISearchMarkerPtr> actual;
 
   // ----------------------------------------------------------
@@ -1269,10 +1475,11 @@ TF_TEST_AUTO_SLOW(
   // Assert
   // ----------------------------------------------------------
   TF_assert_msg(state, expected.size() == actual.size(),
-                "Search markers by Bbox: expected %d, actual = %d", expected.size(), actual.size());
-  for (const auto& marker : actual) {
-    TF_assert_msg(state, find(expected.begin(), expected.end(), marker->GetId()) != expected.end(),
-                  "Search markers by Bbox: Unexpected result %d", marker->GetId());
+                "Sorted search markers: expected %d, actual = %d", expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    TF_assert_msg(state, expected[i] == actual[i]->GetId(),
+                  "Sorted search markers: expected %d, actual = %d", expected[i],
+                  actual[i]->GetId());
   }
 }
 
@@ -1283,7 +1490,7 @@ TF_TEST_AUTO_SLOW(
 //!         Test retrieving nearest markers.
 //!
 //----------------------------------------------------------------
-TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name_and_category", 30) {
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name", 30) {
   // ----------------------------------------------------------
   // Arrange
   // ----------------------------------------------------------
@@ -1303,15 +1510,13 @@ TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name_a
   markerFilter.AddType(ACDB_MARINA);
   markerFilter.SetBbox(filterBbox);
   markerFilter.SetSearchString(searchString);
-  markerFilter.AddCategory(SearchMarkerFilter::MarinasAndMoorings);
 
   // Expected:
   // - 1 and 4 are outside bbox
   // - 5 is inside bbox but wrong type
   // - 2 and 3 are inside, but the name does not match
-  // - 22 is inside, name matches, but category is not set
-  // - 21 should be good
-  const std::vector<ACDB_marker_idx_type> expected = {21};
+  // - 21 and 22 should be good
+  const std::vector<ACDB_marker_idx_type> expected = {21, 22};
   std::vector<ISearchMarkerPtr> actual;
 
   // ----------------------------------------------------------
@@ -1330,5 +1535,740 @@ TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name_a
   }
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test filtering search markers by required attributes.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_attributes", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAttributeQuery markerAttributeQuery{database};
+  TF_assert_msg(state, markerAttributeQuery.Rebuild(), "Attribute search: rebuild attributes");
+
+  NameSearchQuery nameSearchQuery{database};
+  TF_assert_msg(state, nameSearchQuery.Rebuild(), "Attribute search: rebuild name search");
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  bbox_type filterBbox;
+  filterBbox.nec = {1000, 1000};
+  filterBbox.swc = {0, 0};
+
+  // Marker 1 has docks and moorings, and sells groceries, but has no shore power.
+  SearchMarkerFilter dockageFilter;
+  dockageFilter.AddType(ACDB_MARINA);
+  dockageFilter.SetBbox(filterBbox);
+  dockageFilter.AddRequiredAttribute(SearchMarkerFilter::HasDocks);
+  dockageFilter.AddRequiredAttribute(SearchMarkerFilter::Grocery);
+
+  SearchMarkerFilter shorePowerFilter = dockageFilter;
+  shorePowerFilter.AddRequiredAttribute(SearchMarkerFilter::ShorePower);
+
+  // The attribute parameters follow the bounding box in the sorted and fuzzy queries too.
+  SearchMarkerFilter sortedFilter = dockageFilter;
+  sortedFilter.SetSortOrder(SearchMarkerFilter::SortByName);
+
+  SearchMarkerFilter fuzzyFilter = dockageFilter;
+  fuzzyFilter.SetSearchString("test marina", SearchMarkerFilter::MatchFuzzy);
+
+  const std::vector<ACDB_marker_idx_type> expected = {1};
+  std::vector<ISearchMarkerPtr> actualDockage;
+  std::vector<ISearchMarkerPtr> actualShorePower;
+  std::vector<ISearchMarkerPtr> actualSorted;
+  std::vector<ISearchMarkerPtr> actualFuzzy;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetSearchMarkersByFilter(dockageFilter, actualDockage);
+  markerAdapter.GetBasicSearchMarkersByFilter(shorePowerFilter, actualShorePower);
+  markerAdapter.GetBasicSearchMarkersByFilter(sortedFilter, actualSorted);
+  markerAdapter.GetBasicSearchMarkersByFilter(fuzzyFilter, actualFuzzy);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected.size() == actualDockage.size(),
+                "Attribute search: expected %d, actual = %d", expected.size(),
+                actualDockage.size());
+  for (size_t i = 0; i < actualDockage.size(); i++) {
+    TF_assert_msg(state, expected[i] == actualDockage[i]->GetId(),
+                  "Attribute search: expected %d, actual = %d", expected[i],
+                  actualDockage[i]->GetId());
+  }
+
+  TF_assert_msg(state, actualShorePower.empty(), "Attribute search: unexpected shore power %d",
+                actualShorePower.size());
+  TF_assert_msg(state, actualSorted.size() == 1, "Attribute search: sorted results %d",
+                actualSorted.size());
+  TF_assert_msg(state, actualSorted[0]->GetId() == expected[0], "Attribute search: sorted result");
+  TF_assert_msg(state, actualFuzzy.size() == 1, "Attribute search: fuzzy results %d",
+                actualFuzzy.size());
+  TF_assert_msg(state, actualFuzzy[0]->GetId() == expected[0], "Attribute search: fuzzy result");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test filtering search markers by required attributes
+//!         before the attribute index is built.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_attributes_unindexed", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  bbox_type filterBbox;
+  filterBbox.nec = {1000, 1000};
+  filterBbox.swc = {0, 0};
+
+  // Marker 1 has docks and moorings, and sells groceries, but has no shore power.
+  SearchMarkerFilter dockageFilter;
+  dockageFilter.AddType(ACDB_MARINA);
+  dockageFilter.SetBbox(filterBbox);
+  dockageFilter.AddRequiredAttribute(SearchMarkerFilter::HasDocks);
+  dockageFilter.AddRequiredAttribute(SearchMarkerFilter::Grocery);
+
+  SearchMarkerFilter shorePowerFilter = dockageFilter;
+  shorePowerFilter.AddRequiredAttribute(SearchMarkerFilter::ShorePower);
+
+  SearchMarkerFilter sortedFilter = dockageFilter;
+  sortedFilter.SetSortOrder(SearchMarkerFilter::SortByName);
+
+  const std::vector<ACDB_marker_idx_type> expected = {1};
+  std::vector<ISearchMarkerPtr> actualDockage;
+  std::vector<ISearchMarkerPtr> actualShorePower;
+  std::vector<ISearchMarkerPtr> actualSorted;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetSearchMarkersByFilter(dockageFilter, actualDockage);
+  markerAdapter.GetBasicSearchMarkersByFilter(shorePowerFilter, actualShorePower);
+  markerAdapter.GetBasicSearchMarkersByFilter(sortedFilter, actualSorted);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, !database.tableExists("markerAttributes"),
+                "Unindexed attribute search: unexpected index");
+  TF_assert_msg(state, expected.size() == actualDockage.size(),
+                "Unindexed attribute search: expected %d, actual = %d", expected.size(),
+                actualDockage.size());
+  for (size_t i = 0; i < actualDockage.size(); i++) {
+    TF_assert_msg(state, expected[i] == actualDockage[i]->GetId(),
+                  "Unindexed attribute search: expected %d, actual = %d", expected[i],
+                  actualDockage[i]->GetId());
+  }
+
+  TF_assert_msg(state, actualShorePower.empty(),
+                "Unindexed attribute search: unexpected shore power %d", actualShorePower.size());
+  TF_assert_msg(state, actualSorted.size() == 1, "Unindexed attribute search: sorted results %d",
+                actualSorted.size());
+  TF_assert_msg(state, actualSorted[0]->GetId() == expected[0],
+                "Unindexed attribute search: sorted result");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test fuzzy name search, which ignores case and accents,
+//!         tolerates typos and ranks results by match.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_fuzzy_name", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  NameSearchQuery nameSearchQuery{database};
+  TF_assert_msg(state, nameSearchQuery.Rebuild(), "Fuzzy search: rebuild name search");
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  bbox_type filterBbox;
+  filterBbox.nec = {1000, 1000};
+  filterBbox.swc = {0, 0};
+
+  SearchMarkerFilter hazardFilter;
+  hazardFilter.AddType(ACDB_HAZARD);
+  hazardFilter.SetBbox(filterBbox);
+  hazardFilter.SetSearchString("T\xC3\xA9st HAZRD", SearchMarkerFilter::MatchFuzzy);
+
+  SearchMarkerFilter marinaFilter;
+  marinaFilter.AddType(ACDB_MARINA);
+  marinaFilter.SetBbox(filterBbox);
+  marinaFilter.SetSearchString("mar\xC3\xADna", SearchMarkerFilter::MatchFuzzy);
+  marinaFilter.SetMaxResults(3);
+
+  // Expected:
+  // - "Test Hazard 1" and "Test Hazard 23" are one edit away; the shorter name ranks first
+  // - all marinas match exactly; the shortest names rank first, then the lowest ids
+  const std::vector<ACDB_marker_idx_type> expectedHazards = {11, 23};
+  const std::vector<ACDB_marker_idx_type> expectedMarinas = {1, 2, 3};
+  std::vector<ISearchMarkerPtr> actualHazards;
+  std::vector<ISearchMarkerPtr> actualMarinas;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetSearchMarkersByFilter(hazardFilter, actualHazards);
+  markerAdapter.GetBasicSearchMarkersByFilter(marinaFilter, actualMarinas);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expectedHazards.size() == actualHazards.size(),
+                "Fuzzy search hazards: expected %d, actual = %d", expectedHazards.size(),
+                actualHazards.size());
+  for (std::size_t i = 0; i < expectedHazards.size() && i < actualHazards.size(); i++) {
+    TF_assert_msg(state, expectedHazards[i] == actualHazards[i]->GetId(),
+                  "Fuzzy search hazards: expected %d, actual = %d", expectedHazards[i],
+                  actualHazards[i]->GetId());
+  }
+
+  TF_assert_msg(state, expectedMarinas.size() == actualMarinas.size(),
+                "Fuzzy search marinas: expected %d, actual = %d", expectedMarinas.size(),
+                actualMarinas.size());
+  for (std::size_t i = 0; i < expectedMarinas.size() && i < actualMarinas.size(); i++) {
+    TF_assert_msg(state, expectedMarinas[i] == actualMarinas[i]->GetId(),
+                  "Fuzzy search marinas: expected %d, actual = %d", expectedMarinas[i],
+                  actualMarinas[i]->GetId());
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that fuzzy name search matches substrings until the
+//!         name search data is built, and fuzzy matches after.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_fuzzy_name_unindexed", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  bbox_type filterBbox;
+  filterBbox.nec = {1000, 1000};
+  filterBbox.swc = {0, 0};
+
+  SearchMarkerFilter substringFilter;
+  substringFilter.AddType(ACDB_HAZARD);
+  substringFilter.SetBbox(filterBbox);
+  substringFilter.SetSearchString("HAZARD 2", SearchMarkerFilter::MatchFuzzy);
+
+  SearchMarkerFilter typoFilter = substringFilter;
+  typoFilter.SetSearchString("T\xC3\xA9st HAZRD", SearchMarkerFilter::MatchFuzzy);
+
+  // Expected:
+  // - before the rebuild only "Test Hazard 23" contains the search string, and the typo
+  //   matches nothing
+  // - after the rebuild the typo matches both hazards, as in the indexed fuzzy search test
+  const std::vector<ACDB_marker_idx_type> expectedSubstring = {23};
+  const std::vector<ACDB_marker_idx_type> expectedFuzzy = {11, 23};
+  std::vector<ISearchMarkerPtr> actualSubstring;
+  std::vector<ISearchMarkerPtr> actualTypo;
+  std::vector<ISearchMarkerPtr> actualFuzzy;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetBasicSearchMarkersByFilter(substringFilter, actualSubstring);
+  markerAdapter.GetBasicSearchMarkersByFilter(typoFilter, actualTypo);
+
+  NameSearchQuery nameSearchQuery{database};
+  TF_assert_msg(state, nameSearchQuery.Rebuild(), "Unindexed fuzzy search: rebuild name search");
+
+  markerAdapter.GetBasicSearchMarkersByFilter(typoFilter, actualFuzzy);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expectedSubstring.size() == actualSubstring.size(),
+                "Unindexed fuzzy search: expected %d, actual = %d", expectedSubstring.size(),
+                actualSubstring.size());
+  for (std::size_t i = 0; i < expectedSubstring.size() && i < actualSubstring.size(); i++) {
+    TF_assert_msg(state, expectedSubstring[i] == actualSubstring[i]->GetId(),
+                  "Unindexed fuzzy search: expected %d, actual = %d", expectedSubstring[i],
+                  actualSubstring[i]->GetId());
+  }
+
+  TF_assert_msg(state, actualTypo.empty(), "Unindexed fuzzy search: unexpected typo match %d",
+                actualTypo.size());
+
+  TF_assert_msg(state, expectedFuzzy.size() == actualFuzzy.size(),
+                "Indexed fuzzy search: expected %d, actual = %d", expectedFuzzy.size(),
+                actualFuzzy.size());
+  for (std::size_t i = 0; i < expectedFuzzy.size() && i < actualFuzzy.size(); i++) {
+    TF_assert_msg(state, expectedFuzzy[i] == actualFuzzy[i]->GetId(),
+                  "Indexed fuzzy search: expected %d, actual = %d", expectedFuzzy[i],
+                  actualFuzzy[i]->GetId());
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test retrieving nearest markers by name using SearchMarkerFilter constructor.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW(
+    "acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name_search_marker_filter_constructor",
+    30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  bbox_type bbox = {{350, 350}, {150, 150}};
+  uint32_t typesBitmask = ACDB_MARINA;
+  const std::string searchString = "Another";
+
+  SearchMarkerFilter markerFilter(bbox, typesBitmask, searchString);
+
+  // Expected:
+  // - 1 and 4 are outside bbox
+  // - 5 is inside bbox but wrong type
+  // - 2 and 3 are inside, but the name does not match
+  // - 21 and 22 should be good
+  const std::vector<ACDB_marker_idx_type> expected = {21, 22};
+  std::vector<ISearchMarkerPtr> actual;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetSearchMarkersByFilter(markerFilter, actual);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected.size() == actual.size(),
+                "Search markers by Bbox: expected %d, actual = %d", expected.size(), actual.size());
+  for (const auto& marker : actual) {
+    TF_assert_msg(state, find(expected.begin(), expected.end(), marker->GetId()) != expected.end(),
+                  "Search markers by Bbox: Unexpected result %d", marker->GetId());
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test retrieving nearest markers by name and number of results using SearchMarkerFilter
+//!         constructor.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW(
+    "acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name_and_max_results_search_marker_filter_constructor",
+    20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  bbox_type bbox = {{350, 350}, {150, 150}};
+  uint32_t typesBitmask = ACDB_MARINA;
+  const std::string searchString = "Test Marina";
+  const int32_t maxResults = 2;
+
+  SearchMarkerFilter markerFilter(bbox, typesBitmask, searchString, maxResults);
+
+  // Expected:
+  // - 1, 4, 5, 6, 7, 8, 9, 10 are outside bbox
+  // - 21 and 22 shouldn't get in the final result list hence maxResults
+  // - 2, 3 should be good
+  // - all others are of wrong types
+  const std::vector<ACDB_marker_idx_type> expected = {2, 3};
+  std::vector<ISearchMarkerPtr> actual;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetSearchMarkersByFilter(markerFilter, actual);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected.size() == actual.size(),
+                "Search markers by Bbox: expected %d, actual = %d", expected.size(), actual.size());
+  for (const auto& marker : actual) {
+    TF_assert_msg(state, find(expected.begin(), expected.end(), marker->GetId()) != expected.end(),
+                  "Search markers by Bbox: Unexpected result %d", marker->GetId());
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test retrieving nearest markers.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarker_filter_by_bbox_and_name_and_category", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  bbox_type filterBbox;
+  filterBbox.nec = {350, 350};
+  filterBbox.swc = {150, 150};
+  std::string searchString("Yet Another");
+
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+  markerFilter.SetBbox(filterBbox);
+  markerFilter.SetSearchString(searchString);
+  markerFilter.AddCategory(SearchMarkerFilter::MarinasAndMoorings);
+
+  // Expected:
+  // - 1 and 4 are outside bbox
+  // - 5 is inside bbox but wrong type
+  // - 2 and 3 are inside, but the name does not match
+  // - 22 is inside, name matches, but category is not set
+  // - 21 should be good
+  const std::vector<ACDB_marker_idx_type> expected = {21};
+  std::vector<ISearchMarkerPtr> actual;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetSearchMarkersByFilter(markerFilter, actual);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected.size() == actual.size(),
+                "Search markers by Bbox: expected %d, actual = %d", expected.size(), actual.size());
+  for (std::vector<ISearchMarkerPtr>::iterator it = actual.begin(); it != actual.end(); ++it) {
+    TF_assert_msg(state, find(expected.begin(), expected.end(), (*it)->GetId()) != expected.end(),
+                  "Search markers by Bbox: Unexpected result %d", (*it)->GetId());
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test retrieving the markers nearest a position.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_nearest_searchmarkers", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  const scposn_type position{920, 920};
+
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+
+  // Expected:
+  // - 9 is closest, then 10 and 8
+  // - 11 and 13 are close but wrong type
+  const std::vector<ACDB_marker_idx_type> expected = {9, 10, 8};
+  std::vector<SearchMarkerDistancePair> actual;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetNearestSearchMarkers(position, 3, markerFilter, actual);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected.size() == actual.size(),
+                "Nearest search markers: expected %d, actual = %d", expected.size(),
+                actual.size());
+  for (std::size_t i = 0; i < expected.size() && i < actual.size(); i++) {
+    TF_assert_msg(state, expected[i] == actual[i].first->GetId(),
+                  "Nearest search markers: expected %d, actual = %d", expected[i],
+                  actual[i].first->GetId());
+    if (i > 0) {
+      TF_assert_msg(state, actual[i - 1].second <= actual[i].second,
+                    "Nearest search markers: not sorted by distance");
+    }
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test retrieving markers along a route.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarkers_along_route", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  // Two legs along the equator; 100 semicircles is about 0.93 meters.
+  const std::vector<scposn_type> route{{0, 0}, {0, 250}, {0, 1000}};
+  const double bufferMeters = 3.0;
+
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+
+  // Expected:
+  // - 1, 2, 21, 22 and 3 are within the buffer, in route order
+  // - 4 and beyond are too far from the route
+  // - 11 is within the buffer but wrong type
+  const std::vector<ACDB_marker_idx_type> expected = {1, 2, 21, 22, 3};
+  std::vector<RouteSearchMarker> actual;
+  std::vector<RouteSearchMarker> actualStopped;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetSearchMarkersAlongRoute(route, bufferMeters, markerFilter,
+                                           [&actual](RouteSearchMarker&& aResult) {
+                                             actual.push_back(std::move(aResult));
+                                             return true;
+                                           });
+
+  markerAdapter.GetSearchMarkersAlongRoute(route, bufferMeters, markerFilter,
+                                           [&actualStopped](RouteSearchMarker&& aResult) {
+                                             actualStopped.push_back(std::move(aResult));
+                                             return actualStopped.size() < 2;
+                                           });
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected.size() == actual.size(),
+                "Search markers along route: expected %d, actual = %d", expected.size(),
+                actual.size());
+  for (std::size_t i = 0; i < expected.size() && i < actual.size(); i++) {
+    TF_assert_msg(state, expected[i] == actual[i].mMarker->GetId(),
+                  "Search markers along route: expected %d, actual = %d", expected[i],
+                  actual[i].mMarker->GetId());
+    TF_assert_msg(state, actual[i].mDistanceFromRoute <= bufferMeters,
+                  "Search markers along route: outside buffer");
+    if (i > 0) {
+      TF_assert_msg(state, actual[i - 1].mDistanceAlongRoute <= actual[i].mDistanceAlongRoute,
+                    "Search markers along route: not in route order");
+    }
+  }
+
+  TF_assert_msg(state, actualStopped.size() == 2, "Search markers along route: did not stop");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test retrieving markers along a route one leg at a
+//!         time, with the same extended data as a single marker
+//!         read.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_searchmarkers_along_route_leg", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+  TranslationUtil translationUtil{state};
+
+  const std::vector<scposn_type> route{{0, 0}, {0, 250}, {0, 1000}};
+  const double bufferMeters = 3.0;
+
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+
+  const std::vector<ACDB_marker_idx_type> expected = {1, 2, 21, 22, 3};
+  std::vector<RouteSearchMarker> actual;
+  std::vector<bool> actualMore;
+
+  MarkerAdapter::RouteSearchProgress progress;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  for (int call = 0; call < 3; call++) {
+    actualMore.push_back(markerAdapter.GetSearchMarkersAlongRouteLeg(
+        route, bufferMeters, markerFilter, progress, actual));
+  }
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, actualMore == std::vector<bool>({true, false, false}),
+                "Search markers along route leg: legs remaining");
+  TF_assert_msg(state, expected.size() == actual.size(),
+                "Search markers along route leg: expected %d, actual = %d", expected.size(),
+                actual.size());
+  for (std::size_t i = 0; i < expected.size() && i < actual.size(); i++) {
+    ISearchMarkerPtr single = markerAdapter.GetSearchMarker(expected[i]);
+
+    TF_assert_msg(state, expected[i] == actual[i].mMarker->GetId(),
+                  "Search markers along route leg: expected %d, actual = %d", expected[i],
+                  actual[i].mMarker->GetId());
+    TF_assert_msg(state, single->GetName() == actual[i].mMarker->GetName(),
+                  "Search markers along route leg: name");
+    TF_assert_msg(state, single->GetPhoneNumber() == actual[i].mMarker->GetPhoneNumber(),
+                  "Search markers along route leg: phone number");
+    TF_assert_msg(state, single->GetNumberOfReviews() == actual[i].mMarker->GetNumberOfReviews(),
+                  "Search markers along route leg: number of reviews");
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test retrieving markers for overlapping filters at once.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_map_markers_by_filters", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+
+  std::vector<MapMarkerFilter> markerFilters{
+      MapMarkerFilter{bbox_type{{350, 350}, {150, 150}}, ACDB_MARINA},
+      MapMarkerFilter{bbox_type{{450, 450}, {250, 250}}, ACDB_MARINA}};
+
+  // Expected:
+  // - first filter matches 2, 3, 21 and 22
+  // - second filter matches 3 and 4
+  // - 3 is returned once, and shared by both filters
+  const std::vector<std::vector<ACDB_marker_idx_type>> expected = {{2, 3, 21, 22}, {3, 4}};
+  std::vector<IMapMarkerPtr> actual;
+  std::vector<std::vector<size_t>> actualIndexes;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetMapMarkersByFilters(markerFilters, actual, actualIndexes);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, actual.size() == 5, "Markers by filters: expected 5, actual = %d",
+                actual.size());
+  TF_assert_msg(state, actualIndexes.size() == expected.size(), "Markers by filters: index lists");
+
+  for (std::size_t i = 0; i < expected.size() && i < actualIndexes.size(); i++) {
+    std::vector<ACDB_marker_idx_type> actualIds;
+    for (size_t index : actualIndexes[i]) {
+      actualIds.push_back(actual[index]->GetId());
+    }
+
+    std::sort(actualIds.begin(), actualIds.end());
+    TF_assert_msg(state, expected[i] == actualIds, "Markers by filters: filter %d", i);
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test map markers in a bounding box crossing the
+//!         antimeridian.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markeradapter.get_map_markers_cross_meridian", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+
+  MapMarkerFilter markerFilter{bbox_type{{1050, 250}, {50, 750}}, ACDB_MARINA};
+
+  // West of the antimeridian: 8, 9 and 10.  East of it: 1, 2, 21 and 22.
+  const std::vector<ACDB_marker_idx_type> expected = {1, 2, 8, 9, 10, 21, 22};
+  std::vector<IMapMarkerPtr> actual;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  markerAdapter.GetMapMarkersByFilter(markerFilter, actual);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  std::vector<ACDB_marker_idx_type> actualIds;
+  for (const auto& marker : actual) {
+    actualIds.push_back(marker->GetId());
+  }
+
+  std::sort(actualIds.begin(), actualIds.end());
+  TF_assert_msg(state, expected == actualIds,
+                "Map markers cross meridian: expected %d, actual = %d", expected.size(),
+                actualIds.size());
+}
+
 }  // end of namespace Test
 }  // end of namespace Acdb
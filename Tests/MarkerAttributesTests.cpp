@@ -0,0 +1,119 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for MarkerAttributes
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "MarkerAttributesTests"
+
+#include <string>
+#include <vector>
+
+#include "Acdb/MarkerAttributes.hpp"
+#include "Acdb/SearchMarkerFilter.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test GetAttributes.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.markerattributes.get_attributes") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  std::vector<std::string> inputs = {
+      // yes/no fields
+      "[ { \"fieldTextHandle\": 69, \"value\": \"Yes\" }, { \"fieldTextHandle\": 132, \"value\": "
+      "\"yes\" }, { \"fieldTextHandle\": 67, \"value\": \"No\" } ]",
+      // yes/no price fields
+      "[ { \"price\": \"1.00 USD\", \"pricingUnitTextHandle\": 4, \"fieldTextHandle\": 109, "
+      "\"value\": \"Yes\" } ]",
+      // nearby and unknown are not yes
+      "[ { \"fieldTextHandle\": 42, \"value\": \"Nearby\" }, { \"fieldTextHandle\": 43, "
+      "\"value\": \"Unknown\" } ]",
+      // fields without an attribute
+      "[ { \"fieldTextHandle\": 123, \"value\": \"Yes\" } ]",
+      // malformed
+      "[ { \"fieldTextHandle\": \"69\", \"value\": \"Yes\" }, { \"value\": \"Yes\" }, 69 ]",
+      "not json",
+      ""};
+
+  std::vector<uint64_t> expected = {
+      SearchMarkerFilter::Diesel | SearchMarkerFilter::PumpOut,  // yes/no fields
+      SearchMarkerFilter::HasMoorings,                           // yes/no price fields
+      0,                                                         // nearby and unknown
+      0,                                                         // fields without an attribute
+      0,                                                         // malformed
+      0,
+      0};
+
+  // ----------------------------------------------------------
+  // Act / Assert
+  // ----------------------------------------------------------
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    uint64_t actual = MarkerAttributes::GetAttributes(inputs[i]);
+    TF_assert_msg(state, expected[i] == actual,
+                  "MarkerAttributes: GetAttributes %d expected %llx, actual = %llx", i,
+                  static_cast<unsigned long long>(expected[i]),
+                  static_cast<unsigned long long>(actual));
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test GetAttributes of JSON that is not null-terminated,
+//!         as read from a column without copying.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.markerattributes.get_attributes_length") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  const std::string first{"[ { \"fieldTextHandle\": 69, \"value\": \"Yes\" } ]"};
+  const std::string second{"[ { \"fieldTextHandle\": 132, \"value\": \"Yes\" } ]"};
+  const std::string input = first + second;
+
+  uint64_t expected = SearchMarkerFilter::Diesel;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  uint64_t actual = MarkerAttributes::GetAttributes(input.data(), first.size());
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected == actual,
+                "MarkerAttributes: GetAttributes expected %llx, actual = %llx",
+                static_cast<unsigned long long>(expected), static_cast<unsigned long long>(actual));
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
@@ -0,0 +1,523 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for the MarkerSnapshot
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "MarkerSnapshotTests"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Acdb/FileUtil.hpp"
+#include "Acdb/MapMarkerColumns.hpp"
+#include "Acdb/MapMarkerFilter.hpp"
+#include "Acdb/MarkerAdapter.hpp"
+#include "Acdb/MarkerSnapshot.hpp"
+#include "Acdb/Queries/VersionQuery.hpp"
+#include "Acdb/Repository.hpp"
+#include "Acdb/Tests/DatabaseUtil.hpp"
+#include "Acdb/Version.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+#include "UTL_pub_lib_cnvt.h"
+
+namespace Acdb {
+namespace Test {
+
+static const std::string SnapshotPath{"MarkerSnapshotTests.snapshot"};
+static const std::string SnapshotVersion{"1.2.3.4"};
+static const std::string DatabasePath{"MarkerSnapshotTests.db"};
+static const std::string TileDatabasePath{"MarkerSnapshotTests.tile.db"};
+static const std::string SnapshotExt{".snapshot"};
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail
+//!         Get a position from degrees.
+//!
+//----------------------------------------------------------------
+static scposn_type GetPosition(const double aLatDegrees, const double aLonDegrees) {
+  scposn_type posn;
+  posn.lat = static_cast<int32_t>(aLatDegrees * UTL_DEG_TO_SEMI);
+  posn.lon = static_cast<int32_t>(aLonDegrees * UTL_DEG_TO_SEMI);
+  return posn;
+}
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail
+//!         Get a bounding box from degrees.
+//!
+//----------------------------------------------------------------
+static bbox_type GetBbox(const double aSouthDegrees, const double aWestDegrees,
+                         const double aNorthDegrees, const double aEastDegrees) {
+  bbox_type bbox;
+  bbox.swc = GetPosition(aSouthDegrees, aWestDegrees);
+  bbox.nec = GetPosition(aNorthDegrees, aEastDegrees);
+  return bbox;
+}
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail
+//!         Get the markers of aMarkers matching aFilter, checking
+//!         each one against the filter rather than the grid.  A
+//!         box whose west edge is east of its east edge crosses
+//!         the antimeridian.
+//!
+//----------------------------------------------------------------
+static MapMarkerColumns GetMatching(const MapMarkerColumns& aMarkers,
+                                    const MapMarkerFilter& aFilter) {
+  const bbox_type& bbox = aFilter.GetBbox();
+  const bool crossesMeridian = bbox.swc.lon > bbox.nec.lon;
+
+  MapMarkerColumns result;
+  for (const MapMarkerColumns::Row& row : aMarkers) {
+    const scposn_type posn = row.GetPosition();
+    const bool insideLon = crossesMeridian
+                               ? (posn.lon > bbox.swc.lon || posn.lon < bbox.nec.lon)
+                               : (posn.lon > bbox.swc.lon && posn.lon < bbox.nec.lon);
+
+    if (insideLon && posn.lat > bbox.swc.lat && posn.lat < bbox.nec.lat &&
+        (static_cast<uint32_t>(row.GetType()) & aFilter.GetAllowedTypes()) != 0) {
+      result.Add(row.GetId(), row.GetType(), row.GetLastUpdated(), row.GetName(),
+                 std::strlen(row.GetName()), posn, row.GetMapIcon());
+    }
+  }
+
+  return result;
+}
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail
+//!         Get whether aLhs and aRhs hold the same markers, field
+//!         by field, in any order.
+//!
+//----------------------------------------------------------------
+static bool IsSameMarkers(const MapMarkerColumns& aLhs, const MapMarkerColumns& aRhs) {
+  if (aLhs.Size() != aRhs.Size()) {
+    return false;
+  }
+
+  auto getSortedRows = [](const MapMarkerColumns& aColumns) {
+    std::vector<MapMarkerColumns::Row> rows(aColumns.begin(), aColumns.end());
+    std::sort(rows.begin(), rows.end(),
+              [](const MapMarkerColumns::Row& aLeft, const MapMarkerColumns::Row& aRight) {
+                return aLeft.GetId() < aRight.GetId();
+              });
+    return rows;
+  };
+
+  const std::vector<MapMarkerColumns::Row> lhsRows = getSortedRows(aLhs);
+  const std::vector<MapMarkerColumns::Row> rhsRows = getSortedRows(aRhs);
+
+  for (size_t i = 0; i < lhsRows.size(); i++) {
+    const MapMarkerColumns::Row& lhs = lhsRows[i];
+    const MapMarkerColumns::Row& rhs = rhsRows[i];
+
+    if (lhs.GetId() != rhs.GetId() || lhs.GetType() != rhs.GetType() ||
+        lhs.GetLastUpdated() != rhs.GetLastUpdated() ||
+        std::strcmp(lhs.GetName(), rhs.GetName()) != 0 ||
+        lhs.GetPosition().lat != rhs.GetPosition().lat ||
+        lhs.GetPosition().lon != rhs.GetPosition().lon || lhs.GetMapIcon() != rhs.GetMapIcon()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail
+//!         Get the ids of the markers in aColumns, sorted.
+//!
+//----------------------------------------------------------------
+static std::vector<ACDB_marker_idx_type> GetSortedIds(const MapMarkerColumns& aColumns) {
+  std::vector<ACDB_marker_idx_type> ids;
+  for (size_t i = 0; i < aColumns.Size(); i++) {
+    ids.push_back(aColumns[i].GetId());
+  }
+
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a snapshot finds the markers the database
+//!         finds, for a bounding box and for a type filter.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markersnapshot.get_map_markers", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+
+  LastUpdateInfoType lastUpdateInfo;
+  lastUpdateInfo.mMarkerLastUpdate = 1527084005;
+
+  MapMarkerColumns allMarkers;
+  TF_assert(state, markerAdapter.GetAllMapMarkers(allMarkers));
+  TF_assert(state, MarkerSnapshot::Write(SnapshotPath, Version{SnapshotVersion}, lastUpdateInfo,
+                                         allMarkers, std::string{},
+                                         std::vector<TranslationDataType>{}));
+
+  bbox_type bbox = {{350, 350}, {150, 150}};
+  std::vector<MapMarkerFilter> filters{MapMarkerFilter(bbox, ACDB_ALL_TYPES),
+                                       MapMarkerFilter(bbox, ACDB_MARINA)};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  std::unique_ptr<MarkerSnapshot> snapshot =
+      MarkerSnapshot::Open(SnapshotPath, Version{SnapshotVersion}, lastUpdateInfo);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, nullptr != snapshot, "Snapshot: unexpected nullptr");
+  TF_assert_msg(state, allMarkers.Size() == snapshot->GetMarkerCount(),
+                "Snapshot count: expected %d, actual = %d", allMarkers.Size(),
+                snapshot->GetMarkerCount());
+
+  for (const MapMarkerFilter& filter : filters) {
+    MapMarkerColumns expected;
+    markerAdapter.GetMapMarkersByFilter(filter, expected);
+
+    MapMarkerColumns actual;
+    snapshot->GetMapMarkersByFilter(filter, actual);
+
+    TF_assert_msg(state, GetSortedIds(expected) == GetSortedIds(actual),
+                  "Snapshot markers: expected %d, actual = %d", expected.Size(), actual.Size());
+  }
+
+  snapshot.reset();
+  FileUtil::Delete(SnapshotPath);
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a snapshot finds markers spread over many
+//!         cells and rows of its grid, field by field, including
+//!         in a box crossing the antimeridian.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.markersnapshot.get_map_markers_grid") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  LastUpdateInfoType lastUpdateInfo;
+  lastUpdateInfo.mMarkerLastUpdate = 1527084005;
+
+  // Every 10 degrees, the grid cells being under 3 degrees wide, plus markers by the antimeridian.
+  std::vector<scposn_type> positions;
+  for (int lat = -80; lat <= 80; lat += 10) {
+    for (int lon = -175; lon <= 175; lon += 10) {
+      positions.push_back(GetPosition(lat + 0.5, lon + 0.25));
+    }
+
+    positions.push_back(GetPosition(lat + 0.5, 179.9));
+    positions.push_back(GetPosition(lat + 0.5, -179.9));
+  }
+
+  MapMarkerColumns allMarkers;
+  for (size_t i = 0; i < positions.size(); i++) {
+    const bool isMarina = (i % 2) == 0;
+    const std::string name = "Marker " + std::to_string(i);
+
+    allMarkers.Add(static_cast<ACDB_marker_idx_type>(i + 1), isMarina ? ACDB_MARINA : ACDB_HAZARD,
+                   1527084000 + i, name.c_str(), name.size(), positions[i],
+                   isMarina ? MapIconType::Marina : MapIconType::Hazard);
+  }
+
+  TF_assert(state, MarkerSnapshot::Write(SnapshotPath, Version{SnapshotVersion}, lastUpdateInfo,
+                                         allMarkers, std::string{},
+                                         std::vector<TranslationDataType>{}));
+
+  std::vector<MapMarkerFilter> filters{
+      MapMarkerFilter(GetBbox(-35.0, -65.0, 45.0, 25.0), ACDB_ALL_TYPES),
+      MapMarkerFilter(GetBbox(-35.0, -65.0, 45.0, 25.0), ACDB_MARINA),
+      MapMarkerFilter(GetBbox(-25.0, 170.0, 25.0, -170.0), ACDB_ALL_TYPES),
+      MapMarkerFilter(GetBbox(-90.0, -180.0, 90.0, 179.99), ACDB_ALL_TYPES)};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  std::unique_ptr<MarkerSnapshot> snapshot =
+      MarkerSnapshot::Open(SnapshotPath, Version{SnapshotVersion}, lastUpdateInfo);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, nullptr != snapshot, "Snapshot: unexpected nullptr");
+  if (snapshot) {
+    for (size_t i = 0; i < filters.size(); i++) {
+      const MapMarkerColumns expected = GetMatching(allMarkers, filters[i]);
+
+      MapMarkerColumns actual;
+      snapshot->GetMapMarkersByFilter(filters[i], actual);
+
+      TF_assert_msg(state, expected.Size() > 1, "Snapshot filter %d: too few markers", i);
+      TF_assert_msg(state, IsSameMarkers(expected, actual),
+                    "Snapshot filter %d: expected %d markers, actual = %d", i, expected.Size(),
+                    actual.Size());
+    }
+  }
+
+  snapshot.reset();
+  FileUtil::Delete(SnapshotPath);
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a snapshot written for another database
+//!         version or marker update is not opened.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markersnapshot.open_stale", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAdapter markerAdapter{database};
+
+  LastUpdateInfoType lastUpdateInfo;
+  lastUpdateInfo.mMarkerLastUpdate = 1527084005;
+
+  LastUpdateInfoType newerUpdateInfo;
+  newerUpdateInfo.mMarkerLastUpdate = 1527084006;
+
+  MapMarkerColumns allMarkers;
+  TF_assert(state, markerAdapter.GetAllMapMarkers(allMarkers));
+  TF_assert(state, MarkerSnapshot::Write(SnapshotPath, Version{SnapshotVersion}, lastUpdateInfo,
+                                         allMarkers, std::string{},
+                                         std::vector<TranslationDataType>{}));
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  std::unique_ptr<MarkerSnapshot> otherVersion =
+      MarkerSnapshot::Open(SnapshotPath, Version{"1.2.3.5"}, lastUpdateInfo);
+  std::unique_ptr<MarkerSnapshot> otherUpdate =
+      MarkerSnapshot::Open(SnapshotPath, Version{SnapshotVersion}, newerUpdateInfo);
+  std::unique_ptr<MarkerSnapshot> missing =
+      MarkerSnapshot::Open(SnapshotPath + ".missing", Version{SnapshotVersion}, lastUpdateInfo);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, nullptr == otherVersion, "Snapshot: opened for another version");
+  TF_assert_msg(state, nullptr == otherUpdate, "Snapshot: opened for another update");
+  TF_assert_msg(state, nullptr == missing, "Snapshot: opened a missing file");
+
+  FileUtil::Delete(SnapshotPath);
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test reading the translations kept in a snapshot.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.markersnapshot.get_translations") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  LastUpdateInfoType lastUpdateInfo;
+  lastUpdateInfo.mMarkerLastUpdate = 1527084005;
+
+  std::vector<TranslationDataType> expected{{1, "pt_BR [1]"}, {2, "pt_BR [2]"}, {4096, ""}};
+
+  TF_assert(state, MarkerSnapshot::Write(SnapshotPath, Version{SnapshotVersion}, lastUpdateInfo,
+                                         MapMarkerColumns{}, "pt_BR", expected));
+
+  std::unique_ptr<MarkerSnapshot> snapshot =
+      MarkerSnapshot::Open(SnapshotPath, Version{SnapshotVersion}, lastUpdateInfo);
+  TF_assert_msg(state, nullptr != snapshot, "Snapshot: unexpected nullptr");
+
+  std::vector<TranslationDataType> actual;
+  std::vector<TranslationDataType> otherLanguage;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  bool found = snapshot->GetTranslations("pt_BR", actual);
+  bool otherFound = snapshot->GetTranslations("en_US", otherLanguage);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, found, "Translations: not found");
+  TF_assert_msg(state, expected == actual, "Translations: expected %d, actual = %d",
+                expected.size(), actual.size());
+  TF_assert_msg(state, !otherFound, "Translations: found for another language");
+  TF_assert_msg(state, otherLanguage.empty(), "Translations: unexpected output");
+
+  snapshot.reset();
+  FileUtil::Delete(SnapshotPath);
+}
+
+#if (acdb_MARKER_SNAPSHOT_SUPPORT)
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that the repository deletes its snapshot when the
+//!         database is written, and writes it again on close.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markersnapshot.repository_rewrite", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  {
+    auto database = CreateDatabase(state, DatabasePath);
+    PopulateDatabase(state, database);
+  }
+
+  Repository repository{DatabasePath};
+
+  // Without a snapshot, closing writes one.
+  TF_assert(state, repository.Open());
+  repository.Close();
+  const bool writtenOnClose = FileUtil::Exists(DatabasePath + SnapshotExt);
+
+  TF_assert(state, repository.Open());
+  const bool keptOnOpen = FileUtil::Exists(DatabasePath + SnapshotExt);
+
+  std::vector<MarkerTableDataCollection> markerUpdates;
+  markerUpdates.push_back(GetMarkerTableDataCollection());
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  const bool updated = repository.ApplyMarkerUpdateToDb(std::move(markerUpdates), nullptr);
+  const bool droppedOnWrite = !FileUtil::Exists(DatabasePath + SnapshotExt);
+
+  repository.Close();
+  const bool rewrittenOnClose = FileUtil::Exists(DatabasePath + SnapshotExt);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, writtenOnClose, "Snapshot not written on close");
+  TF_assert_msg(state, keptOnOpen, "Snapshot not kept on open");
+  TF_assert_msg(state, updated, "Marker update");
+  TF_assert_msg(state, droppedOnWrite, "Snapshot kept after a write");
+  TF_assert_msg(state, rewrittenOnClose, "Snapshot not rewritten on close");
+
+  FileUtil::Delete(DatabasePath);
+  FileUtil::Delete(DatabasePath + SnapshotExt);
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that installing tile databases, by merging them or
+//!         by replacing the database with a newer version, leaves
+//!         no snapshot of the tile databases behind, and only the
+//!         open database writes one on close.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.markersnapshot.install_tile", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  {
+    auto database = CreateDatabase(state, DatabasePath);
+    PopulateDatabase(state, database);
+  }
+
+  Repository repository{DatabasePath};
+  TF_assert(state, repository.Open());
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  {
+    auto tileDatabase = CreateDatabase(state, TileDatabasePath);
+    PopulateDatabase(state, tileDatabase);
+    PopulateMustacheTemplatesTable(state, tileDatabase);
+  }
+
+  const bool merged = repository.InstallSingleTileDatabase(TileDatabasePath, TileXY(0, 0));
+  const bool mergeSnapshotLeft = FileUtil::Exists(TileDatabasePath + SnapshotExt);
+
+  {
+    auto tileDatabase = CreateDatabase(state, TileDatabasePath);
+    PopulateDatabase(state, tileDatabase);
+    PopulateMustacheTemplatesTable(state, tileDatabase);
+
+    VersionQuery versionQuery{tileDatabase};
+    TF_assert(state, versionQuery.Put("2.1.0.0"));
+  }
+
+  const bool replaced = repository.InstallSingleTileDatabase(TileDatabasePath, TileXY(0, 0));
+  const bool replaceSnapshotLeft = FileUtil::Exists(TileDatabasePath + SnapshotExt) ||
+                                   FileUtil::Exists(DatabasePath + SnapshotExt);
+
+  repository.Close();
+  const bool writtenOnClose = FileUtil::Exists(DatabasePath + SnapshotExt);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, merged, "Tile merge");
+  TF_assert_msg(state, !mergeSnapshotLeft, "Snapshot of the merged tile left");
+  TF_assert_msg(state, replaced, "Tile install");
+  TF_assert_msg(state, !replaceSnapshotLeft, "Snapshot left by the version update");
+  TF_assert_msg(state, writtenOnClose, "Snapshot not written on close");
+
+  FileUtil::Delete(DatabasePath);
+  FileUtil::Delete(DatabasePath + SnapshotExt);
+  FileUtil::Delete(TileDatabasePath);
+  FileUtil::Delete(TileDatabasePath + SnapshotExt);
+}
+#endif
+
+}  // end of namespace Test
+}  // end of namespace Acdb
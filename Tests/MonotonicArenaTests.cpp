@@ -0,0 +1,137 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+
+/**
+    @file
+    @brief Regression tests for MonotonicArena
+
+    Copyright 2022 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "MonotonicArenaTests"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Acdb/MonotonicArena.hpp"
+#include "Acdb/Presentation/Field/LinkField.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that presentation objects are allocated from the
+//!         arena of the current scope only.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.monotonicarena.arena_scope") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  MonotonicArena arena;
+  const size_t expected = 50;
+
+  std::vector<std::unique_ptr<Presentation::LinkField>> inScope;
+  std::unique_ptr<Presentation::LinkField> outOfScope;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  {
+    ArenaScope arenaScope{arena};
+    for (size_t i = 0; i < expected; i++) {
+      inScope.emplace_back(new Presentation::LinkField("acdb://summary/" + std::to_string(i),
+                                                       "Summary"));
+    }
+  }
+
+  outOfScope.reset(new Presentation::LinkField("acdb://summary/0", "Summary"));
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, ArenaScope::GetCurrent() == nullptr, "MonotonicArena: scope not restored");
+  TF_assert_msg(state, arena.GetAllocationCount() == expected,
+                "MonotonicArena: expected %d allocations, actual = %d", expected,
+                arena.GetAllocationCount());
+  TF_assert_msg(state, arena.GetBlockCount() == 1, "MonotonicArena: expected 1 block, actual = %d",
+                arena.GetBlockCount());
+  TF_assert_msg(state, *inScope[0] == *outOfScope, "MonotonicArena: arena object differs");
+
+  // Deleting objects runs their destructors and leaves the arena memory alone.
+  inScope.clear();
+  outOfScope.reset();
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that the arena counts its live objects, which must
+//!         be none when it is destroyed, and not heap objects.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.monotonicarena.live_objects") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  MonotonicArena arena;
+  const size_t created = 3;
+
+  std::vector<std::unique_ptr<Presentation::LinkField>> inScope;
+  std::unique_ptr<Presentation::LinkField> outOfScope;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  {
+    ArenaScope arenaScope{arena};
+    for (size_t i = 0; i < created; i++) {
+      inScope.emplace_back(new Presentation::LinkField("acdb://summary/" + std::to_string(i),
+                                                       "Summary"));
+    }
+  }
+
+  outOfScope.reset(new Presentation::LinkField("acdb://summary/0", "Summary"));
+  const size_t liveCreated = arena.GetLiveObjectCount();
+
+  inScope.pop_back();
+  const size_t liveDeleted = arena.GetLiveObjectCount();
+
+  inScope.clear();
+  const size_t liveCleared = arena.GetLiveObjectCount();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, liveCreated == created, "MonotonicArena: expected %d live, actual = %d",
+                created, liveCreated);
+  TF_assert_msg(state, liveDeleted == created - 1,
+                "MonotonicArena: expected %d live, actual = %d", created - 1, liveDeleted);
+  TF_assert_msg(state, liveCleared == 0, "MonotonicArena: expected none live, actual = %d",
+                liveCleared);
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
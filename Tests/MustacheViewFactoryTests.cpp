@@ -0,0 +1,105 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for the MustacheViewFactory
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "MustacheViewFactoryTests"
+
+#include "Acdb/FileUtil.hpp"
+#include "Acdb/Presentation/MustacheViewFactory.hpp"
+#include "Acdb/Presentation/PresentationMarker.hpp"
+#include "Acdb/Presentation/ReviewList.hpp"
+#include "Acdb/Repository.hpp"
+#include "Acdb/Tests/DatabaseUtil.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+static const std::string DatabasePath{"MustacheViewFactoryTests.db"};
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that rendering the content views on several
+//!         threads gives the same views as rendering them on
+//!         the calling thread.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.mustacheviewfactory.get_content_view_map_parallel", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  {
+    auto database = CreateDatabase(state, DatabasePath);
+    PopulateDatabase(state, database);
+    PopulateMustacheTemplatesTable(state, database);
+  }
+
+  RepositoryPtr repositoryPtr = std::make_shared<Repository>(DatabasePath);
+  TF_assert(state, repositoryPtr->Open());
+
+  ACDB_marker_idx_type markerId = GetMarkerTableDataCollection().mMarker.mId;
+  auto presentationMarkerPtr = repositoryPtr->GetPresentationMarker(markerId);
+  auto reviewListPtr = repositoryPtr->GetReviewList(markerId, 1, 10);
+  TF_assert(state, presentationMarkerPtr != nullptr);
+  TF_assert(state, reviewListPtr != nullptr);
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  Presentation::SetContentViewThreadCount(1);
+  ContentViewMapPtr serialPtr =
+      Presentation::GetContentViewMap(*presentationMarkerPtr, reviewListPtr, repositoryPtr);
+
+  Presentation::SetContentViewThreadCount(4);
+  ContentViewMapPtr parallelPtr =
+      Presentation::GetContentViewMap(*presentationMarkerPtr, reviewListPtr, repositoryPtr);
+
+  Presentation::SetContentViewThreadCount(1);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert(state, serialPtr != nullptr);
+  TF_assert(state, parallelPtr != nullptr);
+
+  // Every section of the test marker has data, so each view is rendered.
+  TF_assert(state, serialPtr->size() == 6);
+  TF_assert(state, *serialPtr == *parallelPtr);
+
+  const std::string& generalInformation = serialPtr->at(ContentViewGeneralInformation);
+  TF_assert(state, generalInformation.find("[PointOfInterest]") == 0);
+  TF_assert(state, generalInformation.find("[Business]Business") != std::string::npos);
+  TF_assert(state, serialPtr->at(ContentViewFuel) == "[Fuel]Fuel");
+  TF_assert(state, serialPtr->at(ContentViewUserReview) == "[Reviews]Reviews");
+
+  // Closing the main database leaves a marker snapshot beside it.
+  repositoryPtr->Close();
+  FileUtil::Delete(DatabasePath);
+  FileUtil::Delete(DatabasePath + ".snapshot");
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
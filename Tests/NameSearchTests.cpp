@@ -0,0 +1,161 @@
+/*------------------------------------------------------------------------------
+Copyright 2022 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for NameSearch
+
+    Copyright 2022 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "NameSearchTests"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Acdb/NameSearch.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test Normalize.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.namesearch.normalize") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  std::vector<std::string> inputs = {
+      "Test Marina 10",                      // ASCII
+      "  --Marina,   del Rey!  ",            // punctuation and white space
+      "Mari\xC3\xB1" "a \xC3\x89lan",        // precomposed diacritics
+      "Marin\xCC\x83" "a",                   // combining diacritic
+      "\xC3\x86R\xC3\x98 Stra\xC3\x9F" "e",  // letters folding to two letters
+      "Bob's Dock, Bob\xE2\x80\x99s Fuel",   // apostrophes
+      "\xD0\x9C\xD0\x9E\xD0\xA0\xD0\x95",    // Cyrillic
+      "bad\xFF" "byte"                       // malformed UTF-8
+  };
+
+  std::vector<std::string> expected = {
+      "test marina 10",                    // ASCII
+      "marina del rey",                    // punctuation and white space
+      "marina elan",                       // precomposed diacritics
+      "marina",                            // combining diacritic
+      "aero strasse",                      // letters folding to two letters
+      "bobs dock bobs fuel",               // apostrophes
+      "\xD0\xBC\xD0\xBE\xD1\x80\xD0\xB5",  // Cyrillic
+      "bad byte"                           // malformed UTF-8
+  };
+
+  std::vector<std::string> actual;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  for (const auto& input : inputs) {
+    actual.push_back(NameSearch::Normalize(input));
+  }
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    TF_assert_msg(state, expected[i] == actual[i], "NameSearch: Normalize %d", i);
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test GetMatchDistance.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.namesearch.match_distance") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  struct TestCase {
+    std::string mQuery;
+    std::string mName;
+    uint32_t mExpected;
+  };
+
+  std::vector<TestCase> testCases = {
+      {"marina", "test marina 1", 0},                    // exact word
+      {"mar", "test marina 1", 0},                       // beginning of word
+      {"test mari", "test marina 1", 0},                 // several words
+      {"hazrd", "test hazard 1", 1},                     // missing letter
+      {"tset", "test hazard 1", 1},                      // transposed letters
+      {"marnia bya", "marina bay", 2},                   // one edit in each word
+      {"harbor", "aero harbour", 1},                     // edit in a longer word
+      {"ab", "ac marina", NameSearch::NoMatch},          // no edits in short words
+      {"marina", "test hazard 1", NameSearch::NoMatch},  // no matching word
+      {"hzrdx", "test hazard 1", NameSearch::NoMatch},   // too many edits
+  };
+
+  // ----------------------------------------------------------
+  // Act / Assert
+  // ----------------------------------------------------------
+  for (const auto& testCase : testCases) {
+    uint32_t actual = NameSearch::GetMatchDistance(testCase.mQuery, testCase.mName);
+    TF_assert_msg(state, testCase.mExpected == actual,
+                  "NameSearch: GetMatchDistance(%s, %s) expected %u, actual = %u",
+                  testCase.mQuery.c_str(), testCase.mName.c_str(), testCase.mExpected, actual);
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test GetTrigrams.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.namesearch.trigrams") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  // " ma", "mar", "ari", "rin", "ina", "na ", " 1 "; "marina" twice adds nothing.
+  const size_t expected = 7;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  std::vector<int64_t> actual = NameSearch::GetTrigrams("marina 1 marina");
+  std::vector<int64_t> shared = NameSearch::GetTrigrams("marina");
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected == actual.size(), "NameSearch: expected %d trigrams, actual = %d",
+                expected, actual.size());
+  for (const int64_t trigram : shared) {
+    TF_assert_msg(state, std::binary_search(actual.begin(), actual.end(), trigram),
+                  "NameSearch: missing trigram");
+  }
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
@@ -24,6 +24,9 @@ limitations under the License.
 #define DBG_MODULE "Acdb"
 #define DBG_TAG "NavDateTimeExtensionsTests"
 
+#include <string>
+#include <vector>
+
 #include "NavDateTime.h"
 #include "NavDateTimeExtensions.hpp"
 #include "TF_pub.h"
@@ -85,5 +88,95 @@ TF_TEST("navdatetime.extensions.to_epoch") {
   TF_assert_msg(state, expectedUnixEpoch == actualUnixEpoch, "NavDateTimeToEpoch, Unix");
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test converting ISO 8601 strings directly to epoch,
+//!         compared against NavDateTime.
+//!
+//----------------------------------------------------------------
+TF_TEST("navdatetime.extensions.iso8601_to_epoch") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  const std::vector<std::string> validInputs{
+      "1970-01-01T00:00:00Z", "2018-05-23T09:30:01Z", "2000-02-29T23:59:59Z",
+      "2037-12-31T12:00:00Z", "2018-05-23T09:30:01.250Z"};
+
+  const std::vector<std::string> invalidInputs{
+      "", "2018-05-23", "2018-05-23T09:30:01", "2018-13-01T00:00:00Z", "2019-02-29T00:00:00Z",
+      "2018-05-23T24:00:00Z", "2018-05-23 09:30:01Z", "1969-12-31T23:59:59Z"};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  std::vector<uint64_t> expected;
+  std::vector<uint64_t> actual;
+
+  for (const std::string& input : validInputs) {
+    NavDateTime dateTime;
+    dateTime.FromString(input, input.size() == 20 ? YYYYMMDDTHHMMSSZ_FORMAT
+                                                  : YYYYMMDDTHHMMSSMMMZ_FORMAT);
+    expected.push_back(NavDateTimeExtensions::NavDateTimeToEpoch(dateTime, UNIX_EPOCH));
+
+    uint64_t epoch = 0;
+    NavDateTimeExtensions::Iso8601ToEpoch(input.c_str(), input.size(), UNIX_EPOCH, epoch);
+    actual.push_back(epoch);
+  }
+
+  bool anyInvalidAccepted = false;
+  for (const std::string& input : invalidInputs) {
+    uint64_t epoch = 0;
+    anyInvalidAccepted |=
+        NavDateTimeExtensions::Iso8601ToEpoch(input.c_str(), input.size(), UNIX_EPOCH, epoch);
+  }
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected == actual, "Iso8601ToEpoch, Unix");
+  TF_assert_msg(state, !anyInvalidAccepted, "Iso8601ToEpoch, invalid input");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test civil date/time round trip through epoch.
+//!
+//----------------------------------------------------------------
+TF_TEST("navdatetime.extensions.civil_round_trip") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  // EpochToNavDateTime takes an int number of seconds.
+  const uint64_t lastEpoch = 2147483647;  // 2038-01-19T03:14:07Z
+  const uint64_t step = 86400 * 7 + 3607;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  bool allMatch = true;
+  for (uint64_t epoch = 0; epoch <= lastEpoch; epoch += step) {
+    CivilDateTime civil;
+    NavDateTimeExtensions::EpochToCivilDateTime(UNIX_EPOCH, epoch, civil);
+
+    NavDateTime dateTime = NavDateTimeExtensions::EpochToNavDateTime(UNIX_EPOCH, epoch);
+    unsigned int day, month, year, hour, minute, second;
+    dateTime.GetDate(day, month, year);
+    dateTime.GetTimeOfDay(hour, minute, second);
+
+    allMatch &= civil.mYear == year && civil.mMonth == month && civil.mDay == day &&
+                civil.mHour == hour && civil.mMinute == minute && civil.mSecond == second &&
+                NavDateTimeExtensions::CivilDateTimeToEpoch(civil, UNIX_EPOCH) == epoch;
+  }
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, allMatch, "CivilDateTime round trip, Unix");
+}
+
 }  // end of namespace Test
 }  // end of namespace Acdb
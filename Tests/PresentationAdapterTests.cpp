@@ -584,6 +584,56 @@ TF_TEST_AUTO_SLOW("acdb.presentationadapter.get_presentation_marker_invalid", 30
   TF_assert_msg(state, nullptr == actual, "PresentationMarker: expected nullptr");
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test retrieving presentation marker with only the
+//!         requested sections loaded.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.presentationadapter.get_presentation_marker_sections", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  PresentationAdapter presentationAdapter{database};
+
+  SettingsUtil settingsUtil{};
+  TranslationUtil translationUtil{state};
+
+  PresentationMarkerPtr expected = GetExpectedPresentationMarker(state);
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  PresentationMarkerPtr actual = presentationAdapter.GetMarkerSections(1, SectionType::Amenities);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, actual != nullptr, "PresentationMarker: Unexpected nullptr");
+  TF_assert_msg(state, expected->GetId() == actual->GetId(), "PresentationMarker: ID");
+  TF_assert_msg(state, actual->GetAmenities() != nullptr,
+                "PresentationMarker: Amenities unexpected nullptr");
+  TF_assert_msg(state, *(expected->GetAmenities()) == *(actual->GetAmenities()),
+                "PresentationMarker: Amenities");
+  TF_assert_msg(state, actual->GetAddress() == nullptr, "PresentationMarker: Address");
+  TF_assert_msg(state, actual->GetBusiness() == nullptr, "PresentationMarker: Business");
+  TF_assert_msg(state, actual->GetCompetitorAd() == nullptr, "PresentationMarker: CompetitorAd");
+  TF_assert_msg(state, actual->GetContact() == nullptr, "PresentationMarker: Contact");
+  TF_assert_msg(state, actual->GetDockage() == nullptr, "PresentationMarker: Dockage");
+  TF_assert_msg(state, actual->GetFuel() == nullptr, "PresentationMarker: Fuel");
+  TF_assert_msg(state, actual->GetMoorings() == nullptr, "PresentationMarker: Moorings");
+  TF_assert_msg(state, actual->GetNavigation() == nullptr, "PresentationMarker: Navigation");
+  TF_assert_msg(state, actual->GetRetail() == nullptr, "PresentationMarker: Retail");
+  TF_assert_msg(state, actual->GetReviewDetail() == nullptr, "PresentationMarker: ReviewDetail");
+  TF_assert_msg(state, actual->GetServices() == nullptr, "PresentationMarker: Services");
+}
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -0,0 +1,288 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for QueryControl
+
+    Copyright 2022 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "QueryControlTests"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Acdb/FileUtil.hpp"
+#include "Acdb/QueryControlScope.hpp"
+#include "Acdb/Repository.hpp"
+#include "Acdb/SearchMarkerFilter.hpp"
+#include "Acdb/Tests/DatabaseUtil.hpp"
+#include "Acdb/Tests/TranslationUtil.hpp"
+#include "DBG_pub.h"
+#include "SQLiteCpp/Statement.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+static const std::string CountSql{
+    "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c WHERE x < ?) "
+    "SELECT COUNT(*) FROM c;"};
+
+static const std::string DatabasePath{"QueryControlTests.db"};
+
+static const int LongCount = 100000000;  // far longer than any test should take
+static const int ShortCount = 10000;
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail
+//!         Count to aCount in SQL under aQueryControl.
+//!
+//!   @return false if the count was interrupted
+//!
+//----------------------------------------------------------------
+static bool RunCount(SQLite::Database& aDatabase, const QueryControl* aQueryControl,
+                     const int aCount, int& aResultOut, bool& aWasInterruptedOut) {
+  QueryControlScope queryControlScope{aQueryControl};
+  bool success = false;
+
+  try {
+    SQLite::Statement count{aDatabase, CountSql};
+    count.bind(1, aCount);
+
+    success = count.executeStep();
+    if (success) {
+      aResultOut = count.getColumn(0).getInt();
+    }
+  } catch (const SQLite::Exception&) {
+    // Interrupted reads fail with SQLITE_INTERRUPT.
+    success = false;
+  }
+
+  aWasInterruptedOut = queryControlScope.WasInterrupted();
+  return success;
+}  // end of RunCount
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a cancelled QueryControl interrupts a read,
+//!         and that reads without one are not interrupted.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.querycontrol.cancel") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+  SetQueryControlHandler(database);
+
+  QueryControl cancelled;
+  cancelled.Cancel();
+
+  int cancelledResult = 0;
+  bool cancelledInterrupted = false;
+  int uncontrolledResult = 0;
+  bool uncontrolledInterrupted = true;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  bool cancelledSuccess =
+      RunCount(database, &cancelled, LongCount, cancelledResult, cancelledInterrupted);
+  bool uncontrolledSuccess =
+      RunCount(database, nullptr, ShortCount, uncontrolledResult, uncontrolledInterrupted);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, !cancelledSuccess, "QueryControl: cancelled read not interrupted");
+  TF_assert_msg(state, cancelledInterrupted,
+                "QueryControl: cancelled read not reported interrupted");
+  TF_assert_msg(state, uncontrolledSuccess, "QueryControl: read without QueryControl interrupted");
+  TF_assert_msg(state, uncontrolledResult == ShortCount,
+                "QueryControl: read without QueryControl miscounted");
+  TF_assert_msg(state, !uncontrolledInterrupted,
+                "QueryControl: read without QueryControl reported interrupted");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a QueryControl interrupts reads still running
+//!         at its deadline.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.querycontrol.deadline") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+  SetQueryControlHandler(database);
+
+  const QueryControl::Clock::time_point now = QueryControl::Clock::now();
+  QueryControl imminent{now + std::chrono::milliseconds(10)};
+  QueryControl distant{now + std::chrono::hours(1)};
+
+  int imminentResult = 0;
+  bool imminentInterrupted = false;
+  int distantResult = 0;
+  bool distantInterrupted = true;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  bool imminentSuccess =
+      RunCount(database, &imminent, LongCount, imminentResult, imminentInterrupted);
+  bool distantSuccess = RunCount(database, &distant, ShortCount, distantResult, distantInterrupted);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, !imminentSuccess, "QueryControl: read past deadline not interrupted");
+  TF_assert_msg(state, imminentInterrupted,
+                "QueryControl: read past deadline not reported interrupted");
+  TF_assert_msg(state, distantSuccess, "QueryControl: read before deadline interrupted");
+  TF_assert_msg(state, distantResult == ShortCount,
+                "QueryControl: read before deadline miscounted");
+  TF_assert_msg(state, !distantInterrupted,
+                "QueryControl: read before deadline reported interrupted");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a read finishing before its deadline is not
+//!         reported interrupted once the deadline has passed.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.querycontrol.deadline_after_read") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+  SetQueryControlHandler(database);
+
+  const std::chrono::milliseconds timeout{200};
+  QueryControl queryControl{QueryControl::Clock::now() + timeout};
+
+  bool success = false;
+  bool interrupted = true;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  {
+    QueryControlScope queryControlScope{&queryControl};
+
+    SQLite::Statement count{database, CountSql};
+    count.bind(1, ShortCount);
+    success = count.executeStep() && count.getColumn(0).getInt() == ShortCount;
+
+    // The deadline passes after the read, before the caller checks it.
+    std::this_thread::sleep_for(timeout);
+    interrupted = queryControlScope.WasInterrupted();
+  }
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, success, "QueryControl: read interrupted");
+  TF_assert_msg(state, queryControl.IsStopped(), "QueryControl: deadline not passed");
+  TF_assert_msg(state, !interrupted, "QueryControl: complete read reported interrupted");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a route search through the repository stops
+//!         at a cancelled QueryControl and reports it, and that a
+//!         search without one is complete.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.querycontrol.repository_route", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  TranslationUtil translationUtil{state};
+
+  {
+    auto database = CreateDatabase(state, DatabasePath);
+    PopulateDatabase(state, database);
+  }
+
+  RepositoryPtr repositoryPtr = std::make_shared<Repository>(DatabasePath);
+  TF_assert(state, repositoryPtr->Open());
+
+  // Two legs, so that a stop is seen between them even if no read runs long enough to be
+  // interrupted.
+  const std::vector<scposn_type> route{{0, 0}, {0, 250}, {0, 1000}};
+  const double bufferMeters = 3.0;
+
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+
+  QueryControl cancelled;
+  cancelled.Cancel();
+
+  std::vector<RouteSearchMarker> actualCancelled;
+  std::vector<RouteSearchMarker> actualUncontrolled;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  const bool cancelledComplete = repositoryPtr->GetSearchMarkersAlongRoute(
+      route, bufferMeters, markerFilter,
+      [&actualCancelled](RouteSearchMarker&& aResult) {
+        actualCancelled.push_back(std::move(aResult));
+        return true;
+      },
+      &cancelled);
+  const bool uncontrolledComplete = repositoryPtr->GetSearchMarkersAlongRoute(
+      route, bufferMeters, markerFilter, [&actualUncontrolled](RouteSearchMarker&& aResult) {
+        actualUncontrolled.push_back(std::move(aResult));
+        return true;
+      });
+
+  repositoryPtr->Close();
+  FileUtil::Delete(DatabasePath);
+  FileUtil::Delete(DatabasePath + ".snapshot");
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  // Markers 1, 2, 21, 22 and 3 are within the buffer, as in the marker adapter route test.
+  TF_assert_msg(state, !cancelledComplete, "QueryControl: cancelled route search complete");
+  TF_assert_msg(state, actualCancelled.size() <= actualUncontrolled.size(),
+                "QueryControl: cancelled route search results %d", actualCancelled.size());
+  TF_assert_msg(state, uncontrolledComplete, "QueryControl: route search stopped");
+  TF_assert_msg(state, actualUncontrolled.size() == 5,
+                "QueryControl: route search results %d", actualUncontrolled.size());
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
@@ -0,0 +1,212 @@
+/*------------------------------------------------------------------------------
+Copyright 2022 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for QueryStatsRegistry
+
+    Copyright 2022 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "QueryStatsRegistryTests"
+
+#include <string>
+
+#include "Acdb/QueryStatsRegistry.hpp"
+#include "Acdb/Tests/DatabaseUtil.hpp"
+#include "DBG_pub.h"
+#include "SQLiteCpp/Statement.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+static const std::string CountSql{
+    "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c WHERE x < 3) "
+    "SELECT x FROM c;"};
+
+static const std::string OtherSql{"SELECT 1;"};
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get the runs of aSql in aStats, or 0 if never run.
+//!
+//----------------------------------------------------------------
+static uint64_t GetCallCount(const PerformanceStats& aStats, const std::string& aSql) {
+  for (const auto& stats : aStats) {
+    if (stats.mSql == aSql) {
+      return stats.mCallCount;
+    }
+  }
+
+  return 0;
+}  // end of GetCallCount
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that every run of a statement is counted with its
+//!         rows, including a run reset before it finished.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.querystatsregistry.get_stats") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  QueryStatsRegistry queryStats;
+  queryStats.Attach(database);
+
+  SQLite::Statement count{database, CountSql};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  // Two full runs of three rows, then one row of a third run.
+  for (int i = 0; i < 2; i++) {
+    while (count.executeStep()) {
+    }
+
+    count.reset();
+  }
+
+  count.executeStep();
+  count.reset();
+
+  PerformanceStats actual = queryStats.GetStats();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  const QueryStats* countStats = nullptr;
+  for (const auto& stats : actual) {
+    if (stats.mSql == CountSql) {
+      countStats = &stats;
+    }
+  }
+
+  TF_assert_msg(state, countStats != nullptr, "QueryStats: statement not recorded");
+  if (countStats != nullptr) {
+    TF_assert_msg(state, countStats->mCallCount == 3, "QueryStats: expected 3 runs, actual = %d",
+                  countStats->mCallCount);
+    TF_assert_msg(state, countStats->mRowCount == 7, "QueryStats: expected 7 rows, actual = %d",
+                  countStats->mRowCount);
+    TF_assert_msg(state, countStats->mBusyCount == 0, "QueryStats: unexpected busy database");
+    TF_assert_msg(state, countStats->mP50Microseconds <= countStats->mP95Microseconds,
+                  "QueryStats: p50 above p95");
+    TF_assert_msg(state, countStats->mP95Microseconds <= countStats->mP99Microseconds,
+                  "QueryStats: p95 above p99");
+    TF_assert_msg(state, countStats->mP99Microseconds <= countStats->mMaxMicroseconds,
+                  "QueryStats: p99 above max");
+    TF_assert_msg(state, countStats->mMaxMicroseconds <= countStats->mTotalMicroseconds,
+                  "QueryStats: max above total");
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a statement prepared after another one was
+//!         finalized is recorded under its own SQL, even if it
+//!         reuses the address of the finalized one.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.querystatsregistry.get_stats_finalized") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  QueryStatsRegistry queryStats;
+  queryStats.Attach(database);
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  for (int i = 0; i < 2; i++) {
+    {
+      SQLite::Statement count{database, CountSql};
+      count.executeStep();
+    }
+
+    SQLite::Statement other{database, OtherSql};
+    other.executeStep();
+  }
+
+  PerformanceStats actual = queryStats.GetStats();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, GetCallCount(actual, CountSql) == 2,
+                "QueryStats: expected 2 count runs, actual = %d",
+                static_cast<int>(GetCallCount(actual, CountSql)));
+  TF_assert_msg(state, GetCallCount(actual, OtherSql) == 2,
+                "QueryStats: expected 2 other runs, actual = %d",
+                static_cast<int>(GetCallCount(actual, OtherSql)));
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that the runs after detaching the database are
+//!         not recorded, and the earlier ones are kept.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.querystatsregistry.detach") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  QueryStatsRegistry queryStats;
+  queryStats.Attach(database);
+
+  SQLite::Statement other{database, OtherSql};
+  other.executeStep();
+  other.reset();
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  queryStats.Detach(database);
+
+  other.executeStep();
+  other.reset();
+
+  SQLite::Statement count{database, CountSql};
+  count.executeStep();
+
+  PerformanceStats actual = queryStats.GetStats();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, GetCallCount(actual, OtherSql) == 1,
+                "QueryStats: expected 1 run, actual = %d",
+                static_cast<int>(GetCallCount(actual, OtherSql)));
+  TF_assert_msg(state, GetCallCount(actual, CountSql) == 0,
+                "QueryStats: detached statement recorded");
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
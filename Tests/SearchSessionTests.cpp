@@ -0,0 +1,297 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for the SearchSession
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "SearchSessionTests"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Acdb/FileUtil.hpp"
+#include "Acdb/Repository.hpp"
+#include "Acdb/SearchSession.hpp"
+#include "Acdb/Tests/DatabaseUtil.hpp"
+#include "Acdb/Tests/TranslationUtil.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+static const std::string DatabasePath{"SearchSessionTests.db"};
+
+//! Appended to the name of the test marker between the two searches
+static const std::string RenamedSuffix{" Renamed"};
+
+enum class SecondSearch { Refined, Requeried, MissedMarker };
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Get a filter matching the test markers by name.
+//!
+//----------------------------------------------------------------
+static SearchMarkerFilter GetFilter(
+    const std::string& aSearchString,
+    const SearchMarkerFilter::StringMatchMode aMatchMode = SearchMarkerFilter::MatchSubstring) {
+  bbox_type bbox;
+  bbox.swc = {0, 0};
+  bbox.nec = {1000, 1000};
+
+  SearchMarkerFilter filter;
+  filter.SetBbox(bbox);
+  filter.AddType(ACDB_MARINA);
+  filter.AddType(ACDB_HAZARD);
+  filter.SetSearchString(aSearchString, aMatchMode);
+
+  return filter;
+}  // end of GetFilter
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @detail Search aFirst and then aSecond in one session,
+//!   renaming the test marker in between.  A refined second search
+//!   filters the kept matches in memory, so it finds the old name;
+//!   a new query finds the new one.  Both searches should match
+//!   the test marker.
+//!
+//----------------------------------------------------------------
+static SecondSearch SearchTwice(TF_state_type* aState, const SearchMarkerFilter& aFirst,
+                                const SearchMarkerFilter& aSecond) {
+  {
+    auto database = CreateDatabase(aState, DatabasePath);
+    PopulateDatabase(aState, database);
+  }
+
+  RepositoryPtr repositoryPtr = std::make_shared<Repository>(DatabasePath);
+  TF_assert(aState, repositoryPtr->Open());
+
+  SearchSession searchSession{repositoryPtr};
+
+  std::vector<ISearchMarkerPtr> firstResults;
+  TF_assert(aState, searchSession.Search(aFirst, firstResults));
+
+  MarkerTableDataCollection marker = GetMarkerTableDataCollection();
+  const ACDB_marker_idx_type markerId = marker.mMarker.mId;
+  const std::string renamed = marker.mMarker.mName + RenamedSuffix;
+  marker.mMarker.mName = renamed;
+
+  std::vector<MarkerTableDataCollection> markerUpdates;
+  markerUpdates.push_back(std::move(marker));
+  TF_assert(aState, repositoryPtr->ApplyMarkerUpdateToDb(std::move(markerUpdates), nullptr));
+
+  std::vector<ISearchMarkerPtr> secondResults;
+  TF_assert(aState, searchSession.Search(aSecond, secondResults));
+
+  repositoryPtr->Close();
+  FileUtil::Delete(DatabasePath);
+  FileUtil::Delete(DatabasePath + ".snapshot");
+
+  auto result = std::find_if(
+      secondResults.begin(), secondResults.end(),
+      [markerId](const ISearchMarkerPtr& aResult) { return aResult->GetId() == markerId; });
+  if (result == secondResults.end()) {
+    return SecondSearch::MissedMarker;
+  }
+
+  return ((*result)->GetName() == renamed) ? SecondSearch::Requeried : SecondSearch::Refined;
+}  // end of SearchTwice
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that extending the search string filters the
+//!         kept matches in memory.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.searchsession.refine_extended_string", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  TranslationUtil translationUtil{state};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  SecondSearch substring = SearchTwice(state, GetFilter("marina"), GetFilter("Marina 1"));
+  SecondSearch beginningOfWord =
+      SearchTwice(state, GetFilter("Test", SearchMarkerFilter::MatchBeginningOfWord),
+                  GetFilter("test mar", SearchMarkerFilter::MatchBeginningOfWord));
+  SecondSearch shortened = SearchTwice(state, GetFilter("Marina 1"), GetFilter("Marina"));
+  SecondSearch otherMode = SearchTwice(
+      state, GetFilter("Test"), GetFilter("Test Marina", SearchMarkerFilter::MatchBeginningOfWord));
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, substring == SecondSearch::Refined, "Substring not refined");
+  TF_assert_msg(state, beginningOfWord == SecondSearch::Refined, "Beginning of word not refined");
+  TF_assert_msg(state, shortened == SecondSearch::Requeried, "Shortened string refined");
+  TF_assert_msg(state, otherMode == SecondSearch::Requeried, "Other match mode refined");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that fuzzy searches, whose matches are ranked
+//!         rather than filtered, are always queried again.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.searchsession.requery_fuzzy", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  TranslationUtil translationUtil{state};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  SecondSearch fuzzy =
+      SearchTwice(state, GetFilter("Test Marina", SearchMarkerFilter::MatchFuzzy),
+                  GetFilter("Test Marina 1", SearchMarkerFilter::MatchFuzzy));
+  SecondSearch fromFuzzy = SearchTwice(
+      state, GetFilter("Test Marina", SearchMarkerFilter::MatchFuzzy), GetFilter("Test Marina 1"));
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, fuzzy == SecondSearch::Requeried, "Fuzzy search refined");
+  TF_assert_msg(state, fromFuzzy == SecondSearch::Requeried, "Fuzzy matches refined");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that search strings with LIKE wildcards, which
+//!         do not match literally, are queried again.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.searchsession.requery_wildcards", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  TranslationUtil translationUtil{state};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  SecondSearch underscore = SearchTwice(state, GetFilter("Marina"), GetFilter("Marina_1"));
+  SecondSearch percent = SearchTwice(state, GetFilter("Test"), GetFilter("Test%1"));
+  SecondSearch fromPercent = SearchTwice(state, GetFilter("Mar%"), GetFilter("Mar%a"));
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, underscore == SecondSearch::Requeried, "'_' search refined");
+  TF_assert_msg(state, percent == SecondSearch::Requeried, "'%%' search refined");
+  TF_assert_msg(state, fromPercent == SecondSearch::Requeried, "'%%' matches refined");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a later page, which is not all of the
+//!         matches, is neither refined nor kept for refining.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.searchsession.requery_start_after", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  TranslationUtil translationUtil{state};
+
+  SearchMarkerFilter laterPage = GetFilter("Marina");
+  laterPage.SetStartAfter(1);
+
+  SearchMarkerFilter laterRefinedPage = GetFilter("Marina 1");
+  laterRefinedPage.SetStartAfter(0);
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  SecondSearch fromLaterPage = SearchTwice(state, laterPage, GetFilter("Marina 1"));
+  SecondSearch toLaterPage = SearchTwice(state, GetFilter("Marina"), laterRefinedPage);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, fromLaterPage == SecondSearch::Requeried, "Later page matches refined");
+  TF_assert_msg(state, toLaterPage == SecondSearch::Requeried, "Later page refined");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that the kept matches are only refined in the
+//!         order they were read in.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.searchsession.refine_sort_order", 30) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  TranslationUtil translationUtil{state};
+
+  SearchMarkerFilter byName = GetFilter("Marina");
+  byName.SetSortOrder(SearchMarkerFilter::SortByName);
+
+  SearchMarkerFilter refinedByName = GetFilter("Marina 1");
+  refinedByName.SetSortOrder(SearchMarkerFilter::SortByName);
+
+  SearchMarkerFilter byDistance = GetFilter("Marina");
+  byDistance.SetSortOrder(SearchMarkerFilter::SortByDistance);
+  byDistance.SetReferencePoint({100, 100});
+
+  SearchMarkerFilter refinedByDistance = GetFilter("Marina 1");
+  refinedByDistance.SetSortOrder(SearchMarkerFilter::SortByDistance);
+  refinedByDistance.SetReferencePoint({100, 100});
+
+  SearchMarkerFilter refinedByOtherDistance = refinedByDistance;
+  refinedByOtherDistance.SetReferencePoint({900, 900});
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  SecondSearch sameOrder = SearchTwice(state, byName, refinedByName);
+  SecondSearch otherOrder = SearchTwice(state, byName, GetFilter("Marina 1"));
+  SecondSearch sameReference = SearchTwice(state, byDistance, refinedByDistance);
+  SecondSearch otherReference = SearchTwice(state, byDistance, refinedByOtherDistance);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, sameOrder == SecondSearch::Refined, "Same sort order not refined");
+  TF_assert_msg(state, otherOrder == SecondSearch::Requeried, "Other sort order refined");
+  TF_assert_msg(state, sameReference == SecondSearch::Refined, "Same reference point not refined");
+  TF_assert_msg(state, otherReference == SecondSearch::Requeried, "Other reference point refined");
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
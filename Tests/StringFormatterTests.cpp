@@ -30,6 +30,7 @@ limitations under the License.
 #include "Acdb/StringUtil.hpp"
 #include "Acdb/Tests/SettingsUtil.hpp"
 #include "Acdb/Tests/TranslationUtil.hpp"
+#include "Acdb/TextHandle.hpp"
 #include "Acdb/TextTranslator.hpp"
 #include "TF_pub.h"
 #include "UTL_pub_lib_cnvt.h"
@@ -172,6 +173,53 @@ TF_TEST("acdb.stringformatter.depth") {
   }
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test StringFormatter caller-buffer overloads
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.stringformatter.buffer") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  SettingsUtil settingsUtil{};
+  TranslationUtil translationUtil{state};
+
+  SettingsManager::GetInstance().SetDateFormat(ACDB_DATE_DMY_SLASH);
+  SettingsManager::GetInstance().SetDistanceUnit(ACDB_METER);
+
+  const std::string dateInput{"2018-05-23T09:30:00Z"};
+
+  char buffer[StringFormatter::MaxFormattedLength];
+  char smallBuffer[4];
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  size_t dateLength = StringFormatter::GetInstance().FormatDate(
+      dateInput.c_str(), dateInput.size(), buffer, sizeof(buffer));
+  std::string date{buffer};
+
+  size_t depthLength =
+      StringFormatter::GetInstance().FormatDepthValue(45.72, buffer, sizeof(buffer));
+  std::string depth{buffer};
+
+  size_t truncatedLength =
+      StringFormatter::GetInstance().FormatDepthValue(45.72, smallBuffer, sizeof(smallBuffer));
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, dateLength == 10, "Date (buffer): length");
+  TF_assert_msg(state, date == "23/05/2018", "Date (buffer)");
+  TF_assert_msg(state, depthLength == 11, "Depth (buffer): length");
+  TF_assert_msg(state, depth == "45.72 [147]", "Depth (buffer)");
+  TF_assert_msg(state, truncatedLength == 0, "Truncated (buffer): length");
+  TF_assert_msg(state, smallBuffer[0] == '\0', "Truncated (buffer)");
+}
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -314,5 +362,53 @@ TF_TEST("acdb.stringformatter.position_max") {
   }
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test StringFormatter::FormatPosition() picks up a new
+//!         language once the table it cached strings from is
+//!         replaced and released.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.stringformatter.position_language_change") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  SettingsUtil settingsUtil{};
+  TranslationUtil translationUtil{state};
+  SettingsManager::GetInstance().SetCoordinateFormat(ACDB_COORD_DEC_DEG);
+
+  const scposn_type input{static_cast<int32_t>(38.8565 * UTL_DEG_TO_SEMI),
+                          static_cast<int32_t>(-94.8 * UTL_DEG_TO_SEMI)};
+
+  std::string expectedBefore =
+      String::Format("38.8565%s[148], 94.8000%s[151]", DEGREE_SYMBOL, DEGREE_SYMBOL);
+  std::string expectedAfter =
+      String::Format("38.8565%sN, 94.8000%sW", DEGREE_SYMBOL, DEGREE_SYMBOL);
+
+  std::vector<TranslationDataType> translations{
+      std::make_pair(static_cast<int>(TextHandle::NorthAbbr), std::string("N")),
+      std::make_pair(static_cast<int>(TextHandle::SouthAbbr), std::string("S")),
+      std::make_pair(static_cast<int>(TextHandle::EastAbbr), std::string("E")),
+      std::make_pair(static_cast<int>(TextHandle::WestAbbr), std::string("W"))};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  std::string actualBefore = StringFormatter::GetInstance().FormatPosition(input);
+
+  TextTranslator::GetInstance().Publish(
+      TextTranslator::TablePtr(new TextTranslator::Table(std::move(translations))));
+
+  std::string actualAfter = StringFormatter::GetInstance().FormatPosition(input);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expectedBefore == actualBefore, "Position before language change");
+  TF_assert_msg(state, expectedAfter == actualAfter, "Position after language change");
+}
+
 }  // end of namespace Test
 }  // end of namespace Acdb
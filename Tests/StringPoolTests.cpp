@@ -0,0 +1,118 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+
+/**
+    @file
+    @brief Regression tests for StringPool
+
+    Copyright 2022 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "StringPoolTests"
+
+#include <string>
+#include <vector>
+
+#include "Acdb/Presentation/Field/AttributeField.hpp"
+#include "Acdb/StringPool.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that equal strings are interned once.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.stringpool.intern") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  StringPool stringPool;
+  const std::string label{"Transient Slips Available"};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  const std::string& first = stringPool.Intern(label);
+  const std::string& second = stringPool.Intern(std::string(label));
+  const std::string& other = stringPool.Intern("Dockage Rate");
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, &first == &second, "StringPool: equal strings interned twice");
+  TF_assert_msg(state, &first != &other, "StringPool: distinct strings share storage");
+  TF_assert_msg(state, other == "Dockage Rate", "StringPool: unexpected string %s", other.c_str());
+  TF_assert_msg(state, stringPool.GetCount() == 2, "StringPool: expected 2 strings, actual = %d",
+                stringPool.GetCount());
+  TF_assert_msg(state, stringPool.GetBytes() == label.size() + other.size(),
+                "StringPool: expected %d bytes, actual = %d", label.size() + other.size(),
+                stringPool.GetBytes());
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that fields share a pooled label, and keep their
+//!         own copy of any other label without growing the pool.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.stringpool.attribute_field_labels") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  const size_t fieldCount = 100;
+  const std::string& pooledLabel = StringPool::GetInstance().Intern("Maximum Vessel Length");
+  const size_t expected = StringPool::GetInstance().GetCount();
+
+  std::vector<Presentation::AttributeField> pooledFields;
+  std::vector<Presentation::AttributeField> ownedFields;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  for (size_t i = 0; i < fieldCount; i++) {
+    pooledFields.emplace_back(&pooledLabel, std::to_string(i), std::string(), std::string());
+    ownedFields.emplace_back("Label " + std::to_string(i), std::to_string(i), std::string(),
+                             std::string());
+  }
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, StringPool::GetInstance().GetCount() == expected,
+                "StringPool: expected %d strings, actual = %d", expected,
+                StringPool::GetInstance().GetCount());
+  TF_assert_msg(state, &pooledFields.front().GetLabel() == &pooledLabel,
+                "StringPool: first label not shared");
+  TF_assert_msg(state, &pooledFields.back().GetLabel() == &pooledLabel,
+                "StringPool: last label not shared");
+  TF_assert_msg(state, ownedFields.back().GetLabel() == "Label 99",
+                "StringPool: unexpected label %s", ownedFields.back().GetLabel().c_str());
+  TF_assert_msg(state, pooledFields.back().GetValue() == "99", "StringPool: unexpected value %s",
+                pooledFields.back().GetValue().c_str());
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
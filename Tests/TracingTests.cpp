@@ -0,0 +1,162 @@
+/*------------------------------------------------------------------------------
+Copyright 2022 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    @brief Regression tests for Tracing
+
+    Copyright 2022 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "TracingTests"
+
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Acdb/TraceSpan.hpp"
+#include "Acdb/Tracing.hpp"
+#include "DBG_pub.h"
+#include "TF_pub.h"
+
+namespace Acdb {
+namespace Test {
+
+//! Keeps the spans it receives, for inspection by the tests
+class LocalSink : public Tracing::ISink {
+ public:
+  void OnSpan(const Tracing::SpanEvent& aSpanEvent) override {
+    std::lock_guard<std::mutex> lock{mMutex};
+    mSpanEvents.push_back(aSpanEvent);
+  }
+
+  std::vector<Tracing::SpanEvent> GetSpanEvents() {
+    std::lock_guard<std::mutex> lock{mMutex};
+    return mSpanEvents;
+  }
+
+ private:
+  std::mutex mMutex;
+  std::vector<Tracing::SpanEvent> mSpanEvents;
+};
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that nested spans are reported innermost first,
+//!         with their depth and thread, and that nothing is
+//!         reported once the sink is removed.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.tracing.nested_spans") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  LocalSink sink;
+  Tracing::SetSink(&sink);
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  {
+    Tracing::ScopedSpan outerSpan{"Outer"};
+    {
+      Tracing::ScopedSpan innerSpan{"Inner"};
+    }
+
+    std::thread worker{[]() { Tracing::ScopedSpan workerSpan{"Worker"}; }};
+    worker.join();
+  }
+
+  Tracing::SetSink(nullptr);
+
+  {
+    Tracing::ScopedSpan untracedSpan{"Untraced"};
+  }
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  std::vector<Tracing::SpanEvent> spanEvents = sink.GetSpanEvents();
+
+  TF_assert_msg(state, spanEvents.size() == 3, "Tracing: expected 3 spans, actual = %d",
+                spanEvents.size());
+  if (spanEvents.size() == 3) {
+    const Tracing::SpanEvent& inner = spanEvents[0];
+    const Tracing::SpanEvent& worker = spanEvents[1];
+    const Tracing::SpanEvent& outer = spanEvents[2];
+
+    TF_assert_msg(state, std::strcmp(inner.mName, "Inner") == 0, "Tracing: inner name");
+    TF_assert_msg(state, std::strcmp(worker.mName, "Worker") == 0, "Tracing: worker name");
+    TF_assert_msg(state, std::strcmp(outer.mName, "Outer") == 0, "Tracing: outer name");
+
+    TF_assert_msg(state, outer.mDepth == 0, "Tracing: outer depth");
+    TF_assert_msg(state, inner.mDepth == 1, "Tracing: inner depth");
+    TF_assert_msg(state, worker.mDepth == 0, "Tracing: worker depth");
+
+    TF_assert_msg(state, inner.mThreadId == outer.mThreadId, "Tracing: inner thread");
+    TF_assert_msg(state, worker.mThreadId != outer.mThreadId, "Tracing: worker thread");
+
+    TF_assert_msg(state, inner.mStartMicroseconds >= outer.mStartMicroseconds,
+                  "Tracing: inner span starts before outer span");
+    TF_assert_msg(state,
+                  inner.mStartMicroseconds + inner.mDurationMicroseconds <=
+                      outer.mStartMicroseconds + outer.mDurationMicroseconds,
+                  "Tracing: inner span ends after outer span");
+  }
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test the Chrome trace event JSON of ChromeTraceSink.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.tracing.chrome_trace_json") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  Tracing::ChromeTraceSink sink;
+
+  const std::string expected =
+      "{\"traceEvents\":[\n"
+      "{\"name\":\"Outer\",\"cat\":\"acdb\",\"ph\":\"X\",\"pid\":1,"
+      "\"ts\":100,\"dur\":50,\"tid\":1},\n"
+      "{\"name\":\"Say \\\"hi\\\"\",\"cat\":\"acdb\",\"ph\":\"X\",\"pid\":1,"
+      "\"ts\":120,\"dur\":10,\"tid\":2}\n"
+      "],\"displayTimeUnit\":\"ms\"}\n";
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  sink.OnSpan(Tracing::SpanEvent{"Outer", 1, 0, 100, 50});
+  sink.OnSpan(Tracing::SpanEvent{"Say \"hi\"", 2, 0, 120, 10});
+
+  std::string actual = sink.GetJson();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, expected == actual, "Tracing: unexpected JSON %s", actual.c_str());
+}
+
+}  // end of namespace Test
+}  // end of namespace Acdb
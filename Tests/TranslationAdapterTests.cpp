@@ -24,6 +24,10 @@ limitations under the License.
 #define DBG_MODULE "ACDB"
 #define DBG_TAG "TranslationAdapterTests"
 
+#include <string>
+#include <vector>
+
+#include "Acdb/StringPool.hpp"
 #include "Acdb/Tests/DatabaseUtil.hpp"
 #include "Acdb/Tests/TranslationUtil.hpp"
 #include "Acdb/TextHandle.hpp"
@@ -157,5 +161,196 @@ TF_TEST("acdb.translationadapter.get_fallback") {
   TF_assert_msg(state, expected == actual, "TranslationAdapter: Get Fallback");
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test preloading TextTranslator (preloaded language is
+//!         only used once published, and earlier lookups stay
+//!         valid).
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.translationadapter.preload") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  TranslationUtil translationUtil{state};
+  TextTranslator::GetInstance().Clear();
+
+  TranslationAdapter translationAdapter{database};
+
+  PopulateTranslationsTable(state, database);
+
+  translationAdapter.InitTextTranslator("en_US");
+  const std::string& english = TextTranslator::GetInstance().Lookup(1);
+
+  std::vector<std::string> expected = {"pt_BR [1]", "pt_BR [2]", "en_US [3]", "en_US [4]",
+                                       "MISSING STRING! [5]"};
+
+  std::vector<std::string> actual;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  translationAdapter.PreloadTextTranslator("pt_BR");
+  std::string beforePublish = TextTranslator::GetInstance().Find(1);
+
+  bool published = TextTranslator::GetInstance().PublishPreloaded("pt_BR");
+
+  for (int i = 1; i <= 5; i++) {
+    actual.push_back(TextTranslator::GetInstance().Find(i));
+  }
+
+  TextTranslator::GetInstance().ClearPreloaded();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, beforePublish == "en_US [1]", "TranslationAdapter: Preload not published");
+  TF_assert_msg(state, published, "TranslationAdapter: Preload published");
+  TF_assert_msg(state, expected == actual, "TranslationAdapter: Preload");
+  TF_assert_msg(state, english == "en_US [1]", "TranslationAdapter: Preload earlier lookup");
+  TF_assert_msg(state, !TextTranslator::GetInstance().PublishPreloaded("pt_BR"),
+                "TranslationAdapter: Preload cleared");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a replaced table is released, and that a
+//!         reference returned by Lookup outlives its table.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.translationadapter.release_replaced") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  TranslationUtil translationUtil{state};
+
+  std::vector<TranslationDataType> first{std::make_pair(1, std::string("first [1]"))};
+  std::vector<TranslationDataType> second{std::make_pair(1, std::string("second [1]"))};
+
+  TextTranslator::TablePtr firstTable{new TextTranslator::Table(std::move(first))};
+  std::weak_ptr<const TextTranslator::Table> firstTableRef = firstTable;
+
+  TextTranslator::GetInstance().Publish(std::move(firstTable));
+  const std::string& firstValue = TextTranslator::GetInstance().Lookup(1);
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  TextTranslator::GetInstance().Publish(
+      TextTranslator::TablePtr(new TextTranslator::Table(std::move(second))));
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, firstTableRef.expired(), "TextTranslator: Replaced table released");
+  TF_assert_msg(state, firstValue == "first [1]", "TextTranslator: Lookup outlives table");
+  TF_assert_msg(state, TextTranslator::GetInstance().Find(1) == "second [1]",
+                "TextTranslator: Replacement published");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that inserting several pairs publishes a single
+//!         table and skips text handles already present.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.translationadapter.insert_batch") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  TranslationUtil translationUtil{state};
+  TextTranslator::GetInstance().Clear();
+  TextTranslator::GetInstance().Insert(1, std::string("existing [1]"));
+
+  std::vector<TranslationDataType> translations{
+      std::make_pair(1, std::string("inserted [1]")),
+      std::make_pair(2, std::string("inserted [2]")),
+      std::make_pair(3, std::string("inserted [3]")),
+      std::make_pair(2, std::string("again [2]"))};
+
+  uint32_t generationBefore = TextTranslator::GetInstance().GetGeneration();
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  size_t addedCount = TextTranslator::GetInstance().Insert(std::move(translations));
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, addedCount == 2, "TextTranslator: Insert count");
+  TF_assert_msg(state, TextTranslator::GetInstance().GetGeneration() == generationBefore + 1,
+                "TextTranslator: Insert publishes once");
+  TF_assert_msg(state, TextTranslator::GetInstance().Find(1) == "existing [1]",
+                "TextTranslator: Insert keeps existing");
+  TF_assert_msg(state, TextTranslator::GetInstance().Find(2) == "inserted [2]",
+                "TextTranslator: Insert first duplicate wins");
+  TF_assert_msg(state, TextTranslator::GetInstance().Find(3) == "inserted [3]",
+                "TextTranslator: Insert new");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that a table keeps its own strings, and that only
+//!         the translations read with Lookup are interned, once.
+//!
+//----------------------------------------------------------------
+TF_TEST("acdb.translationadapter.intern_looked_up") {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  TranslationUtil translationUtil{state};
+
+  const size_t TranslationCount = 100;
+  std::vector<TranslationDataType> translations;
+  for (size_t i = 0; i < TranslationCount; i++) {
+    translations.push_back(
+        std::make_pair(static_cast<int>(i), "intern_looked_up [" + std::to_string(i) + "]"));
+  }
+
+  const size_t countBefore = StringPool::GetInstance().GetCount();
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  TextTranslator::GetInstance().Publish(
+      TextTranslator::TablePtr(new TextTranslator::Table(std::move(translations))));
+  const size_t countPublished = StringPool::GetInstance().GetCount();
+
+  std::string found;
+  for (size_t i = 0; i < TranslationCount; i++) {
+    found = TextTranslator::GetInstance().Find(static_cast<int>(i));
+  }
+  const size_t countFound = StringPool::GetInstance().GetCount();
+
+  const std::string& first = TextTranslator::GetInstance().Lookup(1);
+  const std::string& second = TextTranslator::GetInstance().Lookup(1);
+  const size_t countLookedUp = StringPool::GetInstance().GetCount();
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, countPublished == countBefore, "TextTranslator: table interned");
+  TF_assert_msg(state, found == "intern_looked_up [99]", "TextTranslator: Find %s",
+                found.c_str());
+  TF_assert_msg(state, countFound == countBefore, "TextTranslator: Find interned");
+  TF_assert_msg(state, &first == &second, "TextTranslator: Lookup not shared");
+  TF_assert_msg(state, first == "intern_looked_up [1]", "TextTranslator: Lookup %s",
+                first.c_str());
+  TF_assert_msg(state, countLookedUp == countBefore + 1,
+                "TextTranslator: expected 1 interned string, actual = %d",
+                countLookedUp - countBefore);
+}
+
 }  // end of namespace Test
 }  // end of namespace Acdb
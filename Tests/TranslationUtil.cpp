@@ -47,13 +47,18 @@ TranslationUtil::TranslationUtil(TF_state_type* aState) {
     mTranslations[i] = TextTranslator::GetInstance().Find(static_cast<int>(i));
   }
 
-  TextTranslator::GetInstance().Clear();
+  std::vector<TranslationDataType> translations;
 
   for (ACDB_text_handle_type i = 0;
        i < static_cast<ACDB_text_handle_type>(TextHandle::TextHandleCount); i++) {
-    TF_assert_msg(aState, TextTranslator::GetInstance().Insert(i, String::Format("[%i]", i)),
-                  "TextTranslator: Failed to insert string");
+    translations.push_back(std::make_pair(static_cast<int>(i), String::Format("[%i]", i)));
   }
+
+  TextTranslator::GetInstance().Publish(
+      TextTranslator::TablePtr(new TextTranslator::Table(std::move(translations))));
+
+  TF_assert_msg(aState, TextTranslator::GetInstance().Lookup(0) == "[0]",
+                "TextTranslator: Failed to publish strings");
 }  // end of TranslationUtil
 
 //----------------------------------------------------------------
@@ -65,12 +70,15 @@ TranslationUtil::TranslationUtil(TF_state_type* aState) {
 //!
 //----------------------------------------------------------------
 TranslationUtil::~TranslationUtil() {
-  TextTranslator::GetInstance().Clear();
+  std::vector<TranslationDataType> translations;
 
   for (ACDB_text_handle_type i = 0;
        i < static_cast<ACDB_text_handle_type>(TextHandle::TextHandleCount); i++) {
-    TextTranslator::GetInstance().Insert(static_cast<int>(i), std::move(mTranslations[i]));
+    translations.push_back(std::make_pair(static_cast<int>(i), std::move(mTranslations[i])));
   }
+
+  TextTranslator::GetInstance().Publish(
+      TextTranslator::TablePtr(new TextTranslator::Table(std::move(translations))));
 }  // end of ~TranslationUtil
 
 }  // end of namespace Test
@@ -25,8 +25,11 @@ limitations under the License.
 #define DBG_TAG "UpdateAdapterTests"
 
 #include "Acdb/InfoAdapter.hpp"
+#include "Acdb/MarkerAdapter.hpp"
 #include "Acdb/UpdateAdapter.hpp"
 #include "Acdb/PresentationAdapter.hpp"
+#include "Acdb/Queries/MarkerAttributeQuery.hpp"
+#include "Acdb/Queries/NameSearchQuery.hpp"
 #include "Acdb/Presentation/PresentationMarker.hpp"
 #include "Acdb/StringFormatter.hpp"
 #include "Acdb/StringUtil.hpp"
@@ -79,7 +82,8 @@ TF_TEST_AUTO_SLOW("acdb.updateadapter.delete_markers", 30) {
   // ----------------------------------------------------------
   // Act
   // ----------------------------------------------------------
-  TF_assert_msg(state, updateAdapter.UpdateMarkers(markerUpdates, lastUpdateMax), "Delete Markers");
+  TF_assert_msg(state, updateAdapter.UpdateMarkers(std::move(markerUpdates), lastUpdateMax),
+                "Delete Markers");
 
   PresentationMarkerPtr actual = presentationAdapter.GetMarker(1);
 
@@ -143,7 +147,8 @@ TF_TEST_AUTO_SLOW("acdb.updateadapter.delete_reviews", 30) {
   // ----------------------------------------------------------
   // Act
   // ----------------------------------------------------------
-  TF_assert_msg(state, updateAdapter.UpdateReviews(reviewUpdates, lastUpdateMax), "Delete Reviews");
+  TF_assert_msg(state, updateAdapter.UpdateReviews(std::move(reviewUpdates), lastUpdateMax),
+                "Delete Reviews");
 
   PresentationMarkerPtr actual = presentationAdapter.GetMarker(1);
 
@@ -355,7 +360,8 @@ TF_TEST_AUTO_SLOW("acdb.updateadapter.update_markers", 20) {
   // ----------------------------------------------------------
   // Act
   // ----------------------------------------------------------
-  TF_assert_msg(state, updateAdapter.UpdateMarkers(markerUpdates, lastUpdateMax), "Update Markers");
+  TF_assert_msg(state, updateAdapter.UpdateMarkers(std::move(markerUpdates), lastUpdateMax),
+                "Update Markers");
 
   PresentationMarkerPtr actual = presentationAdapter.GetMarker(1);
 
@@ -427,7 +433,8 @@ TF_TEST_AUTO_SLOW("acdb.updateadapter.update_reviews", 30) {
   // ----------------------------------------------------------
   // Act
   // ----------------------------------------------------------
-  TF_assert_msg(state, updateAdapter.UpdateReviews(reviewUpdates, lastUpdateMax), "Update Reviews");
+  TF_assert_msg(state, updateAdapter.UpdateReviews(std::move(reviewUpdates), lastUpdateMax),
+                "Update Reviews");
 
   PresentationMarkerPtr actual = presentationAdapter.GetMarker(1);
 
@@ -444,5 +451,159 @@ TF_TEST_AUTO_SLOW("acdb.updateadapter.update_reviews", 30) {
   TF_assert_msg(state, expectedLastUpdateMax == lastUpdateMax, "Update Markers: lastUpdateMax");
 }
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that updating and deleting markers maintains the
+//!         fuzzy name search data.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.updateadapter.update_markers_name_search", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  UpdateAdapter updateAdapter{database};
+  MarkerAdapter markerAdapter{database};
+
+  ACDB_marker_idx_type markerId = 1;
+
+  TF_assert_msg(state, updateAdapter.UpdateNameSearch(), "Update Name Search");
+
+  MarkerTableDataCollection markerUpdate;
+  markerUpdate.mMarker = MarkerTableDataType(markerId, ACDB_MARINA, 1527084000,
+                                             "\xC3\x86R\xC3\x98 Harbour", {100, 100}, 0,
+                                             SearchMarkerFilter::Any,
+                                             ACDB_INVALID_BUSINESS_PROGRAM_TIER);
+
+  std::vector<MarkerTableDataCollection> markerUpdates;
+  markerUpdates.push_back(std::move(markerUpdate));
+
+  MarkerTableDataCollection markerDelete;
+  markerDelete.mMarker.mId = markerId;
+  markerDelete.mIsDeleted = true;
+
+  std::vector<MarkerTableDataCollection> markerDeletes;
+  markerDeletes.push_back(std::move(markerDelete));
+
+  bbox_type filterBbox;
+  filterBbox.nec = {1000, 1000};
+  filterBbox.swc = {0, 0};
+
+  SearchMarkerFilter markerFilter;
+  markerFilter.AddType(ACDB_MARINA);
+  markerFilter.SetBbox(filterBbox);
+  markerFilter.SetSearchString("aero harbor", SearchMarkerFilter::MatchFuzzy);
+
+  uint64_t lastUpdateMax = 0;
+  std::vector<ISearchMarkerPtr> actualUpdated;
+  std::vector<ISearchMarkerPtr> actualDeleted;
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  TF_assert_msg(state, updateAdapter.UpdateMarkers(std::move(markerUpdates), lastUpdateMax),
+                "Update Markers");
+  markerAdapter.GetBasicSearchMarkersByFilter(markerFilter, actualUpdated);
+
+  TF_assert_msg(state, updateAdapter.UpdateMarkers(std::move(markerDeletes), lastUpdateMax),
+                "Delete Markers");
+  markerAdapter.GetBasicSearchMarkersByFilter(markerFilter, actualDeleted);
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, actualUpdated.size() == 1, "Update Markers: updated name not found");
+  TF_assert_msg(state, actualUpdated[0]->GetId() == markerId, "Update Markers: wrong marker found");
+  TF_assert_msg(state, actualDeleted.empty(), "Delete Markers: deleted name found");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that the name search tables are only created by
+//!         the rebuild, and that a rebuilt database is complete
+//!         when opened again.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.updateadapter.update_name_search_creates_tables", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  NameSearchQuery nameSearchQuery{database};
+  const bool createdOnOpen = database.tableExists("markerNameSearch");
+  const bool completeOnOpen = nameSearchQuery.IsComplete();
+  const bool writeOnOpen = nameSearchQuery.Write(1, "Test Marina");
+
+  UpdateAdapter updateAdapter{database};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  const bool updated = updateAdapter.UpdateNameSearch();
+  NameSearchQuery reopenedQuery{database};
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, !createdOnOpen, "Name search table created on open");
+  TF_assert_msg(state, !completeOnOpen, "Name search complete before rebuild");
+  TF_assert_msg(state, writeOnOpen, "Write before rebuild failed");
+  TF_assert_msg(state, updated, "Update Name Search");
+  TF_assert_msg(state, database.tableExists("markerNameSearch"), "Name table not created");
+  TF_assert_msg(state, database.tableExists("markerNameTrigram"), "Trigram table not created");
+  TF_assert_msg(state, reopenedQuery.IsComplete(), "Name search incomplete after rebuild");
+}
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail
+//!         Test that the attribute table is only created by the
+//!         rebuild, and that a rebuilt database is complete when
+//!         opened again.
+//!
+//----------------------------------------------------------------
+TF_TEST_AUTO_SLOW("acdb.updateadapter.update_marker_attributes_creates_table", 20) {
+  // ----------------------------------------------------------
+  // Arrange
+  // ----------------------------------------------------------
+  auto database = CreateDatabase(state);
+
+  PopulateDatabase(state, database);
+
+  MarkerAttributeQuery markerAttributeQuery{database};
+  const bool createdOnOpen = database.tableExists("markerAttributes");
+  const bool completeOnOpen = markerAttributeQuery.IsComplete();
+  const bool writeOnOpen = markerAttributeQuery.Write(1);
+
+  UpdateAdapter updateAdapter{database};
+
+  // ----------------------------------------------------------
+  // Act
+  // ----------------------------------------------------------
+  const bool updated = updateAdapter.UpdateMarkerAttributes();
+  MarkerAttributeQuery reopenedQuery{database};
+
+  // ----------------------------------------------------------
+  // Assert
+  // ----------------------------------------------------------
+  TF_assert_msg(state, !createdOnOpen, "Attribute table created on open");
+  TF_assert_msg(state, !completeOnOpen, "Attributes complete before rebuild");
+  TF_assert_msg(state, writeOnOpen, "Write before rebuild failed");
+  TF_assert_msg(state, updated, "Update Marker Attributes");
+  TF_assert_msg(state, database.tableExists("markerAttributes"), "Attribute table not created");
+  TF_assert_msg(state, reopenedQuery.IsComplete(), "Attributes incomplete after rebuild");
+}
+
 }  // end of namespace Test
 }  // end of namespace Acdb
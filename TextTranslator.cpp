@@ -25,8 +25,11 @@ Copyright 2018-2020 by Garmin Ltd. or its subsidiaries.
 #define DBG_MODULE "ACDB"
 #define DBG_TAG "TextTranslator"
 
+#include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 #include "DBG_pub.h"
+#include "Acdb/StringPool.hpp"
 #include "Acdb/StringUtil.hpp"
 #include "Acdb/TextTranslator.hpp"
 
@@ -37,7 +40,137 @@ namespace Acdb {
 //!   @brief Constructor
 //!
 //----------------------------------------------------------------
-TextTranslator::TextTranslator() : mValue() {}  // end of TextTranslator
+TextTranslator::Table::Table() : mStrings(), mDense(), mSparse(), mPooled() {}  // end of Table
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Constructor
+//!   @detail Text handles are small consecutive integers, so they
+//!           are stored in a flat array indexed by handle.  Any id
+//!           outside that range is kept in a hash map instead.
+//!           The table owns its strings; only those looked up
+//!           with FindPooled() are interned.
+//!
+//----------------------------------------------------------------
+TextTranslator::Table::Table(std::vector<TranslationDataType>&& aTranslations)
+    : mStrings(), mDense(), mSparse(), mPooled() {
+  // Reserved up front, so the pointers into it stay valid.
+  mStrings.reserve(aTranslations.size());
+
+  int maxDenseId = -1;
+  for (auto& translation : aTranslations) {
+    if (translation.first >= 0 && translation.first < MaxDenseId) {
+      maxDenseId = std::max(maxDenseId, translation.first);
+    }
+  }
+
+  mDense.resize(maxDenseId + 1, nullptr);
+  mPooled.reset(new std::atomic<const std::string*>[mDense.size()]());
+
+  for (auto& translation : aTranslations) {
+    if (translation.first >= 0 && translation.first <= maxDenseId) {
+      if (mDense[translation.first] == nullptr) {
+        mStrings.push_back(std::move(translation.second));
+        mDense[translation.first] = &mStrings.back();
+      }
+    } else if (mSparse.find(translation.first) == mSparse.end()) {
+      mStrings.push_back(std::move(translation.second));
+      mSparse.insert(std::make_pair(translation.first, &mStrings.back()));
+    }
+  }
+}  // end of Table
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return pointer to translation for given text handle ID,
+//!           nullptr if not present
+//!
+//----------------------------------------------------------------
+const std::string* TextTranslator::Table::Find(const int aTranslationId) const {
+  if (aTranslationId >= 0 && static_cast<size_t>(aTranslationId) < mDense.size()) {
+    return mDense[aTranslationId];
+  }
+
+  auto record = mSparse.find(aTranslationId);
+  return (mSparse.end() != record) ? record->second : nullptr;
+}  // end of Find
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!   @detail Interns the translation in the StringPool the first
+//!           time it is looked up this way, so each table interns
+//!           a string at most once.  Ids outside the dense range
+//!           are interned on every call.
+//!
+//!   @return pointer to the interned translation for given text
+//!           handle ID, nullptr if not present
+//!
+//----------------------------------------------------------------
+const std::string* TextTranslator::Table::FindPooled(const int aTranslationId) const {
+  const std::string* value = Find(aTranslationId);
+  if (value == nullptr) {
+    return nullptr;
+  }
+
+  if (aTranslationId < 0 || static_cast<size_t>(aTranslationId) >= mDense.size()) {
+    return &StringPool::GetInstance().Intern(*value);
+  }
+
+  // Threads racing here intern the same string, so either store is right.
+  std::atomic<const std::string*>& pooled = mPooled[aTranslationId];
+  const std::string* result = pooled.load(std::memory_order_acquire);
+  if (result == nullptr) {
+    result = &StringPool::GetInstance().Intern(*value);
+    pooled.store(result, std::memory_order_release);
+  }
+
+  return result;
+}  // end of FindPooled
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!
+//!   @return copy of every text handle/string pair in the table
+//!
+//----------------------------------------------------------------
+void TextTranslator::Table::GetTranslations(
+    std::vector<TranslationDataType>& aTranslationsOut) const {
+  aTranslationsOut.clear();
+  aTranslationsOut.reserve(mDense.size() + mSparse.size());
+
+  for (size_t i = 0; i < mDense.size(); i++) {
+    if (mDense[i] != nullptr) {
+      aTranslationsOut.push_back(std::make_pair(static_cast<int>(i), *mDense[i]));
+    }
+  }
+
+  for (auto& translation : mSparse) {
+    aTranslationsOut.push_back(std::make_pair(translation.first, *translation.second));
+  }
+}  // end of GetTranslations
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Constructor
+//!
+//----------------------------------------------------------------
+TextTranslator::TextTranslator()
+    : mCurrent(),
+      mGeneration(0),
+      mMutex(),
+      mPreloaded(),
+      mMissing() {
+  PublishLocked(TablePtr(new Table()));
+}  // end of TextTranslator
 
 //----------------------------------------------------------------
 //!
@@ -45,28 +178,52 @@ TextTranslator::TextTranslator() : mValue() {}  // end of TextTranslator
 //!   @brief Erases all text handle/string pairs.
 //!
 //----------------------------------------------------------------
-void TextTranslator::Clear() { mValue.clear(); }  // end of Clear
+void TextTranslator::Clear() { Publish(TablePtr(new Table())); }  // end of Clear
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Discards all preloaded language tables.
+//!   @detail Tables currently in use stay valid.
+//!
+//----------------------------------------------------------------
+void TextTranslator::ClearPreloaded() {
+  std::lock_guard<std::mutex> lock{mMutex};
+  mPreloaded.clear();
+}  // end of ClearPreloaded
 
 //----------------------------------------------------------------
 //!
 //!   @public
 //!   @brief Accessor
 //!
-//!   @return translation for given text handle ID
+//!   @return copy of the translation for given text handle ID
 //!
 //----------------------------------------------------------------
 std::string TextTranslator::Find(const int aTranslationId) const {
-  std::string result;
-  auto record = mValue.find(aTranslationId);
-  if (mValue.end() != record) {
-    result = record->second;
-  } else {
-    result = String::Format("MISSING STRING! [%i]", aTranslationId);
+  TablePtr current = std::atomic_load(&mCurrent);
+  const std::string* value = current->Find(aTranslationId);
+  if (value != nullptr) {
+    return *value;
   }
 
-  return result;
+  return GetMissing(aTranslationId);
 }  // end of Find
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!   @detail Changes whenever a different table is published, so
+//!           callers can cache references returned by Lookup().
+//!
+//!   @return current table generation
+//!
+//----------------------------------------------------------------
+uint32_t TextTranslator::GetGeneration() const {
+  return mGeneration.load(std::memory_order_acquire);
+}  // end of GetGeneration
+
 //----------------------------------------------------------------
 //!
 //!       @public
@@ -85,11 +242,161 @@ std::string TextTranslator::Find(const int aTranslationId) const {
 //!
 //!   @public
 //!   @brief Modifier
+//!   @detail Copies the whole current table with the new pair
+//!           added and publishes the copy, so it is meant for
+//!           tests.  Use the vector overload to add many pairs,
+//!           or Publish() to replace a whole language at once.
 //!
 //!   @return success of operation
 //!
 //----------------------------------------------------------------
 bool TextTranslator::Insert(const int aTranslationId, std::string&& aValue) {
-  return mValue.insert(std::make_pair(aTranslationId, std::move(aValue))).second;
+  std::vector<TranslationDataType> translations;
+  translations.push_back(std::make_pair(aTranslationId, std::move(aValue)));
+
+  return Insert(std::move(translations)) == 1;
+}  // end of Insert
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Modifier
+//!   @detail Copies the current table once with every new pair
+//!           added and publishes the copy.  Pairs whose text
+//!           handle is already present are skipped.
+//!
+//!   @return number of pairs added
+//!
+//----------------------------------------------------------------
+size_t TextTranslator::Insert(std::vector<TranslationDataType>&& aTranslations) {
+  std::lock_guard<std::mutex> lock{mMutex};
+
+  TablePtr current = std::atomic_load(&mCurrent);
+
+  std::vector<TranslationDataType> translations;
+  current->GetTranslations(translations);
+  size_t existingCount = translations.size();
+
+  std::unordered_set<int> addedIds;
+  for (auto& translation : aTranslations) {
+    if (current->Find(translation.first) == nullptr && addedIds.insert(translation.first).second) {
+      translations.push_back(std::move(translation));
+    }
+  }
+
+  size_t addedCount = translations.size() - existingCount;
+  if (addedCount != 0) {
+    PublishLocked(TablePtr(new Table(std::move(translations))));
+  }
+
+  return addedCount;
 }  // end of Insert
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Accessor
+//!   @detail The translation is interned in the StringPool, so
+//!           the reference stays valid for the life of the
+//!           translator, including after the table it came from
+//!           is replaced.  Interned strings are never released,
+//!           so only look up the small set of strings kept that
+//!           way, like labels and localized type names; use
+//!           Find() for the rest.
+//!
+//!   @return translation for given text handle ID
+//!
+//----------------------------------------------------------------
+const std::string& TextTranslator::Lookup(const int aTranslationId) const {
+  const std::string* value = std::atomic_load(&mCurrent)->FindPooled(aTranslationId);
+  if (value != nullptr) {
+    return *value;
+  }
+
+  return GetMissing(aTranslationId);
+}  // end of Lookup
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Modifier
+//!   @detail Keeps a language table so a later PublishPreloaded()
+//!           can switch to it without reading the database.
+//!
+//----------------------------------------------------------------
+void TextTranslator::Preload(const std::string& aLanguage, TablePtr aTable) {
+  std::lock_guard<std::mutex> lock{mMutex};
+  mPreloaded[aLanguage] = std::move(aTable);
+}  // end of Preload
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Modifier
+//!   @detail Makes aTable the active set of translations.
+//!
+//----------------------------------------------------------------
+void TextTranslator::Publish(TablePtr aTable) {
+  std::lock_guard<std::mutex> lock{mMutex};
+  PublishLocked(std::move(aTable));
+}  // end of Publish
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief Modifier
+//!
+//!   @return true if a table for aLanguage was preloaded and is
+//!           now active
+//!
+//----------------------------------------------------------------
+bool TextTranslator::PublishPreloaded(const std::string& aLanguage) {
+  std::lock_guard<std::mutex> lock{mMutex};
+
+  auto record = mPreloaded.find(aLanguage);
+  if (mPreloaded.end() == record) {
+    return false;
+  }
+
+  PublishLocked(record->second);
+
+  return true;
+}  // end of PublishPreloaded
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @brief Accessor
+//!
+//!   @return placeholder for a text handle ID without translation,
+//!           valid for the life of the translator
+//!
+//----------------------------------------------------------------
+const std::string& TextTranslator::GetMissing(const int aTranslationId) const {
+  std::lock_guard<std::mutex> lock{mMutex};
+
+  auto record = mMissing.find(aTranslationId);
+  if (mMissing.end() == record) {
+    record = mMissing
+                 .insert(std::make_pair(aTranslationId,
+                                        String::Format("MISSING STRING! [%i]", aTranslationId)))
+                 .first;
+  }
+
+  return record->second;
+}  // end of GetMissing
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @brief Modifier
+//!   @detail Replaced tables are destroyed once the last reader
+//!           that loaded them lets go.  Must be called with mMutex
+//!           held.
+//!
+//----------------------------------------------------------------
+void TextTranslator::PublishLocked(TablePtr aTable) {
+  std::atomic_store(&mCurrent, std::move(aTable));
+  mGeneration.fetch_add(1, std::memory_order_release);
+}  // end of PublishLocked
 }  // end of namespace Acdb
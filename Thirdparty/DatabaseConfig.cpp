@@ -57,4 +57,63 @@ std::string DatabaseConfig::GetExpandedPath(const std::string& aPath) {
   return aPath;
 }  // End of GetExpandedPath()
 
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @details
+//!       Get the SQLite settings for the device running the
+//!       module.  The third-party build runs on phones.
+//!
+//----------------------------------------------------------------
+DatabaseConfig::Tuning DatabaseConfig::GetTuning() {
+  return GetTuning(TuningPreset::Phone);
+}  // End of GetTuning()
+
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @details
+//!       Get the SQLite settings of a preset.  The database is
+//!       mostly read, a few hundred MB, and rewritten in bulk by
+//!       syncs, so every preset favors reads: a larger cache,
+//!       mmap where the address space allows, and NORMAL sync in
+//!       WAL mode, which only risks losing the last sync page on
+//!       power loss.
+//!
+//----------------------------------------------------------------
+DatabaseConfig::Tuning DatabaseConfig::GetTuning(const TuningPreset aPreset) {
+  Tuning tuning;
+  tuning.mWalSynchronous = SqliteCppUtil::Synchronous::Normal;
+  tuning.mPageSize = 4096;
+
+  switch (aPreset) {
+    case TuningPreset::LowMemory:
+      tuning.mMmapSize = 0;
+      tuning.mCacheSizeKib = 1024;
+      tuning.mTempStore = SqliteCppUtil::TempStore::File;
+      tuning.mWalAutoCheckpoint = 1000;
+      tuning.mAnalysisLimit = 100;
+      break;
+
+    case TuningPreset::Phone:
+      tuning.mMmapSize = 64 * 1024 * 1024;
+      tuning.mCacheSizeKib = 8 * 1024;
+      tuning.mTempStore = SqliteCppUtil::TempStore::Memory;
+      tuning.mWalAutoCheckpoint = 1000;
+      tuning.mAnalysisLimit = 400;
+      break;
+
+    case TuningPreset::Desktop:
+    default:
+      tuning.mMmapSize = 256 * 1024 * 1024;
+      tuning.mCacheSizeKib = 32 * 1024;
+      tuning.mTempStore = SqliteCppUtil::TempStore::Memory;
+      tuning.mWalAutoCheckpoint = 4000;
+      tuning.mAnalysisLimit = 1000;
+      break;
+  }
+
+  return tuning;
+}  // End of GetTuning()
+
 }  // end of namespace Acdb
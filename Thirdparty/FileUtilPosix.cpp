@@ -24,6 +24,8 @@ limitations under the License.
 #define DBG_MODULE "ACDB"
 #define DBG_TAG "FileUtil"
 
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include "Acdb/FileUtil.hpp"
@@ -79,6 +81,40 @@ bool GetSize(const std::string& aFilePath, uint64_t& aFileSize) {
   return success;
 }  // end of GetSize
 
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief Map a whole file into memory, read-only.
+//!
+//!       @returns the mapped data, to be released with Unmap(),
+//!       or nullptr on failure or if the file is empty
+//!
+//----------------------------------------------------------------
+const char* MapReadOnly(const std::string& aFilePath, uint64_t& aFileSize) {
+  const char* data{nullptr};
+  aFileSize = 0;
+
+  int file = open(aFilePath.c_str(), O_RDONLY);
+  if (file < 0) {
+    return nullptr;
+  }
+
+  struct stat stats;
+  if (fstat(file, &stats) == 0 && stats.st_size > 0) {
+    void* mapping = mmap(nullptr, stats.st_size, PROT_READ, MAP_SHARED, file, 0);
+    if (mapping != MAP_FAILED) {
+      data = static_cast<const char*>(mapping);
+      aFileSize = stats.st_size;
+    }
+  }
+
+  // The mapping stays valid once the file is closed.
+  close(file);
+
+  DBG_D_IF(data == nullptr, "Failed to map file '%s'", aFilePath.c_str());
+  return data;
+}  // end of MapReadOnly
+
 //----------------------------------------------------------------
 //!
 //!       @public
@@ -112,5 +148,37 @@ bool Rename(const std::string& aOldPath, const std::string& aNewPath) {
   return success;
 }  // end of Rename
 
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief Release a file mapped by MapReadOnly().
+//!
+//----------------------------------------------------------------
+void Unmap(const char* aData, const uint64_t aFileSize) {
+  if (aData != nullptr) {
+    munmap(const_cast<char*>(aData), aFileSize);
+  }
+}  // end of Unmap
+
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief Write data to a file, replacing its content.
+//!
+//----------------------------------------------------------------
+bool Write(const std::string& aFilePath, const char* aBuffer, uint32_t aBytesToWrite) {
+  bool success{false};
+  FILE* file = fopen(aFilePath.c_str(), "wb");
+
+  if (file != NULL) {
+    uint32_t bytesWritten = fwrite(aBuffer, sizeof(char), aBytesToWrite, file);
+    success = (aBytesToWrite == bytesWritten);
+    success = (fclose(file) == 0) && success;
+  }
+
+  DBG_D_IF(!success, "Failed to write file '%s'", aFilePath.c_str());
+  return success;
+}  // end of Write
+
 }  // end of namespace FileUtil
 }  // end of namespace Acdb
@@ -25,6 +25,7 @@ limitations under the License.
 #define DBG_TAG "FileUtil"
 
 #include <io.h>
+#include <windows.h>
 #include "Acdb/FileUtil.hpp"
 #include "Acdb/StringUtil.hpp"
 #include "DBG_pub.h"
@@ -78,6 +79,45 @@ bool GetSize(const std::string& aFilePath, uint64_t& aFileSize) {
   return success;
 }  // end of GetSize
 
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief Map a whole file into memory, read-only.
+//!
+//!       @returns the mapped data, to be released with Unmap(),
+//!       or nullptr on failure or if the file is empty
+//!
+//----------------------------------------------------------------
+const char* MapReadOnly(const std::string& aFilePath, uint64_t& aFileSize) {
+  const char* data{nullptr};
+  aFileSize = 0;
+
+  HANDLE file = CreateFileA(aFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+
+  LARGE_INTEGER size;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping != NULL) {
+      data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+      if (data != nullptr) {
+        aFileSize = size.QuadPart;
+      }
+
+      // The view keeps the mapping open.
+      CloseHandle(mapping);
+    }
+  }
+
+  CloseHandle(file);
+
+  DBG_D_IF(data == nullptr, "Failed to map file '%s'", aFilePath.c_str());
+  return data;
+}  // end of MapReadOnly
+
 //----------------------------------------------------------------
 //!
 //!       @public
@@ -111,5 +151,39 @@ bool Rename(const std::string& aOldPath, const std::string& aNewPath) {
   return success;
 }  // end of Rename
 
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief Release a file mapped by MapReadOnly().
+//!
+//----------------------------------------------------------------
+void Unmap(const char* aData, const uint64_t aFileSize) {
+  (void)aFileSize;
+
+  if (aData != nullptr) {
+    UnmapViewOfFile(aData);
+  }
+}  // end of Unmap
+
+//----------------------------------------------------------------
+//!
+//!       @public
+//!       @brief Write data to a file, replacing its content.
+//!
+//----------------------------------------------------------------
+bool Write(const std::string& aFilePath, const char* aBuffer, uint32_t aBytesToWrite) {
+  bool success{false};
+  FILE* file = fopen(aFilePath.c_str(), "wb");
+
+  if (file != NULL) {
+    uint32_t bytesWritten = fwrite(aBuffer, sizeof(char), aBytesToWrite, file);
+    success = (aBytesToWrite == bytesWritten);
+    success = (fclose(file) == 0) && success;
+  }
+
+  DBG_D_IF(!success, "Failed to write file '%s'", aFilePath.c_str());
+  return success;
+}  // end of Write
+
 }  // end of namespace FileUtil
 }  // end of namespace Acdb
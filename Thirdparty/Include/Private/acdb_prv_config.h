@@ -30,5 +30,7 @@ limitations under the License.
 #endif
 
 #define acdb_WEBVIEW_SUPPORT TRUE
+#define acdb_TRACING_SUPPORT FALSE
+#define acdb_MARKER_SNAPSHOT_SUPPORT TRUE
 
 #endif
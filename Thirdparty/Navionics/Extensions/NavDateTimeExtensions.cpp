@@ -31,6 +31,86 @@ limitations under the License.
 namespace Acdb {
 using namespace Navionics;
 
+static constexpr uint64_t SecondsPerDay = 86400;
+
+static bool IsValidCivilDateTime(const CivilDateTime& aDateTime);
+
+static bool ReadDigits(const char* aStr, const int aCount, unsigned int& aValueOut);
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief
+//!       Convert calendar date and time to epoch value
+//!   @detail
+//!       Uses the days-from-civil algorithm directly rather than
+//!       building a NavDateTime.  Milliseconds are ignored.
+//!       aDateTime must be valid and not before the epoch.
+//!   @return
+//!       Epoch value (seconds) corresponding to given date and time.
+//!
+//----------------------------------------------------------------
+uint64_t NavDateTimeExtensions::CivilDateTimeToEpoch(const CivilDateTime& aDateTime,
+                                                     EpochType aEpochType) {
+  uint64_t days = 0;
+
+  if (aEpochType == UNIX_EPOCH) {
+    // Count years from March so the leap day is the last day of the year.
+    const uint64_t year = aDateTime.mYear - (aDateTime.mMonth <= 2 ? 1 : 0);
+    const uint64_t era = year / 400;
+    const uint64_t yearOfEra = year - era * 400;
+    const uint64_t shiftedMonth =
+        aDateTime.mMonth > 2 ? aDateTime.mMonth - 3 : aDateTime.mMonth + 9;
+    const uint64_t dayOfYear = (153 * shiftedMonth + 2) / 5 + aDateTime.mDay - 1;
+    const uint64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+    days = era * 146097 + dayOfEra - 719468;
+  }
+
+  return days * SecondsPerDay + aDateTime.mHour * 3600 + aDateTime.mMinute * 60 +
+         aDateTime.mSecond;
+}  // end of function CivilDateTimeToEpoch()
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief
+//!       Convert epoch value to calendar date and time
+//!   @detail
+//!       Uses the days-to-civil algorithm directly rather than
+//!       building a NavDateTime.
+//!
+//----------------------------------------------------------------
+void NavDateTimeExtensions::EpochToCivilDateTime(EpochType aEpochType, uint64_t aEpochSeconds,
+                                                 CivilDateTime& aDateTimeOut) {
+  uint64_t days = 0;
+  uint64_t secondsOfDay = aEpochSeconds;
+
+  if (aEpochType == UNIX_EPOCH) {
+    days = aEpochSeconds / SecondsPerDay;
+    secondsOfDay = aEpochSeconds % SecondsPerDay;
+  }
+
+  // Shift the day count so eras start on 0000-03-01; leap days then fall at the end of a year.
+  const uint64_t shiftedDays = days + 719468;
+  const uint64_t era = shiftedDays / 146097;
+  const uint64_t dayOfEra = shiftedDays - era * 146097;
+  const uint64_t yearOfEra =
+      (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  const uint64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  const uint64_t shiftedMonth = (5 * dayOfYear + 2) / 153;  // [0, 11], March == 0
+
+  aDateTimeOut.mDay = static_cast<unsigned int>(dayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
+  aDateTimeOut.mMonth =
+      static_cast<unsigned int>(shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9);
+  aDateTimeOut.mYear =
+      static_cast<unsigned int>(yearOfEra + era * 400 + (aDateTimeOut.mMonth <= 2 ? 1 : 0));
+  aDateTimeOut.mHour = static_cast<unsigned int>(secondsOfDay / 3600);
+  aDateTimeOut.mMinute = static_cast<unsigned int>((secondsOfDay % 3600) / 60);
+  aDateTimeOut.mSecond = static_cast<unsigned int>(secondsOfDay % 60);
+  aDateTimeOut.mMillisecond = 0;
+}  // end of function EpochToCivilDateTime()
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -70,6 +150,30 @@ NavDateTime NavDateTimeExtensions::GetCurrentDateTime() {
   return now;
 }  // end of function GetCurrentDateTime()
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief
+//!       Convert an ISO 8601 string straight to an epoch value
+//!   @detail
+//!       Equivalent to NavDateTime::FromString followed by
+//!       NavDateTimeToEpoch for the layouts accepted by
+//!       ParseIso8601, without constructing a NavDateTime.
+//!   @return
+//!       true if aDateTimeStr is a valid date and time
+//!
+//----------------------------------------------------------------
+bool NavDateTimeExtensions::Iso8601ToEpoch(const char* aDateTimeStr, const size_t aLength,
+                                           EpochType aEpochType, uint64_t& aEpochSecondsOut) {
+  CivilDateTime dateTime;
+  if (!ParseIso8601(aDateTimeStr, aLength, dateTime)) {
+    return false;
+  }
+
+  aEpochSecondsOut = CivilDateTimeToEpoch(dateTime, aEpochType);
+  return true;
+}  // end of function Iso8601ToEpoch()
+
 //----------------------------------------------------------------
 //!
 //!   @public
@@ -90,4 +194,118 @@ uint64_t NavDateTimeExtensions::NavDateTimeToEpoch(const NavDateTime& aDateTime,
   return static_cast<uint64_t>(timeOffset.GetTotalSeconds());
 }  // end of function NavDateTimeToEpoch()
 
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @brief
+//!       Parse YYYYMMDDTHHMMSSZ_FORMAT (2010-12-15T22:34:12Z) or
+//!       YYYYMMDDTHHMMSSMMMZ_FORMAT (2010-12-15T22:34:12.345Z)
+//!   @detail
+//!       Fixed-layout parser for the timestamps used by the
+//!       ActiveCaptain API.  Accepts the same values as
+//!       NavDateTime::FromString for those formats, but does not
+//!       allocate.  Fractional seconds may have 1-9 digits.
+//!   @return
+//!       true if aDateTimeStr is a valid date and time
+//!
+//----------------------------------------------------------------
+bool NavDateTimeExtensions::ParseIso8601(const char* aDateTimeStr, const size_t aLength,
+                                         CivilDateTime& aDateTimeOut) {
+  if (aDateTimeStr == nullptr || aLength < 20 || aDateTimeStr[4] != '-' ||
+      aDateTimeStr[7] != '-' || aDateTimeStr[10] != 'T' || aDateTimeStr[13] != ':' ||
+      aDateTimeStr[16] != ':' || aDateTimeStr[aLength - 1] != 'Z') {
+    return false;
+  }
+
+  CivilDateTime dateTime;
+  if (!ReadDigits(aDateTimeStr, 4, dateTime.mYear) ||
+      !ReadDigits(aDateTimeStr + 5, 2, dateTime.mMonth) ||
+      !ReadDigits(aDateTimeStr + 8, 2, dateTime.mDay) ||
+      !ReadDigits(aDateTimeStr + 11, 2, dateTime.mHour) ||
+      !ReadDigits(aDateTimeStr + 14, 2, dateTime.mMinute) ||
+      !ReadDigits(aDateTimeStr + 17, 2, dateTime.mSecond)) {
+    return false;
+  }
+
+  dateTime.mMillisecond = 0;
+
+  if (aLength > 20) {
+    const size_t fractionLength = aLength - 21;
+    if (aDateTimeStr[19] != '.' || fractionLength == 0 || fractionLength > 9) {
+      return false;
+    }
+
+    unsigned int fraction;
+    if (!ReadDigits(aDateTimeStr + 20, static_cast<int>(fractionLength), fraction)) {
+      return false;
+    }
+
+    // Keep milliseconds only, as NavDateTime does.
+    for (size_t i = fractionLength; i < 3; i++) {
+      fraction *= 10;
+    }
+    for (size_t i = 3; i < fractionLength; i++) {
+      fraction /= 10;
+    }
+
+    dateTime.mMillisecond = fraction;
+  }
+
+  if (!IsValidCivilDateTime(dateTime)) {
+    return false;
+  }
+
+  aDateTimeOut = dateTime;
+  return true;
+}  // end of function ParseIso8601()
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @return
+//!       true if the date is within the range NavDateTime supports
+//!       and each field is in range for its unit.
+//!
+//----------------------------------------------------------------
+static bool IsValidCivilDateTime(const CivilDateTime& aDateTime) {
+  static const unsigned int DaysPerMonth[TIME_MONTHS_PER_YEAR] = {31, 28, 31, 30, 31, 30,
+                                                                  31, 31, 30, 31, 30, 31};
+
+  if (aDateTime.mYear < TIME_MIN_YEAR || aDateTime.mYear > TIME_MAX_YEAR ||
+      aDateTime.mMonth < 1 || aDateTime.mMonth > TIME_MONTHS_PER_YEAR || aDateTime.mDay < 1 ||
+      aDateTime.mHour >= 24 || aDateTime.mMinute >= 60 || aDateTime.mSecond >= 60) {
+    return false;
+  }
+
+  unsigned int daysInMonth = DaysPerMonth[aDateTime.mMonth - 1];
+  if (aDateTime.mMonth == 2 && NavDateTime::IsLeapYear(aDateTime.mYear)) {
+    daysInMonth++;
+  }
+
+  return aDateTime.mDay <= daysInMonth;
+}  // end of function IsValidCivilDateTime()
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @return
+//!       true if aStr starts with aCount decimal digits
+//!
+//----------------------------------------------------------------
+static bool ReadDigits(const char* aStr, const int aCount, unsigned int& aValueOut) {
+  unsigned int value = 0;
+
+  for (int i = 0; i < aCount; i++) {
+    const unsigned int digit = static_cast<unsigned int>(static_cast<unsigned char>(aStr[i]) - '0');
+    if (digit > 9) {
+      return false;
+    }
+
+    value = value * 10 + digit;
+  }
+
+  aValueOut = value;
+  return true;
+}  // end of function ReadDigits()
+
 }  // end namespace Acdb
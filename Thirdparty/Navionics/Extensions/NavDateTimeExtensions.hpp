@@ -27,6 +27,7 @@ limitations under the License.
 #include "NavDateTime.h"
 #include "NavString.h"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace Acdb {
@@ -41,13 +42,35 @@ static constexpr int UnixEpochYear = 1970;
 //! Differentiates between different varieties of epoch base years
 enum EpochType { UNIX_EPOCH };
 
+//! Calendar date and time of day (UTC), without NavDateTime's overhead
+struct CivilDateTime {
+  unsigned int mYear;
+  unsigned int mMonth;  //!< 1-12
+  unsigned int mDay;    //!< 1-31
+  unsigned int mHour;
+  unsigned int mMinute;
+  unsigned int mSecond;
+  unsigned int mMillisecond;
+};
+
 class NavDateTimeExtensions {
  public:
+  static uint64_t CivilDateTimeToEpoch(const CivilDateTime& aDateTime, EpochType aEpochType);
+
+  static void EpochToCivilDateTime(EpochType aEpochType, uint64_t aEpochSeconds,
+                                   CivilDateTime& aDateTimeOut);
+
   static NavDateTime EpochToNavDateTime(EpochType aEpochType, uint64_t aEpochSeconds);
 
   static NavDateTime GetCurrentDateTime();
 
+  static bool Iso8601ToEpoch(const char* aDateTimeStr, const size_t aLength, EpochType aEpochType,
+                             uint64_t& aEpochSecondsOut);
+
   static uint64_t NavDateTimeToEpoch(const NavDateTime& aDateTime, EpochType aEpochType);
+
+  static bool ParseIso8601(const char* aDateTimeStr, const size_t aLength,
+                           CivilDateTime& aDateTimeOut);
 };
 }  // namespace Acdb
 
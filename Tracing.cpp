@@ -0,0 +1,221 @@
+/*------------------------------------------------------------------------------
+Copyright 2021 Garmin Ltd. or its subsidiaries.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+------------------------------------------------------------------------------*/
+
+/**
+    @file
+    Timing spans of SDK requests and their Chrome trace export.
+
+    Copyright 2021 by Garmin Ltd. or its subsidiaries.
+*/
+
+#define DBG_MODULE "ACDB"
+#define DBG_TAG "Tracing"
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+
+#include "Acdb/TraceSpan.hpp"
+#include "Acdb/Tracing.hpp"
+#include "DBG_pub.h"
+
+namespace Acdb {
+namespace Tracing {
+
+//! Sink of the spans, if tracing
+static std::atomic<ISink*> sSink{nullptr};
+
+static std::string EscapeJson(const char* aString);
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Install the sink receiving spans, or nullptr to stop
+//!   tracing.
+//!
+//----------------------------------------------------------------
+void SetSink(ISink* aSink) { sSink.store(aSink); }  // end of SetSink
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Create a sink without spans.
+//!
+//----------------------------------------------------------------
+ChromeTraceSink::ChromeTraceSink() {}  // end of ChromeTraceSink
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Keep a finished span.
+//!
+//----------------------------------------------------------------
+void ChromeTraceSink::OnSpan(const SpanEvent& aSpanEvent) {
+  std::lock_guard<std::mutex> lock{mMutex};
+  mSpanEvents.push_back(aSpanEvent);
+}  // end of OnSpan
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @return the spans so far as a Chrome trace, one complete
+//!   ("X") event per span
+//!
+//----------------------------------------------------------------
+std::string ChromeTraceSink::GetJson() const {
+  std::string json{"{\"traceEvents\":["};
+
+  {
+    std::lock_guard<std::mutex> lock{mMutex};
+
+    for (size_t i = 0; i < mSpanEvents.size(); i++) {
+      const SpanEvent& spanEvent = mSpanEvents[i];
+
+      char times[96];
+      snprintf(times, sizeof(times), "\"ts\":%" PRIu64 ",\"dur\":%" PRIu64 ",\"tid\":%" PRIu32,
+               spanEvent.mStartMicroseconds, spanEvent.mDurationMicroseconds,
+               spanEvent.mThreadId);
+
+      if (i > 0) {
+        json += ",";
+      }
+
+      json += "\n{\"name\":\"" + EscapeJson(spanEvent.mName) +
+              "\",\"cat\":\"acdb\",\"ph\":\"X\",\"pid\":1," + times + "}";
+    }
+  }
+
+  json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  return json;
+}  // end of GetJson
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Write the spans so far to aFilePath as a Chrome
+//!   trace.
+//!
+//!   @return true if the file was written
+//!
+//----------------------------------------------------------------
+bool ChromeTraceSink::WriteFile(const std::string& aFilePath) const {
+  std::ofstream file{aFilePath, std::ios::out | std::ios::trunc};
+  if (!file) {
+    DBG_W("Unable to open trace file %s", aFilePath.c_str());
+    return false;
+  }
+
+  file << GetJson();
+  file.close();
+
+  return !file.fail();
+}  // end of WriteFile
+
+using Clock = std::chrono::steady_clock;
+
+//! Spans open on this thread
+static thread_local uint32_t sDepth = 0;
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @return the id of the calling thread; ids are handed out in
+//!   order, so they stay readable in a trace viewer
+//!
+//----------------------------------------------------------------
+static uint32_t GetThreadId() {
+  static std::atomic<uint32_t> nextThreadId{1};
+  static thread_local uint32_t threadId = nextThreadId++;
+
+  return threadId;
+}  // end of GetThreadId
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @return microseconds on the steady clock
+//!
+//----------------------------------------------------------------
+static uint64_t GetMicroseconds() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch())
+          .count());
+}  // end of GetMicroseconds
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Start a span named aName, a string literal, if
+//!   tracing.  Otherwise the span costs a single atomic load.
+//!
+//----------------------------------------------------------------
+ScopedSpan::ScopedSpan(const char* aName)
+    : mSink{sSink.load(std::memory_order_acquire)},
+      mName{aName},
+      mDepth{0},
+      mStartMicroseconds{0} {
+  if (mSink != nullptr) {
+    mDepth = sDepth++;
+    mStartMicroseconds = GetMicroseconds();
+  }
+}  // end of ScopedSpan
+
+//----------------------------------------------------------------
+//!
+//!   @public
+//!   @detail Send the span to the sink it started with.
+//!
+//----------------------------------------------------------------
+ScopedSpan::~ScopedSpan() {
+  if (mSink != nullptr) {
+    const uint64_t endMicroseconds = GetMicroseconds();
+    sDepth--;
+
+    mSink->OnSpan(SpanEvent{mName, GetThreadId(), mDepth, mStartMicroseconds,
+                            endMicroseconds - mStartMicroseconds});
+  }
+}  // end of ~ScopedSpan
+
+//----------------------------------------------------------------
+//!
+//!   @private
+//!   @return aString as the contents of a JSON string
+//!
+//----------------------------------------------------------------
+static std::string EscapeJson(const char* aString) {
+  std::string result;
+
+  for (const char* c = aString; c != nullptr && *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\') {
+      result += '\\';
+      result += *c;
+    } else if (static_cast<unsigned char>(*c) < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(*c));
+      result += escaped;
+    } else {
+      result += *c;
+    }
+  }
+
+  return result;
+}  // end of EscapeJson
+
+}  // end of namespace Tracing
+}  // end of namespace Acdb
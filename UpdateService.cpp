@@ -72,7 +72,7 @@ bool UpdateService::ProcessCreateMarkerResponse(const std::string& aResponseBody
     std::vector<MarkerTableDataCollection> markerList;
     markerList.push_back(std::move(marker));
 
-    success = mRepositoryPtr->ApplyMarkerUpdateToDb(markerList, nullptr /* aTileXY */);
+    success = mRepositoryPtr->ApplyMarkerUpdateToDb(std::move(markerList), nullptr /* aTileXY */);
   }
 
   return success;
@@ -97,7 +97,7 @@ bool UpdateService::ProcessMoveMarkerResponse(const std::string& aResponseBody)
     std::vector<MarkerTableDataCollection> markerList;
     markerList.push_back(std::move(marker));
 
-    success = mRepositoryPtr->ApplyMarkerUpdateToDb(markerList, nullptr /* aTileXY */);
+    success = mRepositoryPtr->ApplyMarkerUpdateToDb(std::move(markerList), nullptr /* aTileXY */);
   }
 
   return success;
@@ -120,8 +120,12 @@ bool UpdateService::ProcessSyncMarkersResponse(const std::string& aResponseBody,
 
   aResultCount_out = markers.size();
 
+  // Index a database installed without search data here rather than on open, where it would
+  // block every read.  Does nothing once the search data is complete.
+  mRepositoryPtr->UpdateSearchData();
+
   if (!markers.empty()) {
-    success = success && mRepositoryPtr->ApplyMarkerUpdateToDb(markers, &aTileXY);
+    success = success && mRepositoryPtr->ApplyMarkerUpdateToDb(std::move(markers), &aTileXY);
   }
 
   return success;
@@ -145,7 +149,7 @@ bool UpdateService::ProcessSyncReviewsResponse(const std::string& aResponseBody,
   aResultCount_out = reviews.size();
 
   if (!reviews.empty()) {
-    success = success && mRepositoryPtr->ApplyReviewUpdateToDb(reviews, &aTileXY);
+    success = success && mRepositoryPtr->ApplyReviewUpdateToDb(std::move(reviews), &aTileXY);
   }
 
   return success;
@@ -170,7 +174,8 @@ bool UpdateService::ProcessVoteForReviewResponse(const std::string& aResponseBod
   std::vector<ReviewTableDataCollection> reviewList;
   reviewList.push_back(std::move(review));
 
-  success = success && mRepositoryPtr->ApplyReviewUpdateToDb(reviewList, nullptr /* aTileXY */);
+  success = success &&
+            mRepositoryPtr->ApplyReviewUpdateToDb(std::move(reviewList), nullptr /* aTileXY */);
 
   return success;
 }  // end of ProcessVoteForReviewResponse
@@ -202,7 +207,7 @@ bool UpdateService::ProcessWebViewResponse(const std::string& aJsonMarker) {
       std::vector<MarkerTableDataCollection> markerList;
       markerList.push_back(std::move(marker));
 
-      mRepositoryPtr->ApplyMarkerUpdateToDb(markerList, nullptr /* aTileXY */);
+      mRepositoryPtr->ApplyMarkerUpdateToDb(std::move(markerList), nullptr /* aTileXY */);
       break;
     }
 
@@ -213,7 +218,7 @@ bool UpdateService::ProcessWebViewResponse(const std::string& aJsonMarker) {
       std::vector<ReviewTableDataCollection> reviewList;
       reviewList.push_back(std::move(review));
 
-      mRepositoryPtr->ApplyReviewUpdateToDb(reviewList, nullptr /* aTileXY */);
+      mRepositoryPtr->ApplyReviewUpdateToDb(std::move(reviewList), nullptr /* aTileXY */);
       break;
     }
 